@@ -3,6 +3,7 @@
 #define ANALYSIS_QUADGRAMS_H
 
 #include<array>
+#include<cstdint>
 
 struct Quadgram
 {
@@ -10,13 +11,27 @@ struct Quadgram
   float score;
 };
 
+// Quadgrams missing from the list get the floor, one below the rarest listed quadgram.
+// The table holds 16 bit steps of 1/quantizedScale above the floor, so the missing quadgrams
+// are just the zero default and the scores can be summed up as integers. At 914 KB it is half
+// the size of a float table, the steps are fine enough to keep the ranking of the float scores.
 struct QuadgramContainer
 {
-  constexpr QuadgramContainer(std::initializer_list<Quadgram> list)
+  static constexpr float quantizedScale = 4096.0f;
+
+  template<size_t N>
+  constexpr QuadgramContainer(const Quadgram (&list)[N])
   {
     for(const Quadgram& l : list)
     {
-      quadgrams[(((l.bg[0] -65) * 26 + l.bg[1] -65) * 26 + l.bg[2] -65) * 26 + l.bg[3] -65]  = l.score;
+      if(l.score - 1.0f < floor)
+        floor = l.score - 1.0f;
+    }
+    for(const Quadgram& l : list)
+    {
+      const int index = (((l.bg[0] -65) * 26 + l.bg[1] -65) * 26 + l.bg[2] -65) * 26 + l.bg[3] -65;
+      const float steps = (l.score - floor) * quantizedScale + 0.5f;
+      quantized[index] = steps > 32767.0f ? 32767 : int16_t(steps);
     }
   }
 
@@ -26,13 +41,14 @@ struct QuadgramContainer
     b2 %=26;
     b3 %=26;
     b4 %=26;
-    return quadgrams[((b1 * 26 + b2) * 26 + b3) *26 + b4];
+    return floor + quantized[((b1 * 26 + b2) * 26 + b3) *26 + b4] * (1.0f / quantizedScale);
   }
 
-  std::array<float, 26*26*26*26> quadgrams{};
+  float floor{0.0f};
+  std::array<int16_t, 26*26*26*26> quantized{};
 };
 
-constexpr QuadgramContainer quadgram_scores{
+constexpr Quadgram quadgram_list[] = {
 {"TION",-1.956555816},
 {"ATIO",-2.233540645},
 {"THAT",-2.274925321},
@@ -42205,4 +42221,6 @@ constexpr QuadgramContainer quadgram_scores{
 {"SYSL",-7.178251953},
 {"RGAA",-7.178343141}};
 
+constexpr QuadgramContainer quadgram_scores{quadgram_list};
+
 #endif
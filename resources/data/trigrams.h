@@ -0,0 +1,8697 @@
+#ifndef ANALYSIS_TRIGRAMS_H
+#define ANALYSIS_TRIGRAMS_H
+
+#include<array>
+
+struct Trigram
+{
+  const char* bg;
+  float score;
+};
+
+// trigrams missing from the list get the floor, one below the rarest listed trigram
+struct TrigramContainer
+{
+  constexpr TrigramContainer(std::initializer_list<Trigram> list)
+  {
+    for(const Trigram& l : list)
+    {
+      if(l.score - 1.0f < floor)
+        floor = l.score - 1.0f;
+    }
+    for(float& t : trigrams)
+      t = floor;
+    for(const Trigram& l : list)
+    {
+      trigrams[((l.bg[0] -65) * 26 + l.bg[1] -65) * 26 + l.bg[2] -65] = l.score;
+    }
+  }
+
+  constexpr float score(int b1, int b2, int b3) const
+  {
+    b1 %=26;
+    b2 %=26;
+    b3 %=26;
+    return trigrams[(b1 * 26 + b2) * 26 + b3];
+  }
+
+  float floor{0.0f};
+  std::array<float, 26*26*26> trigrams{};
+};
+
+constexpr TrigramContainer trigram_scores{
+{"THE",-1.481591685},
+{"AND",-1.899097987},
+{"ING",-1.99365514},
+{"ION",-2.011149945},
+{"TIO",-2.09602481},
+{"ENT",-2.131094701},
+{"ATI",-2.250758395},
+{"FOR",-2.266751208},
+{"HER",-2.283537451},
+{"TER",-2.309075389},
+{"HAT",-2.339770535},
+{"THA",-2.346516427},
+{"ERE",-2.370536435},
+{"ATE",-2.379451398},
+{"HIS",-2.414790753},
+{"CON",-2.415020817},
+{"RES",-2.446944541},
+{"VER",-2.451682489},
+{"ALL",-2.457440292},
+{"ONS",-2.46525436},
+{"NCE",-2.480691889},
+{"MEN",-2.483663822},
+{"ITH",-2.489638418},
+{"TED",-2.501579361},
+{"ERS",-2.50728671},
+{"PRO",-2.512871083},
+{"THI",-2.518547279},
+{"WIT",-2.524556217},
+{"ARE",-2.540008315},
+{"ESS",-2.54646152},
+{"NOT",-2.553072439},
+{"IVE",-2.56301884},
+{"WAS",-2.564165633},
+{"ECT",-2.571074262},
+{"REA",-2.572508908},
+{"COM",-2.580464866},
+{"EVE",-2.592049511},
+{"PER",-2.594256589},
+{"INT",-2.599844845},
+{"EST",-2.614855071},
+{"STA",-2.622538816},
+{"CTI",-2.625885365},
+{"ICA",-2.635991821},
+{"IST",-2.650029441},
+{"EAR",-2.662317362},
+{"AIN",-2.667853541},
+{"ONE",-2.67590658},
+{"OUR",-2.677785399},
+{"ITI",-2.677842589},
+{"RAT",-2.684031149},
+{"NTE",-2.685738067},
+{"TIN",-2.686877726},
+{"INE",-2.689426553},
+{"DER",-2.691400944},
+{"OME",-2.697011041},
+{"MAN",-2.701660196},
+{"PRE",-2.702166915},
+{"ROM",-2.706837359},
+{"TRA",-2.708688086},
+{"WHI",-2.713693163},
+{"AVE",-2.714207011},
+{"STR",-2.719260319},
+{"ACT",-2.720171715},
+{"ILL",-2.720300925},
+{"URE",-2.725842153},
+{"IDE",-2.728895623},
+{"OVE",-2.728974704},
+{"CAL",-2.729373421},
+{"BLE",-2.733595406},
+{"OUT",-2.734992435},
+{"STI",-2.737683474},
+{"TIC",-2.738889848},
+{"OUN",-2.739429616},
+{"ENC",-2.741556396},
+{"ORE",-2.742336955},
+{"ANT",-2.747152161},
+{"ITY",-2.748922464},
+{"FRO",-2.749651044},
+{"ART",-2.750518812},
+{"TUR",-2.751729553},
+{"PAR",-2.754636053},
+{"RED",-2.756937688},
+{"OTH",-2.758025723},
+{"ERI",-2.761328028},
+{"HIC",-2.763377938},
+{"IES",-2.764758224},
+{"STE",-2.766425821},
+{"GHT",-2.766855704},
+{"ICH",-2.768259545},
+{"IGH",-2.771176862},
+{"UND",-2.772688791},
+{"YOU",-2.774438779},
+{"ORT",-2.77465739},
+{"ERA",-2.781857404},
+{"WER",-2.783407477},
+{"NTI",-2.783660707},
+{"OUL",-2.791119232},
+{"NDE",-2.793961084},
+{"IND",-2.794195697},
+{"THO",-2.794264417},
+{"HOU",-2.79774949},
+{"NAL",-2.799624443},
+{"BUT",-2.8048907},
+{"HAV",-2.807377189},
+{"ULD",-2.808604671},
+{"USE",-2.810059205},
+{"HAN",-2.811744517},
+{"HIN",-2.817660909},
+{"EEN",-2.823506312},
+{"CES",-2.824014931},
+{"COU",-2.826034467},
+{"LAT",-2.826434877},
+{"TOR",-2.82800924},
+{"ESE",-2.832847817},
+{"AGE",-2.833368538},
+{"AME",-2.835616877},
+{"RIN",-2.835833794},
+{"ANC",-2.83594553},
+{"TEN",-2.838061183},
+{"HEN",-2.840656797},
+{"MIN",-2.842646684},
+{"EAS",-2.847772744},
+{"CAN",-2.852761176},
+{"LIT",-2.852856174},
+{"CHA",-2.853794319},
+{"OUS",-2.855951209},
+{"EAT",-2.856311392},
+{"END",-2.863319748},
+{"SSI",-2.866151485},
+{"IAL",-2.86746065},
+{"LES",-2.868393122},
+{"REN",-2.869415119},
+{"TIV",-2.87097145},
+{"NTS",-2.871594727},
+{"WHE",-2.871594819},
+{"TAT",-2.872114688},
+{"ABL",-2.872515489},
+{"DIS",-2.878773435},
+{"RAN",-2.881451641},
+{"WOR",-2.885520197},
+{"ROU",-2.886445047},
+{"LIN",-2.887592243},
+{"HAD",-2.887802836},
+{"SED",-2.88850555},
+{"ONT",-2.888910448},
+{"PLE",-2.888973152},
+{"UGH",-2.89018271},
+{"INC",-2.895258826},
+{"SIO",-2.895827948},
+{"DIN",-2.896264607},
+{"RAL",-2.900034851},
+{"UST",-2.902493329},
+{"TAN",-2.909311833},
+{"NAT",-2.909547078},
+{"INS",-2.910191649},
+{"ASS",-2.913151769},
+{"PLA",-2.913359135},
+{"VEN",-2.913389371},
+{"ELL",-2.913539469},
+{"SHE",-2.917459849},
+{"OSE",-2.917678418},
+{"ITE",-2.917967776},
+{"LLY",-2.919095187},
+{"REC",-2.91938281},
+{"LAN",-2.922977516},
+{"ARD",-2.926016498},
+{"HEY",-2.927014154},
+{"RIE",-2.92743745},
+{"POS",-2.930152566},
+{"EME",-2.93163172},
+{"MOR",-2.933099371},
+{"DEN",-2.936308858},
+{"OUG",-2.936581486},
+{"TTE",-2.937753591},
+{"NED",-2.940323467},
+{"RIT",-2.942827875},
+{"IME",-2.945941806},
+{"SIN",-2.951338307},
+{"AST",-2.95258792},
+{"ANY",-2.955144382},
+{"ORM",-2.955480179},
+{"NDI",-2.955484378},
+{"ONA",-2.955935357},
+{"SPE",-2.956597568},
+{"ENE",-2.957200848},
+{"HEI",-2.957573254},
+{"RIC",-2.958539491},
+{"ICE",-2.961085493},
+{"ORD",-2.96261843},
+{"OMP",-2.963349829},
+{"NES",-2.963460226},
+{"SEN",-2.964027714},
+{"TIM",-2.96411831},
+{"TRI",-2.964866862},
+{"ERN",-2.966279522},
+{"TES",-2.96884062},
+{"POR",-2.968906081},
+{"APP",-2.969524548},
+{"LAR",-2.978033989},
+{"NTR",-2.978577906},
+{"EIR",-2.978612621},
+{"SHO",-2.979310429},
+{"SON",-2.985334172},
+{"CAT",-2.986057202},
+{"LLE",-2.986247695},
+{"NER",-2.986379856},
+{"HES",-2.98674535},
+{"WHO",-2.987315257},
+{"MAT",-2.987883815},
+{"ASE",-2.988497269},
+{"KIN",-2.989030257},
+{"OST",-2.989380817},
+{"BER",-2.991404318},
+{"ITS",-2.991536385},
+{"NIN",-2.991615159},
+{"LEA",-2.993166677},
+{"INA",-2.996417428},
+{"MPL",-2.996663489},
+{"STO",-2.996808332},
+{"ARI",-2.999933786},
+{"PRI",-3.000772132},
+{"OWN",-3.000795418},
+{"ALI",-3.001267524},
+{"REE",-3.004016772},
+{"ISH",-3.004971053},
+{"DES",-3.00676007},
+{"EAD",-3.007919705},
+{"NST",-3.009103317},
+{"SIT",-3.009590151},
+{"SES",-3.010456675},
+{"ANS",-3.015183346},
+{"HAS",-3.016992704},
+{"GRE",-3.020426923},
+{"ONG",-3.02048651},
+{"ALS",-3.020728333},
+{"FIC",-3.021261265},
+{"UAL",-3.021599327},
+{"IEN",-3.021861144},
+{"GEN",-3.022606253},
+{"SER",-3.023620052},
+{"UNT",-3.024606791},
+{"ECO",-3.024794015},
+{"NTA",-3.025447144},
+{"ACE",-3.025609654},
+{"CHI",-3.026221872},
+{"FER",-3.026236142},
+{"TAL",-3.026747634},
+{"LOW",-3.027339807},
+{"ACH",-3.02807889},
+{"IRE",-3.028497141},
+{"ANG",-3.028914727},
+{"SSE",-3.029391376},
+{"GRA",-3.029765017},
+{"MON",-3.030553884},
+{"FFE",-3.031272453},
+{"RAC",-3.032531045},
+{"SEL",-3.03297034},
+{"UNI",-3.033349204},
+{"AKE",-3.03335497},
+{"ARY",-3.035516762},
+{"WIL",-3.035815156},
+{"LED",-3.035933525},
+{"DED",-3.036807239},
+{"SOM",-3.040396403},
+{"OWE",-3.042569278},
+{"HAR",-3.042672359},
+{"INI",-3.04499089},
+{"OPE",-3.045802552},
+{"NGE",-3.046505887},
+{"UCH",-3.04680919},
+{"REL",-3.04740828},
+{"CHE",-3.047777185},
+{"ADE",-3.048073636},
+{"ATT",-3.048655727},
+{"CIA",-3.04916112},
+{"EXP",-3.050233134},
+{"MER",-3.050860224},
+{"LIC",-3.053146732},
+{"HEM",-3.057529272},
+{"ERY",-3.058053559},
+{"NSI",-3.061006883},
+{"OND",-3.061386271},
+{"RTI",-3.061510921},
+{"DUC",-3.061957345},
+{"HOW",-3.062779348},
+{"ERT",-3.064261247},
+{"SEE",-3.066141445},
+{"NOW",-3.068679289},
+{"IMP",-3.06957035},
+{"ABO",-3.069692185},
+{"PEC",-3.070380459},
+{"CEN",-3.070477938},
+{"RIS",-3.070904315},
+{"MAR",-3.07239632},
+{"ENS",-3.073612904},
+{"TAI",-3.075079202},
+{"ELY",-3.078467885},
+{"OMM",-3.079373304},
+{"SUR",-3.082500356},
+{"HEA",-3.086347257},
+{"ULA",-3.088008387},
+{"ULT",-3.088219612},
+{"ILI",-3.092276364},
+{"BEE",-3.09425421},
+{"ORK",-3.095723828},
+{"LIS",-3.09597994},
+{"NIT",-3.096556113},
+{"ORI",-3.096641928},
+{"THR",-3.098288115},
+{"ATH",-3.102658283},
+{"VEL",-3.103144447},
+{"TIE",-3.106314799},
+{"ANI",-3.110816705},
+{"CUL",-3.11142091},
+{"HIL",-3.111500729},
+{"TEM",-3.111630565},
+{"RIA",-3.112474107},
+{"TRE",-3.113251163},
+{"IVI",-3.115973051},
+{"VES",-3.11612231},
+{"PEN",-3.116723916},
+{"CRE",-3.116856779},
+{"OLL",-3.118261918},
+{"ELE",-3.119209811},
+{"LON",-3.121204206},
+{"WAR",-3.122095553},
+{"EQU",-3.122279015},
+{"TRO",-3.122439562},
+{"EAL",-3.124167423},
+{"REP",-3.124667631},
+{"ELI",-3.124938576},
+{"IAN",-3.126163778},
+{"SID",-3.126212648},
+{"ISE",-3.126389093},
+{"ERV",-3.129676245},
+{"TRU",-3.131733627},
+{"ILE",-3.131818095},
+{"QUE",-3.134074582},
+{"HIM",-3.13508643},
+{"MED",-3.136137469},
+{"WOU",-3.136867802},
+{"FIN",-3.139740244},
+{"UCT",-3.140961133},
+{"OLD",-3.144062342},
+{"OOD",-3.145533811},
+{"COR",-3.147068346},
+{"NEW",-3.147210066},
+{"EAC",-3.151228063},
+{"ERM",-3.153016262},
+{"FAC",-3.15367388},
+{"BOU",-3.154180068},
+{"ACK",-3.156105862},
+{"SUC",-3.156378831},
+{"EDI",-3.159938602},
+{"NTO",-3.160573458},
+{"CAR",-3.16101495},
+{"OLI",-3.16245418},
+{"NLY",-3.163430663},
+{"MIL",-3.163744185},
+{"EED",-3.16419024},
+{"WAY",-3.166182647},
+{"ROP",-3.166977716},
+{"ITA",-3.167267266},
+{"ETH",-3.171168068},
+{"ECI",-3.17135294},
+{"UTI",-3.17135637},
+{"MAY",-3.171852283},
+{"ICI",-3.17215904},
+{"WHA",-3.173268996},
+{"RMA",-3.174839462},
+{"ARA",-3.177912191},
+{"QUI",-3.180571156},
+{"REM",-3.181866776},
+{"MBE",-3.183096865},
+{"FTE",-3.184637111},
+{"RST",-3.18670189},
+{"VED",-3.18846926},
+{"CTE",-3.189167659},
+{"NDS",-3.191397888},
+{"FIR",-3.19145763},
+{"LIE",-3.191940276},
+{"MET",-3.192915733},
+{"OOK",-3.194538342},
+{"MOS",-3.195917651},
+{"MES",-3.196094142},
+{"ACC",-3.196194387},
+{"VIN",-3.196270823},
+{"GIN",-3.198170101},
+{"ETE",-3.199907758},
+{"RGE",-3.201772493},
+{"OIN",-3.202671347},
+{"ARR",-3.202855051},
+{"HOL",-3.203729499},
+{"IGN",-3.203749698},
+{"SEC",-3.204217344},
+{"PON",-3.204255306},
+{"ESI",-3.204415974},
+{"TLY",-3.206804044},
+{"EMP",-3.207410555},
+{"SIS",-3.207899436},
+{"IED",-3.209198657},
+{"OTE",-3.209241702},
+{"RTH",-3.209625992},
+{"MAL",-3.210508017},
+{"COL",-3.211809956},
+{"DIT",-3.213844708},
+{"BLI",-3.214949835},
+{"RON",-3.215055165},
+{"GES",-3.215854051},
+{"SHI",-3.216305057},
+{"CIE",-3.216818117},
+{"ATU",-3.217390433},
+{"RET",-3.218629849},
+{"GER",-3.218671131},
+{"REF",-3.218963075},
+{"OLO",-3.219559856},
+{"AUS",-3.220766924},
+{"RCH",-3.221011324},
+{"LAC",-3.222301274},
+{"LLO",-3.222671037},
+{"TLE",-3.224352833},
+{"TIT",-3.225989072},
+{"IFI",-3.22633875},
+{"HOS",-3.22676133},
+{"BEC",-3.227844935},
+{"PEA",-3.228351086},
+{"ECE",-3.229775919},
+{"LLI",-3.229786012},
+{"ONC",-3.230045626},
+{"RCE",-3.230275224},
+{"FUL",-3.230325058},
+{"GRO",-3.231827433},
+{"ORS",-3.234651006},
+{"LAS",-3.235188233},
+{"RIO",-3.235387069},
+{"ARS",-3.236426239},
+{"CED",-3.236636973},
+{"WIN",-3.236788365},
+{"ONL",-3.237318587},
+{"VID",-3.238293424},
+{"NGS",-3.23909737},
+{"IOU",-3.239794685},
+{"ORY",-3.240264808},
+{"CLE",-3.241665719},
+{"LEC",-3.242240269},
+{"ITT",-3.243672973},
+{"URI",-3.243991728},
+{"OSS",-3.246454298},
+{"RTA",-3.247311189},
+{"CER",-3.247940064},
+{"POL",-3.248665531},
+{"NIS",-3.248994115},
+{"ARL",-3.250503977},
+{"EXT",-3.251524829},
+{"HED",-3.251593268},
+{"PPE",-3.253058632},
+{"ISI",-3.253370523},
+{"VAL",-3.254603022},
+{"ARG",-3.256027494},
+{"RIG",-3.258084706},
+{"NSE",-3.258896014},
+{"HOR",-3.259720018},
+{"ISS",-3.260368106},
+{"IAT",-3.260536209},
+{"CRI",-3.261019079},
+{"ELA",-3.261426752},
+{"ESP",-3.261646653},
+{"ITU",-3.263319789},
+{"TWO",-3.263349174},
+{"NOR",-3.26450191},
+{"RSE",-3.264907288},
+{"OFF",-3.265645442},
+{"IFF",-3.26574751},
+{"TEL",-3.266019536},
+{"ETI",-3.267300869},
+{"IRS",-3.26763571},
+{"CUR",-3.268808922},
+{"AID",-3.269590767},
+{"BET",-3.270038084},
+{"RAI",-3.271500941},
+{"CAS",-3.273066372},
+{"TIL",-3.274408748},
+{"LSO",-3.27516325},
+{"CHO",-3.276029547},
+{"EAN",-3.276072173},
+{"OCI",-3.277456108},
+{"TAB",-3.278730349},
+{"QUA",-3.278913642},
+{"FFI",-3.279443441},
+{"USI",-3.279952598},
+{"MPO",-3.280850596},
+{"DIA",-3.281359551},
+{"IKE",-3.281494613},
+{"PAT",-3.282498469},
+{"TON",-3.28258564},
+{"DIF",-3.282635518},
+{"UES",-3.282859103},
+{"MIT",-3.283935841},
+{"SOC",-3.284372365},
+{"SHA",-3.285074762},
+{"KNO",-3.285203738},
+{"ROV",-3.285441619},
+{"NCI",-3.28550722},
+{"MUS",-3.286266773},
+{"URA",-3.286956486},
+{"AFT",-3.287847349},
+{"LOG",-3.28803954},
+{"HRO",-3.288067056},
+{"INF",-3.288941305},
+{"CAU",-3.289175918},
+{"LET",-3.289341766},
+{"ALT",-3.289367925},
+{"RRE",-3.28965457},
+{"ANA",-3.289753663},
+{"ELF",-3.291518728},
+{"ENG",-3.29160817},
+{"ETT",-3.291882831},
+{"ORA",-3.293081637},
+{"MIS",-3.293354448},
+{"REG",-3.29344988},
+{"LIG",-3.29367487},
+{"EPT",-3.293799417},
+{"AIL",-3.293953032},
+{"URN",-3.294078629},
+{"UTE",-3.294356761},
+{"ROD",-3.294475353},
+{"IMA",-3.295463089},
+{"MEA",-3.295738441},
+{"TAR",-3.297383572},
+{"ALE",-3.298169033},
+{"OLE",-3.298443905},
+{"OSI",-3.29920843},
+{"EIN",-3.299658742},
+{"UTH",-3.302895286},
+{"WEL",-3.304003885},
+{"CLA",-3.30431798},
+{"WEE",-3.305215369},
+{"TIA",-3.306996618},
+{"EMB",-3.307263391},
+{"DAY",-3.308966107},
+{"ASI",-3.309887165},
+{"RDE",-3.30990585},
+{"STU",-3.310207842},
+{"URS",-3.31024424},
+{"FOU",-3.312268654},
+{"IZE",-3.312370218},
+{"OMI",-3.313227496},
+{"EFO",-3.314886873},
+{"LIK",-3.315973592},
+{"REV",-3.316972838},
+{"AYS",-3.319506615},
+{"ELO",-3.32104248},
+{"RAD",-3.322337325},
+{"DEA",-3.322623013},
+{"TAK",-3.322783034},
+{"SUP",-3.322838842},
+{"SUB",-3.322849187},
+{"SOU",-3.323265655},
+{"ECA",-3.323564307},
+{"EMA",-3.325799469},
+{"ODU",-3.325933677},
+{"YEA",-3.326374058},
+{"ILD",-3.326491627},
+{"SPO",-3.327255607},
+{"LEN",-3.327897871},
+{"MPA",-3.328010765},
+{"DIC",-3.328828277},
+{"PLI",-3.328877487},
+{"FEC",-3.329826328},
+{"RRI",-3.330059269},
+{"EVI",-3.33076825},
+{"ICT",-3.332815138},
+{"TUD",-3.332915853},
+{"LOS",-3.333694647},
+{"CTU",-3.333754091},
+{"LEM",-3.335033867},
+{"HAL",-3.33575303},
+{"TWE",-3.336909088},
+{"ISC",-3.338057734},
+{"ROC",-3.339147513},
+{"CTO",-3.339898578},
+{"ARC",-3.340336987},
+{"SIG",-3.341820328},
+{"AMI",-3.342191129},
+{"KED",-3.345184034},
+{"JEC",-3.345298837},
+{"HAP",-3.346188452},
+{"PTI",-3.346755509},
+{"BRI",-3.346963467},
+{"UBL",-3.347188072},
+{"SOL",-3.347394823},
+{"RLY",-3.347851607},
+{"CIT",-3.348441428},
+{"ADI",-3.349012033},
+{"FRE",-3.349534043},
+{"CTS",-3.349686807},
+{"AIR",-3.35054859},
+{"ROW",-3.350710234},
+{"NGL",-3.351415938},
+{"UDE",-3.351502019},
+{"STS",-3.353021894},
+{"DRE",-3.353425121},
+{"NIC",-3.354391866},
+{"DEC",-3.355971832},
+{"PAN",-3.356489731},
+{"BIL",-3.356517816},
+{"LIF",-3.358894138},
+{"NNE",-3.359754445},
+{"LOO",-3.359834071},
+{"AMP",-3.360726208},
+{"SAI",-3.362356898},
+{"UNC",-3.362718649},
+{"XPE",-3.364804803},
+{"IMI",-3.365519264},
+{"GAI",-3.366312672},
+{"ARK",-3.366828524},
+{"TIS",-3.367638869},
+{"HEL",-3.369705468},
+{"VIS",-3.370981615},
+{"MAK",-3.371412751},
+{"AGA",-3.37299042},
+{"IBL",-3.374032662},
+{"IFE",-3.374414472},
+{"SEA",-3.374548609},
+{"ROB",-3.375218803},
+{"TOO",-3.375244578},
+{"GET",-3.378507478},
+{"EFF",-3.378808436},
+{"RTE",-3.378951902},
+{"PPO",-3.379495002},
+{"DEP",-3.380641428},
+{"AVI",-3.380771582},
+{"RNE",-3.381271244},
+{"RIB",-3.381652582},
+{"VOL",-3.383332979},
+{"MAD",-3.383451133},
+{"GIV",-3.384306442},
+{"DIE",-3.385089265},
+{"RDS",-3.385738277},
+{"SCH",-3.386252935},
+{"ROL",-3.386527335},
+{"OVI",-3.387301821},
+{"RIV",-3.387463944},
+{"DEV",-3.387822339},
+{"TRY",-3.390578546},
+{"ODE",-3.392482837},
+{"GAN",-3.39430621},
+{"BEL",-3.395468678},
+{"NDA",-3.395494077},
+{"LIA",-3.396217558},
+{"RVE",-3.396442786},
+{"MIC",-3.397864109},
+{"ETW",-3.398736458},
+{"TUA",-3.400489864},
+{"ERC",-3.401659387},
+{"DEL",-3.402652367},
+{"CLU",-3.403315067},
+{"UME",-3.404109543},
+{"EGI",-3.404169681},
+{"SAM",-3.405426503},
+{"MAI",-3.405785792},
+{"ANN",-3.408045399},
+{"ICU",-3.408395123},
+{"ROS",-3.409162297},
+{"EMS",-3.410551359},
+{"ARM",-3.414667128},
+{"EMO",-3.414793246},
+{"SIB",-3.415494999},
+{"YST",-3.416530732},
+{"EGA",-3.417958086},
+{"SCR",-3.418651542},
+{"OLU",-3.420120949},
+{"RAM",-3.422554409},
+{"UPP",-3.424404332},
+{"LVE",-3.424800536},
+{"BRO",-3.425270651},
+{"UEN",-3.426584092},
+{"CAM",-3.427049556},
+{"RNA",-3.427255697},
+{"URT",-3.42862508},
+{"PIN",-3.430509802},
+{"TTL",-3.430812639},
+{"EXA",-3.432389774},
+{"RUC",-3.432439767},
+{"HIG",-3.434142106},
+{"ETA",-3.434813263},
+{"DID",-3.435370352},
+{"FOL",-3.437071994},
+{"VIC",-3.437097534},
+{"MME",-3.437202963},
+{"DAT",-3.437851703},
+{"EDU",-3.437997202},
+{"OCE",-3.439990791},
+{"CEP",-3.44031578},
+{"ROT",-3.44059181},
+{"VIE",-3.440795195},
+{"PAS",-3.441045965},
+{"ORG",-3.441945657},
+{"NTL",-3.442051251},
+{"SET",-3.443253331},
+{"OTI",-3.443592505},
+{"SPI",-3.443611111},
+{"RSO",-3.446020909},
+{"ILY",-3.447987285},
+{"DIV",-3.448024441},
+{"ATO",-3.448851667},
+{"INV",-3.448863196},
+{"BAS",-3.449729271},
+{"PUB",-3.449790744},
+{"AUT",-3.450003123},
+{"ONI",-3.45010015},
+{"EXC",-3.450338001},
+{"SSU",-3.450569204},
+{"MOD",-3.45086692},
+{"RMI",-3.451382744},
+{"LUE",-3.452345854},
+{"OPL",-3.452411973},
+{"LOR",-3.453336941},
+{"EIG",-3.454094266},
+{"POI",-3.454209165},
+{"JUS",-3.456858705},
+{"EOP",-3.457139319},
+{"DGE",-3.457928239},
+{"EET",-3.458265415},
+{"ERR",-3.459184733},
+{"MOT",-3.460043089},
+{"CCO",-3.461497697},
+{"OMA",-3.461662646},
+{"NVE",-3.462434291},
+{"ONO",-3.462779708},
+{"FIE",-3.463066143},
+{"YIN",-3.463922334},
+{"HIP",-3.464215726},
+{"RAP",-3.464408705},
+{"HOO",-3.465114672},
+{"ISM",-3.465204112},
+{"URC",-3.465832702},
+{"DOW",-3.467567897},
+{"ULL",-3.468255896},
+{"BRA",-3.469016085},
+{"LAY",-3.469799793},
+{"UMB",-3.470085945},
+{"NCL",-3.470196181},
+{"ICK",-3.470525286},
+{"NME",-3.47108792},
+{"CAP",-3.471923948},
+{"HOM",-3.472415481},
+{"GED",-3.472817788},
+{"LOP",-3.47330842},
+{"IET",-3.473751142},
+{"LER",-3.473939571},
+{"OGR",-3.475500237},
+{"EFE",-3.475654204},
+{"DEF",-3.476279445},
+{"SSA",-3.476835583},
+{"VAR",-3.477261865},
+{"NUM",-3.477301421},
+{"CCE",-3.47798263},
+{"NEE",-3.478071705},
+{"HRE",-3.478563876},
+{"TEA",-3.478905359},
+{"LEG",-3.479274089},
+{"PEO",-3.480581235},
+{"LOC",-3.481569067},
+{"BOT",-3.481828554},
+{"PED",-3.482026849},
+{"ENI",-3.48207968},
+{"LAI",-3.483461793},
+{"PUT",-3.483629356},
+{"AMO",-3.484583582},
+{"INK",-3.484594837},
+{"RDI",-3.4849951},
+{"ELD",-3.485788408},
+{"SIC",-3.487276216},
+{"RVI",-3.488162811},
+{"REQ",-3.488184156},
+{"BEI",-3.489313539},
+{"BAC",-3.489813628},
+{"LIV",-3.490365275},
+{"RNI",-3.491200875},
+{"MEM",-3.493394297},
+{"MOU",-3.495214162},
+{"EPA",-3.495678149},
+{"RME",-3.495819009},
+{"SUL",-3.495820913},
+{"BOR",-3.49609863},
+{"DUR",-3.497040928},
+{"DON",-3.497224489},
+{"OOL",-3.497257629},
+{"SCO",-3.497495264},
+{"SIM",-3.498091249},
+{"PPL",-3.498357119},
+{"CRO",-3.499736558},
+{"RTS",-3.500085157},
+{"ADD",-3.500831543},
+{"EMI",-3.501477976},
+{"MPE",-3.501718438},
+{"FRA",-3.501892268},
+{"FIG",-3.50245052},
+{"RKE",-3.503364182},
+{"ESC",-3.50725835},
+{"ABI",-3.50778503},
+{"ANO",-3.507905258},
+{"UIT",-3.508085448},
+{"TEC",-3.508649232},
+{"RIM",-3.509426263},
+{"APE",-3.509646874},
+{"CUS",-3.51031272},
+{"SUM",-3.510832823},
+{"BAN",-3.512231823},
+{"BJE",-3.513049055},
+{"ANE",-3.513199941},
+{"GOO",-3.513204121},
+{"ESU",-3.513805581},
+{"OCK",-3.514545977},
+{"TEE",-3.515686738},
+{"ERF",-3.516696627},
+{"SAL",-3.517537814},
+{"DEM",-3.518643059},
+{"VAT",-3.519130004},
+{"UDI",-3.521279918},
+{"MUC",-3.521854901},
+{"SYS",-3.522117539},
+{"LLA",-3.522594425},
+{"NOM",-3.523067635},
+{"TCH",-3.524577694},
+{"UCE",-3.526077424},
+{"SOR",-3.526191013},
+{"NDO",-3.526267751},
+{"TIF",-3.526277389},
+{"UAT",-3.526288809},
+{"NCH",-3.526873502},
+{"NDU",-3.527419975},
+{"RSI",-3.527632607},
+{"GAT",-3.528351535},
+{"VAN",-3.528621738},
+{"PPR",-3.5286789},
+{"MOV",-3.529208777},
+{"ECH",-3.529291441},
+{"CIP",-3.529541601},
+{"ROO",-3.530099322},
+{"ELS",-3.531119014},
+{"NEC",-3.531385687},
+{"BEF",-3.531571404},
+{"CLO",-3.532272751},
+{"ORN",-3.532586989},
+{"PTE",-3.534219932},
+{"ALU",-3.536156981},
+{"EEM",-3.536644374},
+{"ONF",-3.536763329},
+{"SCI",-3.53787916},
+{"IGI",-3.539365632},
+{"ROA",-3.540488782},
+{"MAG",-3.540693419},
+{"LAB",-3.540819054},
+{"DET",-3.541059604},
+{"KEN",-3.541172476},
+{"ILA",-3.541497339},
+{"ORR",-3.541540102},
+{"RAG",-3.541846093},
+{"RUS",-3.542185848},
+{"OES",-3.544211567},
+{"SAY",-3.54465775},
+{"ACI",-3.544726898},
+{"PUR",-3.544816571},
+{"GAR",-3.545455884},
+{"NAR",-3.545677729},
+{"CIS",-3.54587244},
+{"NAM",-3.546186924},
+{"ANK",-3.546462714},
+{"VIT",-3.546664317},
+{"WAT",-3.546736838},
+{"PRA",-3.547296334},
+{"NCO",-3.548216177},
+{"POW",-3.550179685},
+{"FEE",-3.551937178},
+{"FAI",-3.552106625},
+{"ECU",-3.552119868},
+{"ROG",-3.552641577},
+{"FAR",-3.553478623},
+{"TME",-3.553729136},
+{"LUT",-3.553914302},
+{"IER",-3.554051767},
+{"ORL",-3.554857404},
+{"RTY",-3.555314851},
+{"OWI",-3.555521517},
+{"DIR",-3.555783489},
+{"NCT",-3.556203694},
+{"LEV",-3.556324976},
+{"PLO",-3.557010347},
+{"PAI",-3.557564801},
+{"MUN",-3.55778907},
+{"GOV",-3.558023083},
+{"ICS",-3.558148231},
+{"NFO",-3.558198757},
+{"SAN",-3.558248443},
+{"SSO",-3.558421349},
+{"OCA",-3.55853807},
+{"EEP",-3.560624266},
+{"TOM",-3.561624583},
+{"LAW",-3.561916},
+{"URR",-3.562371885},
+{"LTH",-3.562470033},
+{"NTH",-3.56326562},
+{"OUP",-3.56360523},
+{"IBE",-3.563754721},
+{"PIT",-3.565459827},
+{"EPE",-3.566092802},
+{"MAS",-3.566138709},
+{"INU",-3.566558945},
+{"VIO",-3.567113739},
+{"NAN",-3.567804928},
+{"LLS",-3.56845914},
+{"NET",-3.568493193},
+{"OBL",-3.56907659},
+{"WRI",-3.569366678},
+{"LUD",-3.569645227},
+{"AFF",-3.570321394},
+{"APT",-3.57056132},
+{"PHI",-3.570775591},
+{"CCU",-3.570873174},
+{"FRI",-3.572535038},
+{"EPR",-3.572836343},
+{"RMS",-3.573213818},
+{"IEW",-3.573317627},
+{"IVA",-3.575607748},
+{"SMA",-3.575784425},
+{"DAR",-3.576285844},
+{"ALO",-3.577281181},
+{"OCC",-3.577420523},
+{"XAM",-3.57760717},
+{"LIM",-3.578456177},
+{"UPO",-3.579652345},
+{"EDE",-3.580075268},
+{"SPA",-3.580717612},
+{"DOM",-3.582746115},
+{"EFI",-3.583153706},
+{"RGA",-3.583264567},
+{"CEL",-3.583336663},
+{"GNI",-3.583533899},
+{"TUT",-3.585348415},
+{"IZA",-3.585428686},
+{"SLA",-3.586424451},
+{"DRA",-3.586896235},
+{"UIR",-3.587030429},
+{"HUS",-3.587262537},
+{"SAT",-3.587506558},
+{"OKE",-3.587576952},
+{"ENA",-3.588354004},
+{"MIG",-3.588463577},
+{"FUN",-3.588596605},
+{"RLD",-3.58875358},
+{"ORC",-3.589320141},
+{"SEV",-3.590602719},
+{"NEV",-3.591180764},
+{"LUS",-3.591247751},
+{"ARN",-3.591432669},
+{"MSE",-3.591754982},
+{"UAR",-3.59187816},
+{"ERO",-3.592154094},
+{"DAN",-3.593306255},
+{"PUL",-3.594176368},
+{"EAK",-3.594436419},
+{"TTI",-3.595454663},
+{"ZED",-3.596976447},
+{"ADV",-3.598310319},
+{"OPP",-3.600508647},
+{"OWS",-3.601434019},
+{"PAC",-3.602173181},
+{"ENO",-3.602402051},
+{"ERG",-3.603796324},
+{"TOW",-3.604199071},
+{"UNG",-3.605148514},
+{"MPT",-3.605456641},
+{"PHY",-3.605784563},
+{"WEV",-3.606388758},
+{"BIT",-3.608192546},
+{"EXI",-3.60826038},
+{"PIC",-3.60875307},
+{"SIV",-3.609045569},
+{"MMU",-3.610130107},
+{"NCR",-3.610528961},
+{"YSI",-3.610640513},
+{"LIZ",-3.61079961},
+{"BOO",-3.61092298},
+{"AKI",-3.611454614},
+{"NEA",-3.613021302},
+{"KER",-3.61327216},
+{"OGI",-3.613446282},
+{"CIN",-3.614481698},
+{"IOR",-3.614803622},
+{"RAB",-3.615902607},
+{"VIL",-3.61688306},
+{"RRO",-3.616945666},
+{"WED",-3.618797951},
+{"TAG",-3.619519709},
+{"FIL",-3.619806837},
+{"ASK",-3.620527531},
+{"FAM",-3.621522342},
+{"BEA",-3.622432518},
+{"BAR",-3.62363298},
+{"BLY",-3.624209777},
+{"CKE",-3.624282352},
+{"SCA",-3.625056893},
+{"USS",-3.625239317},
+{"HUM",-3.625772302},
+{"ISO",-3.627112973},
+{"GIC",-3.629032212},
+{"WOM",-3.629126693},
+{"BRE",-3.630829423},
+{"ASO",-3.631948499},
+{"EAV",-3.632603948},
+{"NSU",-3.632645084},
+{"THU",-3.634218923},
+{"MMI",-3.636456337},
+{"IEV",-3.636890986},
+{"IBI",-3.637343699},
+{"PIR",-3.638015053},
+{"ONV",-3.640060286},
+{"ATA",-3.641831513},
+{"NIZ",-3.642098555},
+{"MMO",-3.644128727},
+{"EEL",-3.644198584},
+{"ZAT",-3.644892575},
+{"EPO",-3.645012046},
+{"BES",-3.645094946},
+{"AWA",-3.645358766},
+{"GLE",-3.646120326},
+{"GIO",-3.646176552},
+{"BUR",-3.646207373},
+{"WAN",-3.646530801},
+{"CLI",-3.646572633},
+{"MUL",-3.646746324},
+{"WIS",-3.647720297},
+{"NCY",-3.648730348},
+{"OFT",-3.649500221},
+{"BEG",-3.651384285},
+{"NOU",-3.651574154},
+{"CHR",-3.65185799},
+{"NGU",-3.652338941},
+{"RAR",-3.653486179},
+{"OOR",-3.654694197},
+{"WAL",-3.654900591},
+{"ULE",-3.654958843},
+{"FLO",-3.655487188},
+{"ASH",-3.655965928},
+{"BSE",-3.65617227},
+{"BOD",-3.656978044},
+{"HIT",-3.657357063},
+{"DUA",-3.657437555},
+{"RID",-3.658276832},
+{"LTI",-3.660238387},
+{"IGU",-3.660787792},
+{"TAC",-3.662014629},
+{"NIO",-3.66210812},
+{"RNM",-3.6629876},
+{"TYP",-3.664630916},
+{"AGR",-3.664791948},
+{"ETS",-3.664946663},
+{"CRA",-3.666882215},
+{"COV",-3.66729121},
+{"INN",-3.667496686},
+{"IEL",-3.667571212},
+{"UIL",-3.668044364},
+{"OTA",-3.671129982},
+{"BUS",-3.671234398},
+{"CID",-3.671593763},
+{"MPR",-3.672965581},
+{"UMA",-3.674524008},
+{"IMS",-3.675169783},
+{"APH",-3.678371931},
+{"NON",-3.678985589},
+{"BED",-3.679701657},
+{"NIA",-3.679717968},
+{"DOE",-3.680161721},
+{"NNI",-3.680872676},
+{"ETY",-3.681083579},
+{"NTU",-3.681714737},
+{"HET",-3.68240976},
+{"ASU",-3.682554859},
+{"KET",-3.682765321},
+{"IBU",-3.684013501},
+{"RPO",-3.684718264},
+{"ALA",-3.684734004},
+{"GOD",-3.684950298},
+{"XTE",-3.686177789},
+{"IRI",-3.68622841},
+{"HUR",-3.687132238},
+{"EOR",-3.688230262},
+{"OBS",-3.690044003},
+{"RTU",-3.690331672},
+{"APA",-3.691433915},
+{"NGT",-3.692800337},
+{"OAD",-3.693780035},
+{"CEI",-3.69383059},
+{"CUT",-3.694630024},
+{"RIP",-3.694752983},
+{"PET",-3.694974065},
+{"NIV",-3.696830309},
+{"EVA",-3.697525921},
+{"ARO",-3.697846645},
+{"AUG",-3.69818833},
+{"GUR",-3.69824848},
+{"PHE",-3.69831884},
+{"HRI",-3.698665261},
+{"RAS",-3.700932845},
+{"EGR",-3.701058748},
+{"OLV",-3.701356401},
+{"LUM",-3.701394206},
+{"PME",-3.702041776},
+{"GUE",-3.702049092},
+{"PLY",-3.702280159},
+{"GLA",-3.702597687},
+{"BLA",-3.703171191},
+{"NIF",-3.703912567},
+{"ERL",-3.706575879},
+{"SIA",-3.706814027},
+{"BIN",-3.707187524},
+{"EIT",-3.707648786},
+{"SUA",-3.708885876},
+{"WEN",-3.709380804},
+{"LOY",-3.710084147},
+{"OGE",-3.710210992},
+{"HIE",-3.71229211},
+{"ODY",-3.71340563},
+{"SAR",-3.713600889},
+{"EEK",-3.714045134},
+{"HIR",-3.715439383},
+{"LDE",-3.715971332},
+{"SCU",-3.716626949},
+{"BAL",-3.717010248},
+{"OGY",-3.717217123},
+{"DEE",-3.717530611},
+{"DLE",-3.718323317},
+{"REI",-3.718418306},
+{"UBS",-3.719125308},
+{"FAT",-3.720162711},
+{"GUI",-3.721816765},
+{"HOP",-3.722270578},
+{"ROF",-3.723370804},
+{"BEN",-3.724155683},
+{"NGI",-3.724625985},
+{"EFU",-3.724966761},
+{"IPL",-3.725358162},
+{"ADY",-3.725931987},
+{"WES",-3.726016004},
+{"OPI",-3.726258171},
+{"TOP",-3.72650325},
+{"NFL",-3.7271536},
+{"IEF",-3.727879913},
+{"OPO",-3.730302311},
+{"OTT",-3.731175803},
+{"FUR",-3.732083839},
+{"YPE",-3.732279295},
+{"XCE",-3.73268668},
+{"GUA",-3.733616013},
+{"RRA",-3.734060429},
+{"PHO",-3.735463994},
+{"ADM",-3.735489039},
+{"PHA",-3.736202748},
+{"UFF",-3.73633428},
+{"VEM",-3.736340061},
+{"RIL",-3.736768276},
+{"EDG",-3.737034793},
+{"API",-3.737335038},
+{"LOV",-3.737576106},
+{"ALY",-3.737786577},
+{"DLY",-3.737922694},
+{"EUR",-3.738147645},
+{"LOU",-3.738844559},
+{"EAM",-3.739123527},
+{"ITO",-3.739131774},
+{"ISA",-3.739154941},
+{"EIV",-3.739662482},
+{"WEA",-3.741130278},
+{"XPL",-3.742098303},
+{"KES",-3.742632788},
+{"LIB",-3.742638975},
+{"ETR",-3.743109205},
+{"ALM",-3.743570847},
+{"OLA",-3.744668617},
+{"SCE",-3.744967842},
+{"MMA",-3.745300574},
+{"CHU",-3.745376838},
+{"IMM",-3.746814324},
+{"DMI",-3.747401415},
+{"FLU",-3.747960818},
+{"ISP",-3.748162679},
+{"VIR",-3.748997061},
+{"ALK",-3.749001223},
+{"GGE",-3.749012221},
+{"IFT",-3.74947754},
+{"EGE",-3.749828378},
+{"BLO",-3.750092125},
+{"AIT",-3.752039038},
+{"NEY",-3.752296997},
+{"LDI",-3.752448946},
+{"SUE",-3.752470213},
+{"OWL",-3.754031921},
+{"URP",-3.755441168},
+{"POT",-3.755565866},
+{"ELP",-3.756989393},
+{"BEH",-3.757175105},
+{"URY",-3.757344718},
+{"LTU",-3.758961636},
+{"FLE",-3.759112869},
+{"NAG",-3.759836726},
+{"SWE",-3.760290984},
+{"RVA",-3.760447615},
+{"AVA",-3.760447861},
+{"HON",-3.760924743},
+{"HOD",-3.762040661},
+{"DRI",-3.762088232},
+{"COS",-3.765149279},
+{"HEO",-3.765793482},
+{"OOM",-3.765934194},
+{"IRC",-3.766119785},
+{"EXE",-3.766785311},
+{"UGG",-3.767076334},
+{"CTR",-3.767751185},
+{"NVI",-3.768395011},
+{"XIS",-3.768523379},
+{"POP",-3.768905831},
+{"OPH",-3.769648263},
+{"ODI",-3.769697472},
+{"IDU",-3.770459264},
+{"AYE",-3.770467318},
+{"ELV",-3.771380394},
+{"SUS",-3.771648223},
+{"SIL",-3.771669829},
+{"ODS",-3.772003344},
+{"OON",-3.772630072},
+{"FEA",-3.773754863},
+{"ESO",-3.774042336},
+{"EVO",-3.774267861},
+{"UNE",-3.774985689},
+{"LDR",-3.775415434},
+{"LTE",-3.775457422},
+{"FIT",-3.775517068},
+{"AVO",-3.776483915},
+{"EES",-3.776803123},
+{"ONN",-3.777233564},
+{"UCC",-3.77848492},
+{"HAM",-3.780938398},
+{"TOL",-3.781403787},
+{"DDE",-3.782543461},
+{"AMA",-3.782742508},
+{"BAT",-3.782809651},
+{"FES",-3.78287163},
+{"LWA",-3.786004974},
+{"FEW",-3.786242782},
+{"FEL",-3.786706765},
+{"TTA",-3.787175709},
+{"IRT",-3.787753639},
+{"UCA",-3.788663245},
+{"OOT",-3.788778365},
+{"SEP",-3.789583184},
+{"OPM",-3.790432508},
+{"IUM",-3.791513558},
+{"OWA",-3.792051758},
+{"NIE",-3.79208143},
+{"RUL",-3.792574411},
+{"ECR",-3.793989623},
+{"UIS",-3.794290703},
+{"NEN",-3.794636667},
+{"BUI",-3.795281269},
+{"OBA",-3.796083633},
+{"ERP",-3.797472819},
+{"IOD",-3.797498372},
+{"EFT",-3.79788611},
+{"MAC",-3.798793769},
+{"LOT",-3.798915607},
+{"PAL",-3.799141479},
+{"IOL",-3.799881063},
+{"EER",-3.80028677},
+{"SLY",-3.800814402},
+{"ABS",-3.801475607},
+{"RAV",-3.802097915},
+{"YED",-3.802746926},
+{"CIR",-3.80424341},
+{"OUB",-3.804427367},
+{"GUL",-3.804830674},
+{"UBJ",-3.805215637},
+{"YOR",-3.805442991},
+{"IGA",-3.805522813},
+{"ETU",-3.805879406},
+{"YER",-3.805983703},
+{"CIL",-3.80612145},
+{"DUS",-3.806469728},
+{"LEF",-3.806840592},
+{"EYE",-3.809126683},
+{"DDI",-3.809542999},
+{"SIR",-3.810104469},
+{"USL",-3.810891358},
+{"HUN",-3.811004636},
+{"NUE",-3.811116991},
+{"HTE",-3.811248393},
+{"CIF",-3.811996886},
+{"AGI",-3.813133163},
+{"HYS",-3.813272824},
+{"FOO",-3.813495083},
+{"RLI",-3.813927216},
+{"DOU",-3.814606873},
+{"BST",-3.815140738},
+{"PIE",-3.815646815},
+{"RAW",-3.816460046},
+{"OBJ",-3.817022717},
+{"ISL",-3.817405597},
+{"APS",-3.817565464},
+{"CKS",-3.817635347},
+{"CUM",-3.819258831},
+{"CHN",-3.81986269},
+{"MID",-3.820665431},
+{"IDI",-3.821074145},
+{"TEX",-3.821591501},
+{"TOG",-3.822067799},
+{"FAL",-3.822331186},
+{"OSP",-3.822507972},
+{"BAB",-3.823376433},
+{"YTH",-3.823489817},
+{"JOH",-3.823738815},
+{"EWS",-3.824109583},
+{"GLI",-3.824239296},
+{"GEO",-3.824269259},
+{"NTY",-3.825414359},
+{"ACR",-3.826102317},
+{"TEG",-3.826213929},
+{"IQU",-3.82633294},
+{"GNE",-3.826423766},
+{"NIG",-3.826635819},
+{"RUN",-3.826663957},
+{"RRY",-3.827258914},
+{"URO",-3.830105072},
+{"YES",-3.830123429},
+{"ORP",-3.830452484},
+{"DRO",-3.830879428},
+{"RAY",-3.831430754},
+{"OHN",-3.832696212},
+{"HOT",-3.833892},
+{"YET",-3.835218927},
+{"GAL",-3.835937034},
+{"ADO",-3.836507309},
+{"CIO",-3.837196386},
+{"JUD",-3.838495376},
+{"GOT",-3.838694191},
+{"OBE",-3.839473693},
+{"TUN",-3.839567309},
+{"IPA",-3.839830499},
+{"RKS",-3.839881782},
+{"SEM",-3.840493091},
+{"OMB",-3.841102296},
+{"HTS",-3.841275985},
+{"COP",-3.842701841},
+{"NFE",-3.842832706},
+{"DOC",-3.84398338},
+{"PAP",-3.844194676},
+{"LIO",-3.844266811},
+{"ANU",-3.844323411},
+{"AIM",-3.844928365},
+{"ELT",-3.846400279},
+{"OIL",-3.846848425},
+{"RCU",-3.84716249},
+{"THS",-3.847991721},
+{"EDS",-3.848036073},
+{"OPU",-3.848250922},
+{"FEN",-3.849534047},
+{"IDA",-3.849753093},
+{"NDR",-3.849760713},
+{"IRO",-3.849993282},
+{"AMB",-3.850079194},
+{"TIR",-3.850214973},
+{"IAM",-3.851316129},
+{"AIS",-3.851321351},
+{"ALW",-3.852204542},
+{"NEL",-3.853255666},
+{"URG",-3.853578711},
+{"KNE",-3.853715741},
+{"EGU",-3.853978898},
+{"DAM",-3.853992104},
+{"ATC",-3.854217805},
+{"FLA",-3.8545247},
+{"NIM",-3.85663358},
+{"SKI",-3.856741525},
+{"NEX",-3.85679481},
+{"OYE",-3.857001424},
+{"GEM",-3.857610718},
+{"SEQ",-3.857918116},
+{"ILS",-3.858822282},
+{"VOI",-3.860895885},
+{"NFI",-3.861061017},
+{"RSH",-3.862170468},
+{"REW",-3.864492423},
+{"OTO",-3.865986772},
+{"LLU",-3.866711258},
+{"IRA",-3.866802919},
+{"ATR",-3.867752634},
+{"USA",-3.868333372},
+{"ICL",-3.869700039},
+{"BON",-3.869805414},
+{"USU",-3.87006241},
+{"XPR",-3.870233047},
+{"TOT",-3.871722124},
+{"MAJ",-3.871794715},
+{"IRM",-3.871859733},
+{"INO",-3.872124265},
+{"OLS",-3.87235462},
+{"SUG",-3.872608953},
+{"PES",-3.872633104},
+{"UDY",-3.873979416},
+{"GRI",-3.875855218},
+{"UED",-3.875981537},
+{"HAI",-3.876185818},
+{"RPR",-3.876461607},
+{"IAB",-3.876515676},
+{"LAM",-3.877046125},
+{"SKE",-3.877320192},
+{"NAB",-3.877803471},
+{"MBI",-3.877916277},
+{"ADA",-3.878736567},
+{"WLE",-3.879182548},
+{"GIS",-3.879235378},
+{"GHE",-3.87944278},
+{"IRD",-3.879575917},
+{"LAD",-3.879809159},
+{"SMI",-3.881961007},
+{"SUF",-3.882269295},
+{"LEY",-3.883363894},
+{"RCI",-3.884024871},
+{"KEE",-3.884359525},
+{"LEX",-3.886234399},
+{"GTH",-3.886328627},
+{"MEL",-3.886595546},
+{"AMS",-3.887097278},
+{"RGI",-3.887406113},
+{"LYS",-3.887547607},
+{"SPR",-3.887622912},
+{"BOA",-3.889062861},
+{"UTS",-3.890030845},
+{"LTS",-3.890617456},
+{"ALF",-3.891070295},
+{"PAY",-3.891276509},
+{"OIC",-3.891328011},
+{"UMP",-3.891992385},
+{"RUE",-3.892261502},
+{"TAS",-3.892314789},
+{"IPT",-3.892692723},
+{"ARB",-3.893244503},
+{"LMO",-3.893750855},
+{"NVO",-3.894560868},
+{"YON",-3.895172281},
+{"JOR",-3.895236346},
+{"RFO",-3.89695323},
+{"OPT",-3.899185926},
+{"YME",-3.900591534},
+{"UDG",-3.902347273},
+{"XTR",-3.902657161},
+{"IMU",-3.903171406},
+{"BOV",-3.903398005},
+{"HEE",-3.904330462},
+{"DVA",-3.904459269},
+{"ILT",-3.906717602},
+{"UTT",-3.907014149},
+{"IGE",-3.907308433},
+{"NSP",-3.907354846},
+{"OCU",-3.907767995},
+{"NSO",-3.908185568},
+{"NEG",-3.908312533},
+{"UPE",-3.909869735},
+{"AGO",-3.910373128},
+{"LSE",-3.914841144},
+{"OAC",-3.916683267},
+{"EHA",-3.917285057},
+{"DUL",-3.918110692},
+{"URV",-3.918514187},
+{"RUM",-3.921950689},
+{"KIL",-3.922453178},
+{"UNS",-3.922535668},
+{"OMO",-3.922645965},
+{"TIG",-3.922811737},
+{"SLI",-3.923010238},
+{"AJO",-3.923109151},
+{"WID",-3.923788184},
+{"OCT",-3.923834194},
+{"EPL",-3.923930789},
+{"IPS",-3.92479805},
+{"UNA",-3.925329711},
+{"ECK",-3.925363377},
+{"CTL",-3.926152716},
+{"LID",-3.926341856},
+{"NSH",-3.9264623},
+{"VAI",-3.926528054},
+{"COO",-3.927394554},
+{"SAG",-3.928206262},
+{"COA",-3.928975694},
+{"MBL",-3.929902281},
+{"THY",-3.930669666},
+{"SYM",-3.931794265},
+{"RIF",-3.932219617},
+{"EPI",-3.932603949},
+{"GOI",-3.932628783},
+{"MEE",-3.933097321},
+{"NUA",-3.935646107},
+{"LAU",-3.93645825},
+{"ROR",-3.937867869},
+{"CEE",-3.940047548},
+{"RIZ",-3.940350873},
+{"UID",-3.940642106},
+{"GLY",-3.940704462},
+{"ERH",-3.942129432},
+{"TSE",-3.942961294},
+{"NGR",-3.944610657},
+{"NDL",-3.945226164},
+{"AUL",-3.945358663},
+{"EAU",-3.94569779},
+{"OAR",-3.947826295},
+{"FUS",-3.947848666},
+{"TOU",-3.948161503},
+{"CEM",-3.948177444},
+{"ENN",-3.948229776},
+{"AMM",-3.94902326},
+{"OGN",-3.949074446},
+{"IAR",-3.949298548},
+{"MPU",-3.953499319},
+{"WHY",-3.956433117},
+{"GNA",-3.957141664},
+{"CTA",-3.957328202},
+{"UTU",-3.958458071},
+{"NOV",-3.961495061},
+{"SIX",-3.963918915},
+{"ALR",-3.964062327},
+{"USH",-3.965769466},
+{"IAG",-3.966433384},
+{"WOO",-3.966656124},
+{"COG",-3.966727369},
+{"IBR",-3.967158687},
+{"PAG",-3.968705305},
+{"RFA",-3.969175261},
+{"TEP",-3.969851209},
+{"NSC",-3.970238784},
+{"RHA",-3.970712894},
+{"GON",-3.971142432},
+{"ILO",-3.971634789},
+{"AGN",-3.971661144},
+{"PEE",-3.972096198},
+{"POO",-3.972645473},
+{"ZIN",-3.972764702},
+{"LEE",-3.972773811},
+{"BOL",-3.9728559},
+{"ALC",-3.973083763},
+{"NOL",-3.973445462},
+{"KEL",-3.974525771},
+{"RMO",-3.974620976},
+{"UMM",-3.974688411},
+{"ADS",-3.975077137},
+{"RKI",-3.975691527},
+{"PSY",-3.975855292},
+{"HNI",-3.976100804},
+{"SIZ",-3.977505441},
+{"UCK",-3.977888536},
+{"RNS",-3.978033165},
+{"GLO",-3.978399564},
+{"LAG",-3.979310649},
+{"PPI",-3.97988546},
+{"TTO",-3.980397606},
+{"OID",-3.981272854},
+{"EGO",-3.981325344},
+{"TOC",-3.98134495},
+{"ECL",-3.981877989},
+{"PEL",-3.982599008},
+{"SAC",-3.983762997},
+{"ACY",-3.984200353},
+{"LIP",-3.984375353},
+{"IDD",-3.985269602},
+{"OAT",-3.985409427},
+{"UAG",-3.985604491},
+{"FFO",-3.986068081},
+{"EFL",-3.987024314},
+{"UPS",-3.987224628},
+{"FIV",-3.98810554},
+{"ATS",-3.988524257},
+{"CRU",-3.988910998},
+{"ATM",-3.989395771},
+{"TAX",-3.989438682},
+{"NUT",-3.989554327},
+{"FLI",-3.989973457},
+{"SUN",-3.990476779},
+{"ENV",-3.990831305},
+{"IFY",-3.990900647},
+{"OXI",-3.990948408},
+{"ASP",-3.99281643},
+{"NEI",-3.992977099},
+{"GOR",-3.995101583},
+{"UTO",-3.995641764},
+{"ICY",-3.996046071},
+{"NKI",-3.998384178},
+{"YCH",-3.998750979},
+{"TNE",-3.999672167},
+{"PIL",-4.001058378},
+{"STL",-4.002027372},
+{"IPP",-4.003129543},
+{"JOI",-4.003356793},
+{"JOU",-4.003707321},
+{"IRL",-4.003866179},
+{"FAS",-4.004215936},
+{"OFE",-4.004403867},
+{"SYC",-4.00590077},
+{"SLE",-4.005950986},
+{"POU",-4.006000167},
+{"NSW",-4.007645197},
+{"ONY",-4.007717199},
+{"OKS",-4.008672929},
+{"MOM",-4.009129713},
+{"SLO",-4.009368198},
+{"LOA",-4.009389789},
+{"STY",-4.010051425},
+{"UBT",-4.011862223},
+{"ORO",-4.012252131},
+{"ENU",-4.012493999},
+{"OLY",-4.012620598},
+{"NKS",-4.013484876},
+{"OIS",-4.014536988},
+{"SPL",-4.015403571},
+{"RGU",-4.015579443},
+{"EBR",-4.015636322},
+{"BUL",-4.01606638},
+{"RER",-4.016510283},
+{"DUE",-4.016768455},
+{"RUT",-4.01726924},
+{"OPS",-4.018284066},
+{"ADU",-4.01830146},
+{"NSA",-4.018814161},
+{"APO",-4.019468122},
+{"POE",-4.020038138},
+{"RBA",-4.020332522},
+{"MPH",-4.021735602},
+{"RUG",-4.021961216},
+{"JUN",-4.022340497},
+{"LRE",-4.023110471},
+{"SUI",-4.023420652},
+{"OSO",-4.024209355},
+{"INL",-4.025273488},
+{"UIN",-4.027623523},
+{"FED",-4.028918492},
+{"RSA",-4.029388563},
+{"RLE",-4.029586384},
+{"NSF",-4.029891108},
+{"DEG",-4.030746449},
+{"OBT",-4.031298413},
+{"FIS",-4.031410901},
+{"DIO",-4.031836463},
+{"LDS",-4.032485633},
+{"WRO",-4.033903116},
+{"SQU",-4.036171533},
+{"RFE",-4.036600592},
+{"RWA",-4.036712875},
+{"GEL",-4.036778457},
+{"BTA",-4.038050488},
+{"RTM",-4.039105947},
+{"ERW",-4.039246752},
+{"SOO",-4.039284124},
+{"HME",-4.039798499},
+{"CUP",-4.039847582},
+{"UAN",-4.043230108},
+{"GME",-4.044095513},
+{"HAB",-4.045269891},
+{"URF",-4.04651596},
+{"ITL",-4.047285099},
+{"SOP",-4.04741735},
+{"TUS",-4.049285092},
+{"OOP",-4.050077513},
+{"BIO",-4.050142715},
+{"SEX",-4.051935414},
+{"AYI",-4.051966477},
+{"VOR",-4.05216757},
+{"NGA",-4.052334961},
+{"ROJ",-4.052593166},
+{"CAD",-4.052680334},
+{"ROY",-4.053422362},
+{"NEM",-4.054961225},
+{"AFR",-4.056304898},
+{"NEU",-4.056784088},
+{"LTY",-4.057364727},
+{"WEI",-4.057531295},
+{"IDS",-4.059193566},
+{"OJE",-4.060612699},
+{"ONM",-4.0609241},
+{"DOR",-4.061058327},
+{"DDL",-4.061301358},
+{"EPH",-4.061747514},
+{"WAI",-4.062156512},
+{"RGY",-4.062760839},
+{"OMS",-4.062904645},
+{"ULI",-4.063746448},
+{"CIV",-4.064397537},
+{"MBR",-4.064789261},
+{"URB",-4.065766436},
+{"SAW",-4.066831291},
+{"CCA",-4.068665311},
+{"BIR",-4.070152752},
+{"AUD",-4.070308635},
+{"COT",-4.070520913},
+{"EOU",-4.070685879},
+{"ABE",-4.073263218},
+{"RYI",-4.073828806},
+{"EON",-4.07441409},
+{"XIM",-4.074736799},
+{"UNL",-4.075066961},
+{"HLY",-4.075287925},
+{"IRR",-4.076657834},
+{"ESH",-4.07770016},
+{"OTS",-4.07818944},
+{"SAV",-4.078381596},
+{"DOO",-4.078422351},
+{"LUN",-4.078512609},
+{"FUT",-4.079006431},
+{"PTA",-4.079337807},
+{"NNO",-4.080151738},
+{"EWI",-4.0815805},
+{"OVA",-4.082132234},
+{"EWE",-4.082773631},
+{"VOT",-4.083416808},
+{"XPO",-4.084032787},
+{"WNE",-4.084332272},
+{"EPU",-4.085782039},
+{"ODA",-4.086834926},
+{"ASC",-4.087793309},
+{"BRU",-4.089379161},
+{"RAF",-4.089582451},
+{"NEF",-4.089837589},
+{"MPI",-4.0904937},
+{"OKI",-4.090886323},
+{"UNN",-4.091384232},
+{"PID",-4.0915404},
+{"OCR",-4.091671392},
+{"YMP",-4.092321687},
+{"ERB",-4.09257567},
+{"DOL",-4.092796879},
+{"KEY",-4.093290503},
+{"DEB",-4.094012285},
+{"OBI",-4.09499926},
+{"BOY",-4.095122791},
+{"MOL",-4.095528325},
+{"STM",-4.097943225},
+{"FAV",-4.098590485},
+{"NQU",-4.099412669},
+{"EHI",-4.100996957},
+{"AXI",-4.101151526},
+{"FAN",-4.102319352},
+{"IDG",-4.104910019},
+{"NOS",-4.107248178},
+{"EOL",-4.107383995},
+{"OPR",-4.107946268},
+{"VIA",-4.108295331},
+{"CKI",-4.109402245},
+{"BSO",-4.109748406},
+{"AGG",-4.110367828},
+{"DIM",-4.110560384},
+{"NNA",-4.110873247},
+{"ITC",-4.11137062},
+{"JUR",-4.111487429},
+{"ENL",-4.111818772},
+{"INH",-4.112054185},
+{"MIR",-4.112523038},
+{"UCI",-4.114125549},
+{"TTR",-4.114416167},
+{"REB",-4.114451686},
+{"GNO",-4.116985317},
+{"LTA",-4.11760036},
+{"DIG",-4.117678471},
+{"VOU",-4.117942322},
+{"RUI",-4.119362858},
+{"GOL",-4.119576084},
+{"WTH",-4.119692498},
+{"GAV",-4.120371877},
+{"UTA",-4.120942875},
+{"ISF",-4.120947694},
+{"ISK",-4.121337422},
+{"III",-4.121388987},
+{"UDD",-4.121446263},
+{"LAV",-4.124242068},
+{"LUA",-4.124859192},
+{"CAB",-4.127081283},
+{"VAS",-4.127096834},
+{"NIQ",-4.128522617},
+{"RNO",-4.128864556},
+{"MYS",-4.129580562},
+{"ICO",-4.129696221},
+{"DUT",-4.129784149},
+{"SPH",-4.131185314},
+{"UMS",-4.131199173},
+{"REH",-4.131301275},
+{"OYA",-4.133080224},
+{"OWT",-4.133111966},
+{"BEY",-4.135060526},
+{"CQU",-4.136487926},
+{"XER",-4.136599937},
+{"EDO",-4.136945937},
+{"NAD",-4.137424222},
+{"REO",-4.138343219},
+{"HIB",-4.138949332},
+{"OAL",-4.139025347},
+{"PTU",-4.141130955},
+{"BIG",-4.141291754},
+{"TUM",-4.14183893},
+{"YLE",-4.14193126},
+{"RUP",-4.141976663},
+{"PPA",-4.142868842},
+{"GIR",-4.14303638},
+{"OOS",-4.14346714},
+{"XED",-4.143729559},
+{"GUS",-4.14388594},
+{"ACQ",-4.143967049},
+{"GHL",-4.144012674},
+{"USC",-4.144242179},
+{"ACA",-4.145025719},
+{"WON",-4.145652063},
+{"UIC",-4.145822225},
+{"SYN",-4.14583916},
+{"TIP",-4.145869233},
+{"GAS",-4.147250786},
+{"CEA",-4.14889345},
+{"LUC",-4.149395081},
+{"OMY",-4.150076245},
+{"AGU",-4.151052312},
+{"CKL",-4.151330307},
+{"URD",-4.151873938},
+{"SIE",-4.152498269},
+{"RBI",-4.15340846},
+{"ULY",-4.153523799},
+{"JAM",-4.154321629},
+{"MBO",-4.154778649},
+{"GTO",-4.154797923},
+{"AFE",-4.155090159},
+{"UEL",-4.156676944},
+{"AWS",-4.157386539},
+{"TAM",-4.157636733},
+{"RSU",-4.157753539},
+{"SHM",-4.159258445},
+{"OFI",-4.159840887},
+{"DNE",-4.160036954},
+{"JOY",-4.160576154},
+{"WIF",-4.161560562},
+{"DRU",-4.161968709},
+{"NUS",-4.162145783},
+{"ENR",-4.164432899},
+{"MOO",-4.16516507},
+{"ZEN",-4.165384792},
+{"ETO",-4.165478158},
+{"SME",-4.166705076},
+{"UPT",-4.167865575},
+{"RBO",-4.169048618},
+{"NHA",-4.170652602},
+{"UTY",-4.171402915},
+{"OET",-4.17144218},
+{"RFU",-4.172787995},
+{"PTO",-4.173278015},
+{"NKE",-4.173580342},
+{"JES",-4.173703091},
+{"TOD",-4.173841533},
+{"VIV",-4.174232481},
+{"ACU",-4.176528419},
+{"JAC",-4.178406435},
+{"EHO",-4.178555483},
+{"GAM",-4.178685478},
+{"PLU",-4.179021864},
+{"DAL",-4.179040392},
+{"NJU",-4.179729974},
+{"YAL",-4.18097647},
+{"AIG",-4.181133941},
+{"EAG",-4.182615384},
+{"ULS",-4.183696935},
+{"MEW",-4.18451044},
+{"DIL",-4.184929678},
+{"ROK",-4.185505025},
+{"LUR",-4.185792165},
+{"FIF",-4.185907239},
+{"NLI",-4.185997392},
+{"ASA",-4.186469151},
+{"JAN",-4.186888397},
+{"JOB",-4.186926688},
+{"FEM",-4.18727838},
+{"NEO",-4.18845299},
+{"IEC",-4.189536135},
+{"VEY",-4.190062507},
+{"SAF",-4.191108943},
+{"SWI",-4.192533279},
+{"IXE",-4.192738492},
+{"UGU",-4.193148442},
+{"MEC",-4.193278452},
+{"PTS",-4.194216406},
+{"YSE",-4.194480876},
+{"TSI",-4.195750322},
+{"HEC",-4.195820324},
+{"EEC",-4.195886053},
+{"EUT",-4.196377871},
+{"BID",-4.196654579},
+{"MOC",-4.197116125},
+{"JEW",-4.197396783},
+{"HNO",-4.197563609},
+{"EDL",-4.197763357},
+{"LYI",-4.198432124},
+{"JAP",-4.199191515},
+{"EWA",-4.200167246},
+{"PAU",-4.20116267},
+{"NAC",-4.201863736},
+{"MBA",-4.202448173},
+{"IFO",-4.202621838},
+{"ABA",-4.203407344},
+{"NAS",-4.203419498},
+{"ORW",-4.203577755},
+{"ADJ",-4.20370839},
+{"GAG",-4.204012371},
+{"UPI",-4.204199204},
+{"BAD",-4.206426269},
+{"TYL",-4.207709798},
+{"XEC",-4.208267692},
+{"COD",-4.208963255},
+{"NFA",-4.209290057},
+{"HYP",-4.209367293},
+{"ITR",-4.209963259},
+{"NYT",-4.210576527},
+{"TIZ",-4.21086239},
+{"EWH",-4.210951026},
+{"ZON",-4.21176574},
+{"UOU",-4.213823469},
+{"OUC",-4.21399592},
+{"RMY",-4.214208799},
+{"ALD",-4.214338207},
+{"JUL",-4.214734142},
+{"INJ",-4.215644325},
+{"IXT",-4.215726459},
+{"SMO",-4.216259684},
+{"BLU",-4.216849088},
+{"IUS",-4.217570765},
+{"SOF",-4.217588375},
+{"ASY",-4.217676388},
+{"MST",-4.218153309},
+{"ARV",-4.218283966},
+{"DDR",-4.218759468},
+{"EYO",-4.219298329},
+{"FIX",-4.220170498},
+{"AZI",-4.220685542},
+{"GHO",-4.221420392},
+{"NLE",-4.221764862},
+{"MUR",-4.221906889},
+{"EHE",-4.222014017},
+{"MUM",-4.222227954},
+{"IMO",-4.222712442},
+{"MAX",-4.224606745},
+{"UMI",-4.224890088},
+{"DVE",-4.225327299},
+{"OCH",-4.228670325},
+{"ERD",-4.228808104},
+{"XIC",-4.229077274},
+{"DAV",-4.230988676},
+{"AWN",-4.231682505},
+{"ARP",-4.231890321},
+{"QUO",-4.232976628},
+{"RDA",-4.234318506},
+{"IAS",-4.236906771},
+{"BIA",-4.237158937},
+{"IGR",-4.237517265},
+{"HOI",-4.238174018},
+{"GIT",-4.238524904},
+{"TAY",-4.238529568},
+{"SOV",-4.239001306},
+{"UTR",-4.239027592},
+{"OSA",-4.239079536},
+{"RTO",-4.239343645},
+{"DAI",-4.239913335},
+{"ORB",-4.24008963},
+{"EAP",-4.241657682},
+{"DOP",-4.242049414},
+{"TEI",-4.242051665},
+{"RPE",-4.243679269},
+{"OUD",-4.244547355},
+{"UNK",-4.244636421},
+{"ABU",-4.244885841},
+{"DOI",-4.245573498},
+{"GIE",-4.24627462},
+{"BIS",-4.246453521},
+{"SFU",-4.246692224},
+{"WAV",-4.247129811},
+{"TOB",-4.247709568},
+{"FID",-4.250217659},
+{"TWI",-4.250519955},
+{"AEL",-4.250775632},
+{"ROX",-4.251587791},
+{"DIU",-4.252207818},
+{"TIB",-4.25527994},
+{"ABR",-4.256690907},
+{"ILM",-4.258453905},
+{"EXH",-4.258679417},
+{"HYD",-4.259220428},
+{"LCU",-4.259539917},
+{"SNE",-4.26028154},
+{"GUM",-4.261262098},
+{"GUN",-4.261269755},
+{"MIX",-4.262155341},
+{"UNF",-4.262414649},
+{"HIA",-4.262929531},
+{"ETC",-4.264420548},
+{"KLY",-4.26492327},
+{"EXU",-4.265696334},
+{"IZI",-4.266138659},
+{"TEV",-4.26661684},
+{"USP",-4.266896211},
+{"NNU",-4.267181143},
+{"SAD",-4.267210186},
+{"FOC",-4.267672876},
+{"RLA",-4.26792495},
+{"RTL",-4.268260331},
+{"FFA",-4.268377105},
+{"KEP",-4.268909451},
+{"UBE",-4.270197136},
+{"NFU",-4.270577616},
+{"OAS",-4.270586659},
+{"XCL",-4.270927926},
+{"RYT",-4.272851003},
+{"TAP",-4.273884503},
+{"EPS",-4.274027844},
+{"XPA",-4.274374693},
+{"PIS",-4.277281929},
+{"ENJ",-4.277876998},
+{"EKS",-4.281523113},
+{"LOB",-4.281898554},
+{"OPY",-4.282066274},
+{"NUR",-4.282588348},
+{"HIO",-4.282794849},
+{"PUN",-4.283464619},
+{"OYM",-4.284930526},
+{"LVI",-4.285529692},
+{"WAG",-4.287959212},
+{"ILU",-4.288499354},
+{"MUT",-4.288882705},
+{"SSF",-4.289102976},
+{"LPH",-4.289525337},
+{"VOC",-4.289722931},
+{"NSL",-4.290108716},
+{"UTL",-4.291342704},
+{"DVI",-4.291893782},
+{"UER",-4.292846866},
+{"SCL",-4.293373783},
+{"REJ",-4.29426967},
+{"IPE",-4.294527984},
+{"SFE",-4.295314695},
+{"NOB",-4.296273257},
+{"LCO",-4.296427611},
+{"IMB",-4.297060751},
+{"TUB",-4.297466227},
+{"AUN",-4.297930298},
+{"UPL",-4.298121486},
+{"CKN",-4.298388583},
+{"CRY",-4.29857959},
+{"NAV",-4.29883146},
+{"FET",-4.298960134},
+{"YDR",-4.298968428},
+{"APR",-4.299128042},
+{"EBE",-4.299280623},
+{"UTC",-4.299785575},
+{"TUE",-4.300529483},
+{"YCL",-4.300592853},
+{"ABB",-4.301387377},
+{"ATL",-4.302536091},
+{"FLY",-4.303155944},
+{"BUN",-4.303484284},
+{"NUF",-4.303681811},
+{"CYC",-4.304342818},
+{"BOX",-4.305243975},
+{"EGY",-4.306034481},
+{"AVY",-4.306390835},
+{"XCH",-4.307855528},
+{"PUS",-4.308039954},
+{"IFU",-4.308044637},
+{"OYS",-4.308729827},
+{"MPS",-4.309977163},
+{"UFA",-4.310417395},
+{"OSC",-4.310784283},
+{"XES",-4.311508914},
+{"SUD",-4.313385271},
+{"RIU",-4.314136824},
+{"OLT",-4.314825829},
+{"EMY",-4.315098078},
+{"UGE",-4.31672096},
+{"ICR",-4.316861134},
+{"LAP",-4.317304332},
+{"ISR",-4.318444798},
+{"GGL",-4.318992574},
+{"DWA",-4.321295165},
+{"ALV",-4.321310898},
+{"GOA",-4.321510619},
+{"XAC",-4.322893879},
+{"NJO",-4.323701742},
+{"SAB",-4.323862701},
+{"BUD",-4.323909731},
+{"RWI",-4.323949574},
+{"LKE",-4.324181872},
+{"RDL",-4.325839117},
+{"LTO",-4.326563662},
+{"OAN",-4.326705859},
+{"IOT",-4.326933647},
+{"LAK",-4.328230081},
+{"EBA",-4.328957963},
+{"NVA",-4.329793991},
+{"SOI",-4.329809782},
+{"PSE",-4.330668342},
+{"UPR",-4.330789186},
+{"SEF",-4.330934442},
+{"SAP",-4.331115359},
+{"UMN",-4.331320165},
+{"RMU",-4.331573259},
+{"POK",-4.331655101},
+{"TAF",-4.332188026},
+{"TLA",-4.332485371},
+{"ROI",-4.333392757},
+{"OPA",-4.333808461},
+{"YNA",-4.334820722},
+{"XUA",-4.335964394},
+{"EUM",-4.335972861},
+{"GIA",-4.336271935},
+{"RCO",-4.337319195},
+{"BBE",-4.338216078},
+{"LOM",-4.339235128},
+{"SBA",-4.339244816},
+{"LNE",-4.339644501},
+{"NUC",-4.340180104},
+{"ERU",-4.340411106},
+{"UCL",-4.340575129},
+{"RBE",-4.340648458},
+{"BOS",-4.342883656},
+{"ACO",-4.343115973},
+{"OOF",-4.343272771},
+{"WIC",-4.343355169},
+{"YPI",-4.343774023},
+{"RGO",-4.344254643},
+{"FRU",-4.34482023},
+{"DAU",-4.345594103},
+{"AYM",-4.346427493},
+{"UMO",-4.347518116},
+{"OBV",-4.347632629},
+{"ZER",-4.349302797},
+{"NOC",-4.350385076},
+{"SFO",-4.351442198},
+{"SIF",-4.351704861},
+{"BVI",-4.352422628},
+{"LKI",-4.352486791},
+{"MIE",-4.353468958},
+{"HBO",-4.353867239},
+{"ASM",-4.355190237},
+{"TLI",-4.355588025},
+{"RIK",-4.3558308},
+{"VEA",-4.356209154},
+{"HTL",-4.357414884},
+{"RUD",-4.35826415},
+{"AUR",-4.358914172},
+{"IDL",-4.358986079},
+{"ODO",-4.359498625},
+{"NAP",-4.360196712},
+{"GHB",-4.360868307},
+{"NRY",-4.362003065},
+{"NOI",-4.362925222},
+{"NUI",-4.363720332},
+{"BOW",-4.363892031},
+{"SHR",-4.364407505},
+{"LEL",-4.364529722},
+{"TWA",-4.365530966},
+{"CHM",-4.366096818},
+{"LEO",-4.367549784},
+{"KLE",-4.368746785},
+{"LEI",-4.369020085},
+{"REY",-4.36988829},
+{"ISU",-4.370123289},
+{"HRA",-4.370418327},
+{"PAB",-4.371019656},
+{"HAU",-4.371611558},
+{"CAV",-4.371824271},
+{"USB",-4.373380518},
+{"PHR",-4.373973836},
+{"DRY",-4.374130915},
+{"DGM",-4.374286733},
+{"WNS",-4.376816447},
+{"DJU",-4.378986853},
+{"GNS",-4.379319779},
+{"SSM",-4.38056476},
+{"OWD",-4.381438757},
+{"YPO",-4.383074627},
+{"OCO",-4.383253073},
+{"DOG",-4.383523299},
+{"UOT",-4.383690636},
+{"COH",-4.384425607},
+{"TTY",-4.384753854},
+{"LUB",-4.385721325},
+{"BIB",-4.386932139},
+{"ODD",-4.387516716},
+{"LIQ",-4.388226467},
+{"ULF",-4.388887856},
+{"IOG",-4.38892857},
+{"YMB",-4.389554787},
+{"UGA",-4.391053879},
+{"UIP",-4.393987928},
+{"TAU",-4.393996897},
+{"YRI",-4.396301296},
+{"YEE",-4.396374405},
+{"RTN",-4.396578034},
+{"SWA",-4.398116584},
+{"NCA",-4.399227067},
+{"BUY",-4.400115519},
+{"ADL",-4.401185609},
+{"RTR",-4.401288413},
+{"ILK",-4.40129576},
+{"MEO",-4.403517225},
+{"HID",-4.40446478},
+{"VII",-4.408627583},
+{"ISD",-4.409587537},
+{"RAH",-4.409760898},
+{"SKS",-4.410048185},
+{"VAG",-4.410293941},
+{"DYN",-4.411007762},
+{"HAE",-4.411013543},
+{"GOE",-4.411359906},
+{"YAN",-4.411698492},
+{"UEE",-4.412121916},
+{"NAI",-4.412873166},
+{"JOS",-4.412940215},
+{"EYS",-4.414541263},
+{"CCI",-4.415994325},
+{"RYO",-4.416575416},
+{"GAZ",-4.41696103},
+{"MAP",-4.417459518},
+{"PPY",-4.418525089},
+{"ALB",-4.41873189},
+{"OMF",-4.418832168},
+{"COI",-4.419772567},
+{"WLY",-4.420283735},
+{"MFO",-4.42046662},
+{"EDA",-4.420695211},
+{"XCI",-4.420927404},
+{"THW",-4.420945338},
+{"EGG",-4.421594988},
+{"DEX",-4.421697487},
+{"FAU",-4.421701083},
+{"THL",-4.421994883},
+{"AZE",-4.423270593},
+{"RCL",-4.424050918},
+{"MOB",-4.424491164},
+{"RAE",-4.424735385},
+{"VAC",-4.424976974},
+{"RUB",-4.425066133},
+{"IPI",-4.425398683},
+{"LEP",-4.426818736},
+{"YEL",-4.427233961},
+{"ACL",-4.428745918},
+{"SFA",-4.431269564},
+{"DEO",-4.431695764},
+{"ITN",-4.434609248},
+{"LME",-4.434634277},
+{"IPM",-4.434879775},
+{"NFR",-4.435675706},
+{"UTP",-4.435764955},
+{"RLO",-4.43581909},
+{"MEX",-4.43587933},
+{"RAU",-4.436332121},
+{"TFU",-4.436793432},
+{"INQ",-4.437544534},
+{"EIS",-4.437990213},
+{"EAB",-4.438079951},
+{"OSU",-4.438426772},
+{"YAR",-4.438747329},
+{"DEQ",-4.440013699},
+{"ZES",-4.440367501},
+{"THM",-4.440420563},
+{"SAS",-4.441021622},
+{"DOS",-4.441524466},
+{"LVA",-4.443666938},
+{"RHO",-4.445197586},
+{"TMO",-4.445819674},
+{"UIE",-4.446634741},
+{"SPU",-4.446959261},
+{"MIA",-4.446990875},
+{"HOC",-4.447841128},
+{"UPA",-4.448955403},
+{"EBT",-4.449254341},
+{"EAF",-4.449492135},
+{"NSM",-4.449608557},
+{"SEI",-4.44993694},
+{"UKE",-4.451147482},
+{"COC",-4.451557358},
+{"USN",-4.45156857},
+{"HIF",-4.451788584},
+{"NHE",-4.451846745},
+{"ULO",-4.453456271},
+{"NNY",-4.453544992},
+{"DAP",-4.45360123},
+{"STH",-4.454714124},
+{"GIL",-4.454875615},
+{"AXE",-4.455148414},
+{"RRU",-4.456301668},
+{"OUI",-4.456971705},
+{"NDM",-4.456983929},
+{"ADR",-4.457017877},
+{"FYI",-4.457647172},
+{"RUA",-4.457689253},
+{"AUC",-4.458353407},
+{"KIS",-4.458461319},
+{"NOD",-4.458543929},
+{"EDY",-4.459196356},
+{"JER",-4.459649326},
+{"UBM",-4.461568058},
+{"SEW",-4.462194206},
+{"IVO",-4.463036799},
+{"YIE",-4.463648333},
+{"LEB",-4.463710657},
+{"TOS",-4.464285441},
+{"EWO",-4.46513559},
+{"OGU",-4.465169281},
+{"WEB",-4.466352804},
+{"EDD",-4.466562832},
+{"HLE",-4.466928326},
+{"HWA",-4.467044506},
+{"IZO",-4.467557493},
+{"ULU",-4.467997078},
+{"SEU",-4.46896425},
+{"SMS",-4.469158595},
+{"HAK",-4.46919863},
+{"AMU",-4.469273513},
+{"COW",-4.47129661},
+{"GGR",-4.471329777},
+{"TID",-4.471836989},
+{"UBB",-4.471947869},
+{"HOE",-4.472316389},
+{"IGG",-4.473884189},
+{"ENH",-4.474360327},
+{"HUG",-4.474464588},
+{"OEM",-4.474723675},
+{"FEB",-4.47622086},
+{"RLS",-4.476224739},
+{"RDO",-4.476246621},
+{"EJE",-4.477056398},
+{"XHI",-4.477140281},
+{"IGO",-4.477245194},
+{"RYS",-4.477308798},
+{"DLI",-4.477830112},
+{"IOS",-4.478622884},
+{"NRE",-4.47874802},
+{"IRG",-4.479964153},
+{"XTU",-4.48039969},
+{"AWI",-4.480940127},
+{"NIU",-4.481183055},
+{"GOS",-4.481623338},
+{"TPU",-4.48251187},
+{"ALP",-4.483700857},
+{"RSP",-4.484622495},
+{"ALG",-4.485016123},
+{"CHL",-4.48579146},
+{"RPL",-4.485924204},
+{"IDO",-4.486866791},
+{"UNR",-4.487124673},
+{"NLA",-4.487515941},
+{"LYM",-4.487605527},
+{"CAG",-4.487894416},
+{"FIB",-4.487922477},
+{"CET",-4.489033758},
+{"FFS",-4.490150852},
+{"HTI",-4.490691408},
+{"SWO",-4.491530466},
+{"YPT",-4.491832063},
+{"SKY",-4.492038031},
+{"UNP",-4.492060801},
+{"NGD",-4.492809238},
+{"OBB",-4.4935303},
+{"ULP",-4.493751282},
+{"BAY",-4.49430284},
+{"ESA",-4.494693254},
+{"OGA",-4.495189084},
+{"GDO",-4.49519102},
+{"AHA",-4.498282132},
+{"LOI",-4.498655624},
+{"URK",-4.499374225},
+{"SAU",-4.499496829},
+{"SHU",-4.5002412},
+{"FTS",-4.500248221},
+{"DSO",-4.500334256},
+{"SRA",-4.500962156},
+{"HUT",-4.501200599},
+{"EMN",-4.502313443},
+{"LFI",-4.503401246},
+{"KAN",-4.503900804},
+{"VIG",-4.504062748},
+{"LEU",-4.504108512},
+{"CUI",-4.504391078},
+{"NPU",-4.5046845},
+{"GEA",-4.504868191},
+{"ENZ",-4.505542083},
+{"GIM",-4.506334522},
+{"LUI",-4.507159517},
+{"YNT",-4.507514478},
+{"GHA",-4.510176433},
+{"ZAR",-4.511001535},
+{"EDW",-4.512147149},
+{"NCU",-4.512458949},
+{"RHE",-4.513364721},
+{"XID",-4.513963765},
+{"KAB",-4.516543214},
+{"ERK",-4.517105862},
+{"ANX",-4.518083735},
+{"OHI",-4.521501658},
+{"APY",-4.521592283},
+{"WRE",-4.521811363},
+{"UAD",-4.522471188},
+{"BSC",-4.522657553},
+{"WIR",-4.522940252},
+{"DSH",-4.523002411},
+{"NYO",-4.523193596},
+{"ABY",-4.523937016},
+{"LBE",-4.525388981},
+{"NWA",-4.525526388},
+{"AKS",-4.527181202},
+{"NTM",-4.52839806},
+{"EIL",-4.528441542},
+{"EFA",-4.528988933},
+{"NXI",-4.530489841},
+{"COE",-4.530534319},
+{"OIT",-4.530854948},
+{"EEI",-4.530880544},
+{"OXY",-4.531078372},
+{"OIR",-4.531529133},
+{"RKA",-4.532186086},
+{"GIF",-4.532400682},
+{"NUO",-4.532621748},
+{"LOD",-4.532903448},
+{"HMA",-4.533832463},
+{"POC",-4.534317183},
+{"DIP",-4.53464395},
+{"NOP",-4.534894555},
+{"EOV",-4.535073968},
+{"DWI",-4.535398678},
+{"LFA",-4.535896781},
+{"RPH",-4.536402909},
+{"YTE",-4.537670747},
+{"HAG",-4.538523205},
+{"ILV",-4.538699193},
+{"RAZ",-4.540666899},
+{"PIO",-4.541435611},
+{"SOD",-4.541586799},
+{"INY",-4.54214795},
+{"IEU",-4.542602361},
+{"EGL",-4.543562684},
+{"PIA",-4.543820728},
+{"GIB",-4.543971068},
+{"LEW",-4.543987909},
+{"HAW",-4.544801872},
+{"EDR",-4.546486299},
+{"EBY",-4.546861626},
+{"GYP",-4.549425101},
+{"HEW",-4.549522788},
+{"FTY",-4.549594044},
+{"DST",-4.549672503},
+{"AGM",-4.549783253},
+{"AYA",-4.549970172},
+{"SYL",-4.550445918},
+{"UDA",-4.550753682},
+{"SEG",-4.551754467},
+{"NDY",-4.551824453},
+{"NOO",-4.552623155},
+{"SEH",-4.553037571},
+{"KID",-4.553741722},
+{"MOI",-4.556283807},
+{"VON",-4.557023525},
+{"THD",-4.558633144},
+{"BBI",-4.558805415},
+{"UIV",-4.559266754},
+{"ELM",-4.559574746},
+{"YLO",-4.56024084},
+{"PRU",-4.561243539},
+{"NGO",-4.562622982},
+{"ENF",-4.563515721},
+{"DAS",-4.563552954},
+{"OLK",-4.563711437},
+{"INP",-4.564552334},
+{"TMA",-4.565247988},
+{"SNA",-4.56794995},
+{"WSP",-4.569648788},
+{"HNS",-4.570284873},
+{"CUB",-4.57240358},
+{"BIC",-4.574463018},
+{"EFR",-4.575380122},
+{"BMI",-4.575495492},
+{"XIO",-4.576594886},
+{"ROE",-4.576683994},
+{"ELU",-4.577056632},
+{"UMU",-4.577274728},
+{"BAG",-4.577382287},
+{"GGI",-4.577414547},
+{"MIZ",-4.57846617},
+{"ATY",-4.57930541},
+{"LYT",-4.579584802},
+{"PYR",-4.579720248},
+{"BSI",-4.580580546},
+{"RUR",-4.581599603},
+{"WAK",-4.582315234},
+{"JON",-4.58444409},
+{"IRY",-4.585541803},
+{"PUP",-4.587071382},
+{"LSI",-4.587169578},
+{"AZA",-4.587712975},
+{"REU",-4.587870629},
+{"KNI",-4.588377469},
+{"SNO",-4.589849732},
+{"CKG",-4.590005997},
+{"KGR",-4.590692941},
+{"KAR",-4.591197362},
+{"DME",-4.591349944},
+{"NGH",-4.591431055},
+{"EUS",-4.591903203},
+{"NKL",-4.592684361},
+{"XIN",-4.592698152},
+{"PTH",-4.593540639},
+{"TCO",-4.593640358},
+{"RVO",-4.594381998},
+{"HIV",-4.594727978},
+{"UBI",-4.597466451},
+{"VET",-4.598431033},
+{"OHO",-4.599814724},
+{"LPE",-4.600635434},
+{"PIP",-4.600994809},
+{"KIT",-4.601972674},
+{"TFO",-4.602766433},
+{"EOG",-4.60282526},
+{"HFU",-4.603732424},
+{"UAB",-4.603749222},
+{"CKY",-4.60385493},
+{"BOM",-4.604546729},
+{"TOI",-4.605002101},
+{"CHY",-4.605066126},
+{"VEG",-4.606200832},
+{"MBU",-4.606535421},
+{"GST",-4.607593616},
+{"FTH",-4.608238355},
+{"XFO",-4.608668309},
+{"EFS",-4.610144776},
+{"CYT",-4.613175216},
+{"OTL",-4.614247444},
+{"YBE",-4.615991413},
+{"SFI",-4.617982261},
+{"OXF",-4.618193882},
+{"SBU",-4.618796854},
+{"JEA",-4.619711866},
+{"THN",-4.619788998},
+{"MOK",-4.620771476},
+{"ONU",-4.620832352},
+{"UGS",-4.620902265},
+{"TIQ",-4.62092345},
+{"YLI",-4.621380117},
+{"YMO",-4.621405853},
+{"CKA",-4.622581033},
+{"GMA",-4.622821674},
+{"RCA",-4.622843292},
+{"KAG",-4.626726353},
+{"VEI",-4.626991014},
+{"ULG",-4.627158611},
+{"IKI",-4.628415346},
+{"ENY",-4.629010002},
+{"BUC",-4.630093437},
+{"LMS",-4.631024188},
+{"LAX",-4.632853973},
+{"THF",-4.633808908},
+{"XAN",-4.634234412},
+{"LST",-4.634437271},
+{"DOT",-4.636403081},
+{"AYB",-4.636403179},
+{"UNW",-4.636465517},
+{"VUL",-4.636988665},
+{"TTS",-4.637059675},
+{"HRU",-4.637286881},
+{"ULN",-4.638994642},
+{"MAM",-4.639368315},
+{"LUX",-4.640665515},
+{"UBA",-4.64267414},
+{"CIM",-4.642825446},
+{"NIP",-4.643443767},
+{"BTE",-4.644279233},
+{"ITM",-4.64507069},
+{"EKI",-4.645072948},
+{"MNE",-4.64537418},
+{"YTI",-4.646362624},
+{"LTR",-4.647060772},
+{"SEY",-4.647065859},
+{"ONQ",-4.647129112},
+{"HDR",-4.648128468},
+{"AYO",-4.64830822},
+{"HLO",-4.648378839},
+{"ITZ",-4.649566153},
+{"NKN",-4.650969469},
+{"MLY",-4.651044378},
+{"OZE",-4.652088022},
+{"NIL",-4.652375986},
+{"ODG",-4.652724018},
+{"DWE",-4.653539456},
+{"KLI",-4.654076249},
+{"EBO",-4.654340944},
+{"DYI",-4.65543496},
+{"TEO",-4.655752697},
+{"SSL",-4.656153935},
+{"YWH",-4.656167026},
+{"XAT",-4.656797532},
+{"ORU",-4.656957448},
+{"KAT",-4.657269889},
+{"OLF",-4.657383603},
+{"DUN",-4.658321137},
+{"COB",-4.658472319},
+{"VEH",-4.659225413},
+{"ZAB",-4.66049272},
+{"FAB",-4.66211505},
+{"PHS",-4.663138869},
+{"YBO",-4.663985337},
+{"LGA",-4.664712067},
+{"OCL",-4.665751488},
+{"DUM",-4.667268951},
+{"FFL",-4.668558845},
+{"ELC",-4.668575327},
+{"CEF",-4.668634659},
+{"YNE",-4.669324961},
+{"ILW",-4.670407792},
+{"UDS",-4.670991855},
+{"AOR",-4.671160541},
+{"EPP",-4.671537643},
+{"UVE",-4.672059312},
+{"TYR",-4.672821489},
+{"AQU",-4.67312307},
+{"PIG",-4.673313756},
+{"LYN",-4.674661839},
+{"WDE",-4.674688233},
+{"GAP",-4.675874371},
+{"TOX",-4.677087277},
+{"LGE",-4.677751523},
+{"AHE",-4.680062343},
+{"DUK",-4.680353081},
+{"AYL",-4.680803312},
+{"DAB",-4.681047719},
+{"CHT",-4.681229717},
+{"AES",-4.68142674},
+{"ADH",-4.681476213},
+{"BOI",-4.681947204},
+{"ARF",-4.682220168},
+{"XIT",-4.683422013},
+{"OHE",-4.685071312},
+{"MOG",-4.685240444},
+{"TUC",-4.685500426},
+{"OBO",-4.68589888},
+{"UNU",-4.68602179},
+{"EIZ",-4.686143851},
+{"NAU",-4.687665402},
+{"TUL",-4.687965788},
+{"IPH",-4.690921031},
+{"RAO",-4.691943105},
+{"EGN",-4.692116178},
+{"IGM",-4.692691238},
+{"SAK",-4.693461396},
+{"OFO",-4.694219655},
+{"UNO",-4.694220167},
+{"IOC",-4.694470852},
+{"VAD",-4.694530696},
+{"AXA",-4.695127634},
+{"RPT",-4.695830372},
+{"MYT",-4.696082102},
+{"HTY",-4.696336878},
+{"FUG",-4.696622561},
+{"LLN",-4.696891931},
+{"OGS",-4.697134805},
+{"VOK",-4.697919912},
+{"EGM",-4.698410287},
+{"DTH",-4.699254185},
+{"XEM",-4.699527317},
+{"KOR",-4.699886228},
+{"LRO",-4.702068329},
+{"SIP",-4.702114821},
+{"AJE",-4.70281063},
+{"LYZ",-4.703052691},
+{"FTI",-4.703170992},
+{"COF",-4.70319462},
+{"WOL",-4.70333024},
+{"NOG",-4.704464782},
+{"WYE",-4.704630576},
+{"LMA",-4.704643704},
+{"EUD",-4.704818043},
+{"XON",-4.7056346},
+{"SDA",-4.705908032},
+{"UAI",-4.706813184},
+{"LDO",-4.70685555},
+{"DIX",-4.707022091},
+{"APL",-4.707206279},
+{"IPU",-4.707648645},
+{"FUE",-4.707870505},
+{"YLA",-4.708153001},
+{"XIE",-4.708231539},
+{"LKS",-4.709284246},
+{"POV",-4.709443208},
+{"SSR",-4.709591972},
+{"ONJ",-4.709901136},
+{"ECC",-4.710313397},
+{"URL",-4.711624337},
+{"HNE",-4.711753235},
+{"HWE",-4.714181791},
+{"NHI",-4.715415359},
+{"RML",-4.715816063},
+{"IDN",-4.716037334},
+{"NRI",-4.718294787},
+{"FOS",-4.718704559},
+{"XII",-4.719261096},
+{"SIU",-4.719702002},
+{"DMA",-4.721073116},
+{"EDN",-4.72109335},
+{"GOU",-4.721522701},
+{"CAC",-4.721581932},
+{"LMI",-4.722692596},
+{"XVI",-4.723422951},
+{"TEW",-4.723542531},
+{"CCL",-4.723835434},
+{"HTF",-4.724835342},
+{"HYL",-4.72550453},
+{"AWY",-4.725935657},
+{"DHE",-4.727160959},
+{"HAY",-4.727646767},
+{"INM",-4.727983467},
+{"XHA",-4.732055373},
+{"NAK",-4.732081978},
+{"NBE",-4.732271288},
+{"ETL",-4.733087608},
+{"FON",-4.733101469},
+{"XTS",-4.73425214},
+{"CKW",-4.734323315},
+{"DOX",-4.734541338},
+{"URM",-4.734951547},
+{"KWA",-4.735838334},
+{"TOE",-4.735840261},
+{"EMM",-4.736536669},
+{"EEZ",-4.737054584},
+{"OAK",-4.737131667},
+{"BIE",-4.737890176},
+{"DAD",-4.738055399},
+{"ROH",-4.738942336},
+{"DNA",-4.739275975},
+{"IBA",-4.739527086},
+{"IBB",-4.739859014},
+{"FFU",-4.740159254},
+{"ISG",-4.740746843},
+{"VEC",-4.740942134},
+{"NJE",-4.741093994},
+{"XTI",-4.741120839},
+{"IRU",-4.741968561},
+{"HAZ",-4.742100171},
+{"LIU",-4.742247886},
+{"YTO",-4.742373004},
+{"YGE",-4.742377385},
+{"LAZ",-4.743116384},
+{"KON",-4.743255402},
+{"BBL",-4.743667057},
+{"LPI",-4.744534723},
+{"PTY",-4.744772516},
+{"DVO",-4.745107938},
+{"XAS",-4.745838425},
+{"NYW",-4.746723035},
+{"VAB",-4.746860162},
+{"YRO",-4.7472827},
+{"IEG",-4.747525996},
+{"LUL",-4.747578417},
+{"SOT",-4.748324982},
+{"GLU",-4.748515974},
+{"SDO",-4.748644641},
+{"ONK",-4.749653353},
+{"EGS",-4.749721329},
+{"WET",-4.751910021},
+{"EBU",-4.753975075},
+{"YND",-4.755199974},
+{"BAK",-4.755301861},
+{"FTW",-4.755613267},
+{"AKA",-4.755886077},
+{"TOK",-4.757415444},
+{"ONW",-4.758165321},
+{"NMA",-4.759629957},
+{"SDI",-4.7606205},
+{"YRA",-4.761395139},
+{"XYG",-4.761833595},
+{"DIB",-4.762672371},
+{"UCO",-4.763949584},
+{"NYM",-4.765341802},
+{"EOF",-4.765671114},
+{"VOY",-4.766148424},
+{"DIZ",-4.766249264},
+{"TEF",-4.766709308},
+{"NUL",-4.766747135},
+{"OTR",-4.766896446},
+{"RHY",-4.767365039},
+{"ILR",-4.76841797},
+{"GAU",-4.76911476},
+{"ABD",-4.769308657},
+{"AWF",-4.770042667},
+{"UNB",-4.770224601},
+{"YLV",-4.770905854},
+{"EZE",-4.771008684},
+{"LDL",-4.772872254},
+{"ESM",-4.773603332},
+{"HTH",-4.774146515},
+{"KHA",-4.774723215},
+{"TUI",-4.774824648},
+{"BUF",-4.775519285},
+{"OEF",-4.775559567},
+{"BTL",-4.775762626},
+{"OTY",-4.776294036},
+{"DHO",-4.776817567},
+{"PAD",-4.777127908},
+{"RPS",-4.778194025},
+{"IDT",-4.77929651},
+{"GNM",-4.779503292},
+{"MBS",-4.780163358},
+{"DHI",-4.780858695},
+{"GRY",-4.781590109},
+{"ZEA",-4.781770284},
+{"ISB",-4.781846008},
+{"KEW",-4.781877135},
+{"BAP",-4.782517424},
+{"AUM",-4.783636588},
+{"KIR",-4.783684662},
+{"KSO",-4.784128655},
+{"JUM",-4.784857542},
+{"PSI",-4.78564834},
+{"MNI",-4.786597173},
+{"HEP",-4.787270007},
+{"HOG",-4.787503387},
+{"XIL",-4.787645651},
+{"KSH",-4.789172631},
+{"TUF",-4.789513297},
+{"MAZ",-4.791693118},
+{"YNO",-4.792921071},
+{"HYT",-4.793885044},
+{"OLM",-4.794076049},
+{"LBO",-4.797426716},
+{"EID",-4.79746307},
+{"KIE",-4.797551697},
+{"USY",-4.797665347},
+{"UGL",-4.798282838},
+{"YZE",-4.798356968},
+{"TNA",-4.798416316},
+{"VAP",-4.800903019},
+{"WRA",-4.803760897},
+{"RPA",-4.803908087},
+{"LGI",-4.806161217},
+{"OSM",-4.8064188},
+{"MAH",-4.807470647},
+{"GUY",-4.808610086},
+{"HAF",-4.80861283},
+{"PSO",-4.809983337},
+{"OYI",-4.810083552},
+{"OCY",-4.810697228},
+{"PEP",-4.810918475},
+{"WFU",-4.81207501},
+{"DDH",-4.812372581},
+{"EOM",-4.812444788},
+{"INB",-4.812537319},
+{"UOR",-4.815761018},
+{"NUN",-4.816524253},
+{"GID",-4.817394051},
+{"NHO",-4.818204685},
+{"DEU",-4.81821904},
+{"NZY",-4.8190489},
+{"PUM",-4.819070229},
+{"OSH",-4.819492688},
+{"CAI",-4.819912809},
+{"AER",-4.820007259},
+{"SYR",-4.820454423},
+{"OHA",-4.821257462},
+{"AIC",-4.821742891},
+{"CUE",-4.821938517},
+{"TSO",-4.822301504},
+{"MAU",-4.822344237},
+{"HEB",-4.82271066},
+{"AWL",-4.82310651},
+{"UNH",-4.823385619},
+{"HYM",-4.823589874},
+{"IAC",-4.824018093},
+{"NWI",-4.824045741},
+{"ESB",-4.824419212},
+{"GRU",-4.8245368},
+{"RGH",-4.825392361},
+{"UBO",-4.826598489},
+{"ZZL",-4.826868959},
+{"RIX",-4.826900111},
+{"XCU",-4.827077098},
+{"BAI",-4.827281803},
+{"NNS",-4.827343916},
+{"TET",-4.827412577},
+{"ELB",-4.828023182},
+{"NBU",-4.828775219},
+{"GGS",-4.829284442},
+{"NPR",-4.829619478},
+{"FIA",-4.82989062},
+{"DOZ",-4.830204338},
+{"XIB",-4.830273509},
+{"ARX",-4.830594427},
+{"ULK",-4.830616863},
+{"DDY",-4.83109946},
+{"NDF",-4.831101986},
+{"EKE",-4.831150925},
+{"LIL",-4.831203827},
+{"AUX",-4.831218099},
+{"TST",-4.832365422},
+{"UBU",-4.833540741},
+{"NRO",-4.833730223},
+{"MAB",-4.834155338},
+{"RBS",-4.834471517},
+{"HMI",-4.834974514},
+{"DGI",-4.8353105},
+{"YMA",-4.835698029},
+{"ULM",-4.835829093},
+{"NEQ",-4.836175322},
+{"ETN",-4.837313602},
+{"IGS",-4.837333044},
+{"IPO",-4.838849191},
+{"LDH",-4.840701958},
+{"MNS",-4.840750399},
+{"DSC",-4.840865333},
+{"IFL",-4.840883557},
+{"RRH",-4.84107383},
+{"ESK",-4.841238996},
+{"NEP",-4.841350741},
+{"STW",-4.841787828},
+{"OXE",-4.841987173},
+{"FEV",-4.842622161},
+{"LPS",-4.842872326},
+{"AHO",-4.842953535},
+{"DYS",-4.843809399},
+{"DAG",-4.843872881},
+{"HAC",-4.844078939},
+{"ANZ",-4.844200902},
+{"ZYM",-4.844595191},
+{"AGS",-4.845322879},
+{"OLN",-4.845365226},
+{"NSY",-4.845530916},
+{"GHI",-4.84667565},
+{"KAL",-4.847912316},
+{"IOM",-4.848315872},
+{"EJU",-4.848468805},
+{"MUD",-4.850160476},
+{"KLA",-4.850885017},
+{"RCY",-4.850948823},
+{"TUG",-4.851049154},
+{"SSY",-4.851505778},
+{"AWE",-4.853253487},
+{"BBO",-4.853553996},
+{"SRO",-4.854471549},
+{"OVO",-4.855102073},
+{"IBO",-4.855912506},
+{"ESQ",-4.8560775},
+{"RFI",-4.856193233},
+{"RGR",-4.856302679},
+{"XXI",-4.857226972},
+{"RYL",-4.858705013},
+{"LCI",-4.858848503},
+{"EXO",-4.859310126},
+{"RKN",-4.859856479},
+{"MUE",-4.859978052},
+{"UZZ",-4.8604493},
+{"RCR",-4.861034844},
+{"MCC",-4.861808308},
+{"FFR",-4.86406187},
+{"HST",-4.865097964},
+{"BRY",-4.866187594},
+{"OGO",-4.866486521},
+{"AKN",-4.866692478},
+{"DEI",-4.866845791},
+{"BNO",-4.867927069},
+{"OQU",-4.86832194},
+{"RBU",-4.869154031},
+{"TUP",-4.870957782},
+{"GEE",-4.87105463},
+{"CYL",-4.871186765},
+{"RYW",-4.87150198},
+{"HOA",-4.871546728},
+{"ENB",-4.871674807},
+{"SLU",-4.872501269},
+{"LRY",-4.873538612},
+{"AWK",-4.873608698},
+{"DHA",-4.873752709},
+{"UCR",-4.874101763},
+{"SFY",-4.875127104},
+{"LAH",-4.876894504},
+{"HOV",-4.876957321},
+{"ABN",-4.877838901},
+{"ANL",-4.878088895},
+{"NDW",-4.878715073},
+{"LYC",-4.879508909},
+{"YMM",-4.879865856},
+{"JIM",-4.880729333},
+{"JEF",-4.881244553},
+{"RQU",-4.882287627},
+{"CIU",-4.884415852},
+{"SKA",-4.884723439},
+{"NGF",-4.885497095},
+{"SOA",-4.886089928},
+{"SMU",-4.886244319},
+{"YDE",-4.886392742},
+{"LBA",-4.888889799},
+{"RAK",-4.889943773},
+{"YLL",-4.891205373},
+{"JEN",-4.891304572},
+{"SOB",-4.891809249},
+{"HEV",-4.894394881},
+{"ESY",-4.894534183},
+{"OSL",-4.894935048},
+{"WNI",-4.89577358},
+{"NZE",-4.896983835},
+{"AMN",-4.89773967},
+{"UAS",-4.897989458},
+{"ATF",-4.89945602},
+{"UNM",-4.899814795},
+{"EMU",-4.899845003},
+{"OSY",-4.900304389},
+{"EIC",-4.900623588},
+{"HLI",-4.901326662},
+{"YNC",-4.901409032},
+{"IOP",-4.901681423},
+{"UPW",-4.903056265},
+{"MNA",-4.903113112},
+{"LLM",-4.904059202},
+{"PWA",-4.904306791},
+{"KAY",-4.904449907},
+{"IXI",-4.904819466},
+{"DMO",-4.905860868},
+{"DUB",-4.906747553},
+{"ZIL",-4.906955694},
+{"DDS",-4.907166476},
+{"ONR",-4.907535377},
+{"BBY",-4.909282074},
+{"AHM",-4.909404257},
+{"NZA",-4.909969403},
+{"DAW",-4.910111452},
+{"TGA",-4.910206346},
+{"EIM",-4.910209359},
+{"MEH",-4.910703},
+{"UET",-4.911093691},
+{"YCE",-4.911635303},
+{"RAJ",-4.912745903},
+{"AXO",-4.913865461},
+{"ADC",-4.914436735},
+{"LUG",-4.914488496},
+{"IRP",-4.91532087},
+{"VOW",-4.915587985},
+{"TEB",-4.91622268},
+{"BTS",-4.916574094},
+{"EIP",-4.917631089},
+{"GAD",-4.918388869},
+{"LGO",-4.918474471},
+{"DCA",-4.919033772},
+{"BOB",-4.919095929},
+{"ORH",-4.920687522},
+{"SEB",-4.920717476},
+{"GAY",-4.920729841},
+{"IAH",-4.921441451},
+{"ULC",-4.921538577},
+{"TUO",-4.921745426},
+{"ZUR",-4.922078797},
+{"ZAN",-4.922766458},
+{"EWL",-4.923895714},
+{"EOT",-4.924772894},
+{"PFU",-4.925176474},
+{"SGU",-4.925818928},
+{"OGG",-4.926613133},
+{"JOE",-4.926759806},
+{"ENM",-4.927227413},
+{"OEV",-4.928867769},
+{"USK",-4.929057589},
+{"NWH",-4.929956912},
+{"HOB",-4.930466899},
+{"NJA",-4.930511575},
+{"LCH",-4.931510436},
+{"UPH",-4.932202405},
+{"NDN",-4.932495208},
+{"ESD",-4.932851017},
+{"RBY",-4.933027594},
+{"NKA",-4.933290615},
+{"ELG",-4.933398241},
+{"UBC",-4.933990728},
+{"EDM",-4.934814391},
+{"RYB",-4.935338982},
+{"XTY",-4.935633497},
+{"ZLE",-4.935743865},
+{"LFU",-4.936676728},
+{"ANW",-4.937075841},
+{"DAC",-4.937616995},
+{"PAM",-4.938308319},
+{"MMY",-4.938453859},
+{"JAR",-4.938477644},
+{"LCA",-4.93880218},
+{"YAG",-4.93913484},
+{"DEW",-4.93923919},
+{"LPF",-4.939782544},
+{"GAB",-4.940173485},
+{"YWA",-4.941385047},
+{"MLE",-4.941638937},
+{"CAY",-4.942996679},
+{"LKA",-4.943166788},
+{"EBL",-4.943453505},
+{"NDB",-4.945558632},
+{"CDO",-4.946910549},
+{"SSN",-4.948175467},
+{"DUP",-4.949683887},
+{"ORF",-4.949772401},
+{"HUA",-4.951629641},
+{"HUD",-4.953111422},
+{"VIB",-4.953206064},
+{"NDH",-4.953364622},
+{"TAV",-4.953805078},
+{"OUV",-4.95532817},
+{"UBD",-4.956794142},
+{"TEU",-4.957223742},
+{"UTW",-4.959491539},
+{"PEU",-4.959924608},
+{"DBA",-4.96041933},
+{"NWE",-4.960483374},
+{"GHS",-4.961320382},
+{"KRA",-4.962043064},
+{"DFU",-4.962078534},
+{"TSC",-4.962590111},
+{"CUN",-4.96390684},
+{"GHW",-4.964372101},
+{"NOE",-4.964381979},
+{"LFR",-4.965232465},
+{"WIV",-4.965636359},
+{"ANH",-4.965852998},
+{"RTF",-4.966674529},
+{"YPH",-4.967043771},
+{"MSO",-4.967359217},
+{"AMY",-4.967807262},
+{"AEO",-4.968867653},
+{"NAE",-4.969214893},
+{"CHS",-4.969818901},
+{"AWR",-4.970573692},
+{"BUM",-4.97097974},
+{"DFA",-4.972028449},
+{"LPT",-4.97224434},
+{"XTH",-4.973448702},
+{"KIM",-4.974778859},
+{"BBA",-4.974940374},
+{"NDP",-4.975372862},
+{"TBA",-4.975759404},
+{"NAZ",-4.976169979},
+{"NID",-4.976217635},
+{"LUO",-4.976325348},
+{"RYA",-4.976568214},
+{"UDO",-4.976756118},
+{"SRE",-4.977189025},
+{"CKO",-4.977865444},
+{"SHN",-4.977926821},
+{"EEF",-4.982554565},
+{"HUL",-4.98292618},
+{"EUP",-4.984711862},
+{"BAU",-4.984806453},
+{"ESL",-4.98494339},
+{"XIA",-4.985813615},
+{"NYI",-4.987401302},
+{"OKA",-4.987784697},
+{"EOC",-4.988133183},
+{"NPO",-4.989242207},
+{"UYE",-4.989283099},
+{"PAK",-4.989745399},
+{"FEI",-4.99004013},
+{"TAD",-4.990266035},
+{"PST",-4.990474764},
+{"XIV",-4.991201076},
+{"MIU",-4.992493916},
+{"DLO",-4.993106026},
+{"TTH",-4.993950992},
+{"RPI",-4.994191665},
+{"LDW",-4.994347489},
+{"RTG",-4.994491106},
+{"ECY",-4.995603433},
+{"WAD",-4.995666836},
+{"PAV",-4.996499145},
+{"RYD",-4.996969934},
+{"TZE",-4.997245463},
+{"LSH",-4.998000339},
+{"CKH",-4.998033286},
+{"CIZ",-4.998534045},
+{"CIB",-4.998615416},
+{"WIM",-4.998814924},
+{"RWH",-4.999053124},
+{"ILB",-4.999503825},
+{"FOX",-4.999553242},
+{"OBU",-4.999893362},
+{"PTL",-5.001046769},
+{"EKL",-5.001548815},
+{"RSY",-5.002907342},
+{"WIG",-5.008525},
+{"RWE",-5.008865102},
+{"OEN",-5.009962572},
+{"BDO",-5.009976042},
+{"DLA",-5.010268872},
+{"NAH",-5.01069927},
+{"RDY",-5.011098431},
+{"UPY",-5.012518356},
+{"SBY",-5.013076361},
+{"BSU",-5.013922099},
+{"UUM",-5.014028915},
+{"ASL",-5.014722183},
+{"KFA",-5.016370376},
+{"YCO",-5.016631998},
+{"XUR",-5.016877142},
+{"ODL",-5.018055314},
+{"ONZ",-5.019106955},
+{"JAI",-5.019676636},
+{"EBS",-5.020311849},
+{"CUO",-5.02040875},
+{"EJO",-5.020691139},
+{"KHO",-5.020880116},
+{"OGL",-5.021828085},
+{"RNT",-5.02225892},
+{"OER",-5.023249694},
+{"SUT",-5.024156329},
+{"AKF",-5.024388834},
+{"ROZ",-5.02444445},
+{"LUK",-5.024460765},
+{"ANV",-5.024671918},
+{"UEB",-5.025139316},
+{"NPL",-5.025258778},
+{"TIU",-5.025563988},
+{"AYN",-5.026396477},
+{"CIG",-5.026574727},
+{"HYR",-5.026767911},
+{"ANF",-5.026935765},
+{"HTN",-5.027262896},
+{"EBB",-5.027724245},
+{"LBU",-5.027747721},
+{"XAG",-5.029878405},
+{"BYT",-5.030456562},
+{"OTW",-5.031300359},
+{"DQU",-5.03144594},
+{"HLA",-5.032429593},
+{"DJA",-5.03353829},
+{"RFL",-5.033985451},
+{"PNE",-5.034908566},
+{"OMN",-5.0353683},
+{"GOW",-5.037060152},
+{"HIZ",-5.037061347},
+{"LGR",-5.037482771},
+{"GGA",-5.037614187},
+{"WIE",-5.037714169},
+{"SHL",-5.037979621},
+{"AJA",-5.039872679},
+{"KMA",-5.040588716},
+{"TOY",-5.041124017},
+{"KRI",-5.041338423},
+{"IRK",-5.041457051},
+{"FAD",-5.043087614},
+{"XXX",-5.044213465},
+{"SGR",-5.044696743},
+{"OED",-5.045826411},
+{"UNJ",-5.045991855},
+{"EYN",-5.046169426},
+{"OFA",-5.046361486},
+{"EOD",-5.046629236},
+{"ADQ",-5.047337905},
+{"AZZ",-5.047521222},
+{"JUA",-5.047533323},
+{"RWO",-5.047704571},
+{"BDU",-5.047795951},
+{"ANQ",-5.048462207},
+{"IFA",-5.048769444},
+{"PUE",-5.048853705},
+{"RCT",-5.048908699},
+{"RBL",-5.049771446},
+{"OYD",-5.050675196},
+{"DBO",-5.050931608},
+{"OAM",-5.051964256},
+{"LOQ",-5.052200048},
+{"OKL",-5.052873942},
+{"ADF",-5.053005376},
+{"CIC",-5.053457502},
+{"BOH",-5.054805862},
+{"EDB",-5.055540643},
+{"PDA",-5.056543672},
+{"NLO",-5.056844932},
+{"WTO",-5.056874213},
+{"IPR",-5.057499659},
+{"YRE",-5.058295779},
+{"OLC",-5.058780015},
+{"EEA",-5.059380755},
+{"ARW",-5.059839191},
+{"GUT",-5.06039011},
+{"BAM",-5.060858067},
+{"RDW",-5.061079797},
+{"AGL",-5.061402246},
+{"RTZ",-5.061844778},
+{"UAK",-5.061966015},
+{"SOE",-5.062778098},
+{"UXU",-5.063432448},
+{"PSA",-5.0642678},
+{"KRU",-5.064498002},
+{"JUG",-5.066990734},
+{"POM",-5.067410546},
+{"SAX",-5.068405901},
+{"ADN",-5.068419834},
+{"RDN",-5.069403932},
+{"UPD",-5.069602517},
+{"XXV",-5.070285683},
+{"IZZ",-5.070363905},
+{"ILG",-5.071112391},
+{"PHU",-5.071216148},
+{"FEU",-5.071585046},
+{"HEF",-5.072253006},
+{"GOG",-5.072506291},
+{"RYN",-5.072925839},
+{"CCR",-5.073023614},
+{"CHB",-5.073083446},
+{"CLY",-5.073194265},
+{"AUF",-5.073232142},
+{"HMS",-5.073247505},
+{"NSK",-5.073598294},
+{"LYP",-5.073973885},
+{"YDA",-5.074612423},
+{"CHW",-5.07516615},
+{"WEP",-5.075588893},
+{"NIX",-5.076306495},
+{"JET",-5.078315698},
+{"IHO",-5.07848549},
+{"NBO",-5.078895243},
+{"AZY",-5.079832566},
+{"HEU",-5.079939423},
+{"GFU",-5.080768202},
+{"VAU",-5.081967143},
+{"ZIE",-5.082210951},
+{"JOK",-5.084153843},
+{"JOA",-5.084385608},
+{"CAE",-5.085182022},
+{"MEI",-5.0861038},
+{"UTM",-5.086313782},
+{"MCG",-5.087010113},
+{"LIH",-5.087472575},
+{"MEB",-5.087543395},
+{"HAO",-5.087650394},
+{"YWO",-5.088655108},
+{"LOF",-5.090822273},
+{"WAM",-5.091137433},
+{"BDI",-5.092503339},
+{"LFO",-5.092910748},
+{"ELH",-5.094049618},
+{"ODN",-5.094091467},
+{"DYE",-5.094261704},
+{"JUI",-5.094286058},
+{"EUN",-5.094733785},
+{"UBR",-5.095251819},
+{"FTL",-5.096024402},
+{"OTC",-5.096025177},
+{"EBI",-5.097002866},
+{"MYO",-5.097117216},
+{"SRU",-5.097148799},
+{"FAX",-5.097269274},
+{"HUB",-5.097669361},
+{"DOV",-5.097726128},
+{"UGO",-5.098578316},
+{"NOX",-5.09886716},
+{"EOS",-5.099606867},
+{"UDL",-5.10189594},
+{"PSU",-5.102039992},
+{"UYI",-5.103554031},
+{"UTB",-5.104300481},
+{"TNI",-5.104500939},
+{"INW",-5.105532228},
+{"NAW",-5.105946423},
+{"RKM",-5.107173184},
+{"EUV",-5.108029638},
+{"PKI",-5.108326566},
+{"RAQ",-5.109645197},
+{"AML",-5.109771481},
+{"XPI",-5.110132415},
+{"YMN",-5.110564854},
+{"KIC",-5.111266842},
+{"MRS",-5.111605495},
+{"ONP",-5.11175567},
+{"NSV",-5.112325468},
+{"GUO",-5.112514565},
+{"ACM",-5.112766752},
+{"EHR",-5.113162444},
+{"YBR",-5.113565056},
+{"URH",-5.113868942},
+{"URU",-5.113917561},
+{"TSM",-5.113920144},
+{"HMO",-5.115235923},
+{"EOI",-5.11559392},
+{"GIU",-5.115750614},
+{"DAH",-5.115885931},
+{"PBE",-5.11590842},
+{"PYI",-5.116885635},
+{"CAF",-5.118274525},
+{"FUC",-5.118695944},
+{"NYA",-5.119087792},
+{"RXI",-5.119135774},
+{"SVE",-5.119549962},
+{"BHA",-5.119555004},
+{"ARQ",-5.119689194},
+{"OLP",-5.120144524},
+{"RSC",-5.120422459},
+{"OEL",-5.121953422},
+{"AZO",-5.123057497},
+{"STP",-5.12411298},
+{"SHY",-5.124367722},
+{"RYP",-5.125364263},
+{"TPO",-5.12544049},
+{"EEV",-5.125449111},
+{"JUV",-5.126268132},
+{"EWT",-5.126467887},
+{"ZOO",-5.126515665},
+{"TBO",-5.12727407},
+{"GAC",-5.127609643},
+{"IXO",-5.128311103},
+{"MOH",-5.128348459},
+{"DDA",-5.12870165},
+{"APU",-5.128715152},
+{"LCE",-5.129392776},
+{"CZE",-5.130289737},
+{"CAK",-5.130376894},
+{"YAB",-5.132025241},
+{"WNW",-5.132152592},
+{"OWH",-5.132187754},
+{"ZEC",-5.132623433},
+{"HTO",-5.133197275},
+{"CYS",-5.134147661},
+{"VRE",-5.134426497},
+{"VIZ",-5.134540108},
+{"SBO",-5.13472959},
+{"KYO",-5.135034534},
+{"OFS",-5.135894549},
+{"SOW",-5.13597041},
+{"KUL",-5.135998947},
+{"ARU",-5.137077001},
+{"EYA",-5.137369313},
+{"RPU",-5.138113811},
+{"IBS",-5.13813475},
+{"OEC",-5.1383167},
+{"MEG",-5.138778548},
+{"NWO",-5.139302672},
+{"NGN",-5.139949576},
+{"WPO",-5.140527951},
+{"CUA",-5.141398151},
+{"AEM",-5.141674225},
+{"PHL",-5.141880765},
+{"ETZ",-5.142464967},
+{"NEB",-5.142516866},
+{"PUZ",-5.142703019},
+{"XCA",-5.144707345},
+{"EWP",-5.144900536},
+{"THC",-5.14503198},
+{"BEV",-5.145082742},
+{"WLI",-5.145661717},
+{"LAE",-5.145703607},
+{"HOF",-5.147481099},
+{"MIK",-5.147682218},
+{"NEZ",-5.14791794},
+{"IDY",-5.148039065},
+{"PUD",-5.14809408},
+{"ILF",-5.148447391},
+{"POG",-5.148472943},
+{"OTU",-5.148547041},
+{"EUC",-5.150727133},
+{"AAR",-5.150902863},
+{"ADW",-5.151373899},
+{"TLO",-5.151523983},
+{"MIM",-5.151825774},
+{"AIV",-5.151860657},
+{"NKR",-5.151951988},
+{"AFO",-5.152321827},
+{"NAY",-5.152460624},
+{"ODW",-5.152678419},
+{"GNT",-5.154113418},
+{"GOM",-5.154125461},
+{"HEG",-5.154518044},
+{"DOD",-5.155431535},
+{"IAD",-5.155643568},
+{"JAW",-5.156270768},
+{"DFO",-5.15713909},
+{"HDA",-5.157817959},
+{"CTM",-5.158091507},
+{"OKY",-5.158497383},
+{"BUB",-5.159581119},
+{"OOV",-5.161043946},
+{"MIO",-5.162033952},
+{"SBE",-5.164174072},
+{"ITF",-5.165696522},
+{"MPB",-5.165843663},
+{"RYM",-5.166030595},
+{"PEG",-5.166180338},
+{"GYM",-5.167075107},
+{"DPO",-5.167700896},
+{"DNI",-5.167814141},
+{"NYB",-5.168684082},
+{"NPA",-5.169028495},
+{"NOY",-5.170104596},
+{"AFA",-5.170243344},
+{"SKU",-5.17126851},
+{"HYB",-5.171694364},
+{"BYR",-5.172464277},
+{"EZI",-5.172702939},
+{"HBI",-5.173381172},
+{"LHI",-5.173675697},
+{"PIK",-5.174184934},
+{"IOX",-5.174318622},
+{"IOV",-5.174742681},
+{"SAA",-5.175249825},
+{"CMI",-5.175399837},
+{"DJO",-5.176209738},
+{"JAV",-5.176405101},
+{"UYS",-5.178171798},
+{"UAC",-5.179536634},
+{"BUG",-5.179542142},
+{"NKF",-5.180826821},
+{"PHT",-5.180890734},
+{"DWO",-5.181012246},
+{"CKB",-5.181582609},
+{"TAH",-5.182120255},
+{"NRA",-5.182362961},
+{"YSS",-5.182723823},
+{"EEB",-5.18326784},
+{"IRW",-5.184101386},
+{"OZA",-5.185280006},
+{"AGH",-5.185336808},
+{"BTF",-5.185381245},
+{"AAC",-5.185880712},
+{"AKO",-5.186093756},
+{"TOV",-5.186139352},
+{"JAS",-5.187932106},
+{"BTR",-5.188216394},
+{"WIP",-5.18847694},
+{"RKL",-5.1889464},
+{"WMA",-5.189065996},
+{"KAD",-5.18958961},
+{"LYR",-5.190156701},
+{"ZIO",-5.190847736},
+{"ECD",-5.193221501},
+{"RHI",-5.193760145},
+{"OYC",-5.194602916},
+{"FOE",-5.196140561},
+{"UTD",-5.196316279},
+{"MRA",-5.197066166},
+{"ULB",-5.198063014},
+{"DEH",-5.198169662},
+{"AOS",-5.19829006},
+{"USO",-5.19941145},
+{"POD",-5.201482293},
+{"ISY",-5.202028651},
+{"EAH",-5.202377966},
+{"BCO",-5.202838895},
+{"AHI",-5.204051539},
+{"ENW",-5.204184014},
+{"OZO",-5.204201404},
+{"ODR",-5.204723833},
+{"LPA",-5.205511183},
+{"STN",-5.205707122},
+{"KIP",-5.206321199},
+{"ADT",-5.208610947},
+{"ATN",-5.209491716},
+{"WAX",-5.209781083},
+{"FUM",-5.210360532},
+{"WAB",-5.210366176},
+{"EWR",-5.21122843},
+{"NIB",-5.211256575},
+{"FMA",-5.211922725},
+{"SNI",-5.212371253},
+{"IWA",-5.212684299},
+{"IKA",-5.213105381},
+{"YEN",-5.213401024},
+{"TDO",-5.214017479},
+{"ENQ",-5.214453422},
+{"OLB",-5.215891303},
+{"LSA",-5.21725329},
+{"KUP",-5.217501322},
+{"CEO",-5.218775225},
+{"CUU",-5.219348834},
+{"IDW",-5.219462761},
+{"TEH",-5.219605513},
+{"EYI",-5.219672719},
+{"EUG",-5.219858086},
+{"AYT",-5.219952602},
+{"MYC",-5.221622943},
+{"YSO",-5.221788414},
+{"NZI",-5.222771705},
+{"YOT",-5.223569289},
+{"OWM",-5.223796904},
+{"BEW",-5.223954469},
+{"HTM",-5.225068479},
+{"LPL",-5.225184056},
+{"MAO",-5.22547976},
+{"OPK",-5.225575299},
+{"OMR",-5.225640094},
+{"DUO",-5.225656625},
+{"JIN",-5.226204693},
+{"AXP",-5.227614671},
+{"UHA",-5.228996764},
+{"XAL",-5.229293252},
+{"CEC",-5.22980257},
+{"MOP",-5.231054312},
+{"IOW",-5.231894417},
+{"KAS",-5.233680825},
+{"BYL",-5.233784427},
+{"OMU",-5.235322065},
+{"VAK",-5.235419439},
+{"UVI",-5.237516728},
+{"JAH",-5.237616563},
+{"BTO",-5.238629151},
+{"NOA",-5.239249754},
+{"PSH",-5.240027917},
+{"GEB",-5.240128222},
+{"IJI",-5.24013218},
+{"TBR",-5.240957745},
+{"KTO",-5.241437554},
+{"VIK",-5.24193119},
+{"YGO",-5.241940259},
+{"MYE",-5.242393918},
+{"KIA",-5.243850317},
+{"GHN",-5.244081228},
+{"KFU",-5.244139619},
+{"ILH",-5.244824563},
+{"IZU",-5.244856645},
+{"PAW",-5.245299453},
+{"LHO",-5.246058703},
+{"HUC",-5.2464299},
+{"SEO",-5.247526439},
+{"AUB",-5.24801415},
+{"XTB",-5.249744964},
+{"KAM",-5.249831643},
+{"NIH",-5.250210757},
+{"MUG",-5.251886292},
+{"YDN",-5.252820621},
+{"LYW",-5.253642252},
+{"VOM",-5.254015718},
+{"RUF",-5.254411667},
+{"ZET",-5.255524545},
+{"UXI",-5.25565829},
+{"HUE",-5.256462595},
+{"KDO",-5.256715228},
+{"KEI",-5.256855547},
+{"VEX",-5.257686877},
+{"OSQ",-5.258146832},
+{"NYL",-5.258907444},
+{"BYE",-5.259035846},
+{"OTB",-5.259575494},
+{"MEY",-5.259704094},
+{"FOI",-5.259722613},
+{"WBO",-5.259928716},
+{"TCA",-5.260092381},
+{"LFE",-5.260714755},
+{"NBA",-5.261100322},
+{"YPS",-5.262188926},
+{"UNQ",-5.263071088},
+{"PEF",-5.263075981},
+{"NMI",-5.263850945},
+{"EHY",-5.264145559},
+{"GIG",-5.264375992},
+{"XCR",-5.265263297},
+{"IBN",-5.265656474},
+{"AHR",-5.265755817},
+{"KME",-5.266144932},
+{"IRN",-5.266191428},
+{"AII",-5.268248668},
+{"YPR",-5.2686119},
+{"FSE",-5.269040541},
+{"UGI",-5.269452205},
+{"MCK",-5.270406392},
+{"EUX",-5.27182981},
+{"OAP",-5.272225919},
+{"PIU",-5.273297637},
+{"IAE",-5.273403055},
+{"YHO",-5.275074432},
+{"YAM",-5.275999171},
+{"WLS",-5.276112791},
+{"HAH",-5.276224329},
+{"KBO",-5.276291352},
+{"EUE",-5.276536499},
+{"RDU",-5.276732145},
+{"IRV",-5.277037159},
+{"MYR",-5.277768162},
+{"LDA",-5.278124876},
+{"BMA",-5.278227505},
+{"EWC",-5.278687649},
+{"UCU",-5.279222726},
+{"OGM",-5.279671039},
+{"LIX",-5.280055827},
+{"NDT",-5.280213445},
+{"AUE",-5.280217589},
+{"MOA",-5.280614869},
+{"EUK",-5.280983695},
+{"SYD",-5.281224901},
+{"CCH",-5.282376824},
+{"REZ",-5.282977582},
+{"YOS",-5.284250774},
+{"AKD",-5.286329022},
+{"IHI",-5.286463072},
+{"TGO",-5.286515238},
+{"IAP",-5.287046903},
+{"KEM",-5.28756124},
+{"SDE",-5.288074177},
+{"LIR",-5.288387587},
+{"LEH",-5.288689312},
+{"GSI",-5.288697762},
+{"NMO",-5.289212487},
+{"KAI",-5.289394905},
+{"CGR",-5.290568289},
+{"LTD",-5.291452457},
+{"TAW",-5.29162014},
+{"YOG",-5.293781469},
+{"IVY",-5.294051359},
+{"PEW",-5.294184431},
+{"THH",-5.295598835},
+{"LYO",-5.296406266},
+{"YRU",-5.29791038},
+{"FAY",-5.298810626},
+{"YAT",-5.299216471},
+{"CEY",-5.299452099},
+{"REX",-5.299761572},
+{"UGM",-5.300150251},
+{"DSW",-5.3004374},
+{"HQU",-5.300578523},
+{"BOE",-5.300917894},
+{"KLO",-5.301160577},
+{"POX",-5.301432276},
+{"DSM",-5.301481464},
+{"MTH",-5.301812169},
+{"OYO",-5.3031393},
+{"XEN",-5.303773705},
+{"HOK",-5.30429169},
+{"UCY",-5.304839361},
+{"XTO",-5.305087338},
+{"PMA",-5.305448569},
+{"BUE",-5.305543975},
+{"ENK",-5.305639653},
+{"KUR",-5.306492104},
+{"SRI",-5.308189121},
+{"LFT",-5.308299317},
+{"WSH",-5.308514319},
+{"THQ",-5.309072067},
+{"DAK",-5.309088219},
+{"RMT",-5.30986529},
+{"SOS",-5.310219441},
+{"FEG",-5.31039305},
+{"TOF",-5.310454856},
+{"NOF",-5.310896084},
+{"XIX",-5.312142655},
+{"TOA",-5.313157845},
+{"IKH",-5.31389439},
+{"NYS",-5.315212737},
+{"TSB",-5.315512506},
+{"ZZA",-5.316678118},
+{"UEZ",-5.316770056},
+{"TSH",-5.316824404},
+{"BOG",-5.317295792},
+{"TFI",-5.317738695},
+{"COX",-5.317852504},
+{"EVY",-5.319144524},
+{"KOT",-5.319149315},
+{"JAB",-5.319415318},
+{"LPO",-5.319667137},
+{"WOK",-5.319780329},
+{"AIW",-5.320130289},
+{"YNN",-5.320620915},
+{"UOD",-5.321011215},
+{"ACS",-5.321786094},
+{"CTN",-5.322702415},
+{"FOW",-5.323054565},
+{"HCO",-5.324401669},
+{"TMI",-5.324410144},
+{"NBR",-5.324506793},
+{"ZIG",-5.325359083},
+{"DUG",-5.325370817},
+{"NEH",-5.325674834},
+{"KST",-5.32575108},
+{"AWB",-5.325767295},
+{"UVR",-5.325832161},
+{"PTC",-5.327014852},
+{"UTF",-5.327565731},
+{"NAF",-5.327764688},
+{"RKP",-5.328161243},
+{"IOA",-5.328357651},
+{"NTG",-5.328764986},
+{"YUG",-5.329179638},
+{"NIK",-5.329406955},
+{"NZO",-5.330152967},
+{"FOG",-5.330181965},
+{"ECS",-5.330234785},
+{"SBI",-5.330556407},
+{"JAY",-5.332275967},
+{"EWB",-5.333144458},
+{"MCD",-5.333501076},
+{"RDR",-5.333590756},
+{"GGY",-5.334174575},
+{"BYS",-5.33467977},
+{"FSP",-5.335135665},
+{"RSD",-5.335412542},
+{"EDF",-5.335465779},
+{"AFI",-5.336698494},
+{"KNA",-5.336752787},
+{"SSW",-5.337089261},
+{"YFU",-5.337937558},
+{"AFL",-5.338121303},
+{"LBS",-5.338289745},
+{"HYA",-5.339167059},
+{"KEA",-5.340257159},
+{"ZZI",-5.340565978},
+{"CYN",-5.340622526},
+{"IEM",-5.341936393},
+{"BIV",-5.341994166},
+{"WSO",-5.34423658},
+{"XOR",-5.344340259},
+{"UPU",-5.344347075},
+{"UAY",-5.344815893},
+{"IAZ",-5.346022162},
+{"XTA",-5.346748537},
+{"SAH",-5.347557637},
+{"AKH",-5.348995125},
+{"CYP",-5.349346728},
+{"WEG",-5.350272561},
+{"XOT",-5.350557127},
+{"OBR",-5.350678014},
+{"FGH",-5.350706001},
+{"AFG",-5.350706001},
+{"WFO",-5.351029589},
+{"YGI",-5.351260459},
+{"CTF",-5.351301219},
+{"HYG",-5.351822699},
+{"VOS",-5.352447643},
+{"LLF",-5.352583975},
+{"TCY",-5.353304608},
+{"ADG",-5.353883388},
+{"YLU",-5.354740147},
+{"RAX",-5.35496175},
+{"LTZ",-5.355354294},
+{"SGO",-5.356209216},
+{"ZEL",-5.356336999},
+{"KUN",-5.356642743},
+{"LKY",-5.359336309},
+{"DBE",-5.359512001},
+{"ZAM",-5.359522611},
+{"LOE",-5.359639576},
+{"TSK",-5.359893369},
+{"ANB",-5.360930223},
+{"BAH",-5.363956461},
+{"ABH",-5.364276429},
+{"BBR",-5.365011803},
+{"ALN",-5.367152048},
+{"WKW",-5.367470086},
+{"JOL",-5.368777912},
+{"DJE",-5.370176232},
+{"AIA",-5.371046758},
+{"AED",-5.371810214},
+{"MCL",-5.372164111},
+{"OHY",-5.372390054},
+{"DPA",-5.373771535},
+{"YIS",-5.373982694},
+{"REK",-5.374672358},
+{"CEU",-5.376203701},
+{"ZEI",-5.376369216},
+{"STC",-5.377215254},
+{"JAK",-5.377482049},
+{"XAB",-5.378347424},
+{"NCK",-5.378606601},
+{"YNG",-5.37935665},
+{"SVI",-5.379455227},
+{"ZIM",-5.379536268},
+{"DUI",-5.379741317},
+{"SBN",-5.379763003},
+{"MOZ",-5.380762496},
+{"WOV",-5.38097126},
+{"TYA",-5.381215327},
+{"LOL",-5.381551212},
+{"CKM",-5.381942267},
+{"ACD",-5.381982569},
+{"OYL",-5.382067176},
+{"BVE",-5.38273308},
+{"FOA",-5.383397105},
+{"YNI",-5.383578001},
+{"ZOP",-5.383646495},
+{"YPA",-5.383934258},
+{"XYL",-5.384910513},
+{"DSI",-5.38505587},
+{"WLA",-5.385405297},
+{"AKL",-5.385480064},
+{"AYR",-5.385569529},
+{"PEI",-5.386597866},
+{"CKU",-5.386655392},
+{"LAL",-5.386990366},
+{"IGL",-5.387076963},
+{"DMU",-5.388363624},
+{"WME",-5.388726109},
+{"EWN",-5.388834488},
+{"DAZ",-5.388939397},
+{"NVU",-5.389155426},
+{"HNA",-5.389494567},
+{"SIK",-5.389583898},
+{"TSU",-5.389986728},
+{"NSG",-5.389989218},
+{"XEL",-5.392083843},
+{"COK",-5.392319934},
+{"WNT",-5.392589632},
+{"KAP",-5.392811679},
+{"DEZ",-5.393186752},
+{"LHE",-5.394761847},
+{"ETB",-5.395631344},
+{"KOL",-5.39687539},
+{"HEQ",-5.39691927},
+{"OEB",-5.398332054},
+{"NOZ",-5.398917003},
+{"EYM",-5.399019344},
+{"UTG",-5.399772574},
+{"ASQ",-5.401336731},
+{"OEU",-5.401383464},
+{"OFU",-5.403046006},
+{"TPA",-5.403198715},
+{"MFU",-5.403877546},
+{"WRY",-5.403926547},
+{"BNE",-5.404899574},
+{"RYE",-5.405940827},
+{"UXE",-5.406437694},
+{"LUF",-5.406562144},
+{"RSB",-5.406736425},
+{"MUH",-5.406972852},
+{"PEK",-5.407726254},
+{"OWB",-5.408359939},
+{"FFM",-5.408774686},
+{"LYD",-5.40885348},
+{"YZI",-5.408959039},
+{"FRY",-5.409262697},
+{"RTC",-5.409274489},
+{"RGL",-5.410581735},
+{"LYE",-5.410607522},
+{"IXA",-5.411206745},
+{"AYW",-5.411218803},
+{"UKR",-5.411542627},
+{"MAE",-5.411553146},
+{"RTW",-5.411927344},
+{"AYF",-5.412333692},
+{"GYN",-5.412791234},
+{"KWO",-5.413160714},
+{"EWM",-5.414375936},
+{"NGM",-5.414639362},
+{"WSE",-5.415010256},
+{"IJA",-5.415025434},
+{"ASG",-5.415755475},
+{"XQU",-5.416263867},
+{"EXQ",-5.416263867},
+{"EUL",-5.416508511},
+{"KFO",-5.417248139},
+{"YZA",-5.417687495},
+{"TNO",-5.4185065},
+{"OSB",-5.418988086},
+{"STF",-5.420404502},
+{"ICC",-5.421432953},
+{"RMF",-5.421513695},
+{"AHL",-5.421687741},
+{"YSM",-5.421777715},
+{"KOV",-5.42180412},
+{"MLI",-5.422610009},
+{"NTW",-5.423678403},
+{"WEY",-5.423827997},
+{"JAZ",-5.42448338},
+{"TSA",-5.424613827},
+{"LLB",-5.425109067},
+{"ZLI",-5.425286379},
+{"YOC",-5.426034717},
+{"HWI",-5.426280897},
+{"GAE",-5.426612228},
+{"UTN",-5.427168477},
+{"OML",-5.427168754},
+{"UAM",-5.427333287},
+{"UBV",-5.427844668},
+{"NUD",-5.428069078},
+{"CKP",-5.428232732},
+{"RKH",-5.428247714},
+{"IML",-5.428342609},
+{"IEB",-5.428542013},
+{"UEU",-5.428544123},
+{"ZEM",-5.428665909},
+{"UMF",-5.430424529},
+{"HHO",-5.430738053},
+{"TGE",-5.431985744},
+{"TKI",-5.432071551},
+{"IRB",-5.432312496},
+{"ROQ",-5.432585238},
+{"HIK",-5.433689332},
+{"FNE",-5.433961366},
+{"DYL",-5.434792183},
+{"WUN",-5.435836063},
+{"PNO",-5.436144592},
+{"DGA",-5.436456281},
+{"ERJ",-5.437241807},
+{"IRF",-5.437274892},
+{"LUP",-5.438312724},
+{"IMN",-5.438506362},
+{"KPL",-5.438595002},
+{"UVA",-5.43921081},
+{"ZZY",-5.439442938},
+{"VAE",-5.439785551},
+{"OTN",-5.440243929},
+{"OUE",-5.440880532},
+{"HNN",-5.441862553},
+{"HWO",-5.441885914},
+{"ASB",-5.442022841},
+{"MWE",-5.442265933},
+{"YSF",-5.44284416},
+{"HRY",-5.444106568},
+{"LYG",-5.44462594},
+{"LKL",-5.445157529},
+{"ILN",-5.445306283},
+{"LDB",-5.445640444},
+{"SSP",-5.447302419},
+{"GDA",-5.447871547},
+{"KOU",-5.44870314},
+{"SPY",-5.449012103},
+{"BYZ",-5.451275383},
+{"KRO",-5.451672964},
+{"GIZ",-5.451696156},
+{"ELR",-5.451880504},
+{"SHW",-5.452098285},
+{"NCS",-5.452573432},
+{"OLG",-5.453157271},
+{"UEA",-5.454045337},
+{"EZU",-5.454177729},
+{"IOE",-5.454215428},
+{"LHA",-5.454249301},
+{"MIF",-5.454681282},
+{"OAG",-5.455027636},
+{"EYB",-5.45593527},
+{"ISQ",-5.45625475},
+{"HSI",-5.456257117},
+{"YAS",-5.456480361},
+{"NGW",-5.456869105},
+{"ZAL",-5.457053647},
+{"BBS",-5.459192345},
+{"ISN",-5.459239421},
+{"UEO",-5.459328104},
+{"OYF",-5.460053804},
+{"HEX",-5.4603829},
+{"GDP",-5.460457176},
+{"AAL",-5.460676969},
+{"KYL",-5.460751115},
+{"CHF",-5.462723082},
+{"XHO",-5.462920285},
+{"INR",-5.463678085},
+{"EIB",-5.46497243},
+{"ATK",-5.465681925},
+{"YPN",-5.465875091},
+{"SNU",-5.46595013},
+{"NVY",-5.466030872},
+{"KAU",-5.466602549},
+{"EYL",-5.467036321},
+{"SGI",-5.467330742},
+{"XLE",-5.46840457},
+{"TBE",-5.468526923},
+{"LDN",-5.468879689},
+{"YEB",-5.469092875},
+{"LNU",-5.469310619},
+{"YOK",-5.469773114},
+{"NSD",-5.469941111},
+{"KEF",-5.471205523},
+{"OWY",-5.472274862},
+{"EIJ",-5.472808831},
+{"YCA",-5.472813995},
+{"PIV",-5.473409207},
+{"EIF",-5.473913381},
+{"WDS",-5.474262963},
+{"APM",-5.474943693},
+{"LAF",-5.475107397},
+{"ERZ",-5.476077543},
+{"UQU",-5.47645671},
+{"TFA",-5.478716687},
+{"JUT",-5.478989013},
+{"IEE",-5.479023877},
+{"COY",-5.479068224},
+{"CYA",-5.479917814},
+{"OKO",-5.480068462},
+{"KHE",-5.480279395},
+{"YDI",-5.480379925},
+{"MSS",-5.480642278},
+{"EWD",-5.481168714},
+{"SWU",-5.481714741},
+{"TZS",-5.481824581},
+{"KEV",-5.481961387},
+{"AHN",-5.482200759},
+{"EEE",-5.482279239},
+{"GEI",-5.48298399},
+{"CKT",-5.483697831},
+{"LYL",-5.484653321},
+{"CHD",-5.484998253},
+{"TBU",-5.485039168},
+{"RUZ",-5.486449561},
+{"ANJ",-5.486581231},
+{"ABC",-5.486831101},
+{"KWE",-5.486863298},
+{"CYR",-5.487595253},
+{"EVU",-5.487624071},
+{"YMI",-5.487877916},
+{"AUV",-5.489153202},
+{"IUR",-5.489640399},
+{"ZSC",-5.490113234},
+{"OSW",-5.490227908},
+{"PUG",-5.490509344},
+{"CEB",-5.491438494},
+{"LLP",-5.491666004},
+{"AUP",-5.492430227},
+{"NSB",-5.492766651},
+{"PUF",-5.493584603},
+{"AUK",-5.494016624},
+{"RCK",-5.494422451},
+{"FTA",-5.494739922},
+{"ESN",-5.496562482},
+{"SYP",-5.496784311},
+{"NUB",-5.496857672},
+{"ANP",-5.496876908},
+{"ODH",-5.497507225},
+{"IHA",-5.497667422},
+{"ALZ",-5.49832836},
+{"JEE",-5.498729557},
+{"WCO",-5.498918346},
+{"LBR",-5.499263496},
+{"CST",-5.499339891},
+{"OMW",-5.500791284},
+{"PGR",-5.501092907},
+{"AET",-5.502036388},
+{"AEC",-5.502750715},
+{"AIZ",-5.503063854},
+{"IBM",-5.503209826},
+{"DOB",-5.503407698},
+{"AKT",-5.503566522},
+{"FSH",-5.50413281},
+{"ZUE",-5.504296263},
+{"BOC",-5.504321847},
+{"WBA",-5.504371037},
+{"YNX",-5.504397022},
+{"FTO",-5.504718829},
+{"TTG",-5.50501922},
+{"RNH",-5.505767526},
+{"YAC",-5.505977782},
+{"YOL",-5.506661603},
+{"AWT",-5.507104308},
+{"ELK",-5.507262294},
+{"KOC",-5.509207947},
+{"AOL",-5.509318747},
+{"TNU",-5.510061642},
+{"OAH",-5.510426561},
+{"UIA",-5.511072974},
+{"AAS",-5.511268886},
+{"BME",-5.512129271},
+{"MTE",-5.512190259},
+{"EAW",-5.512376035},
+{"DDO",-5.514703707},
+{"UPB",-5.514999636},
+{"ODB",-5.515120869},
+{"WOE",-5.515307361},
+{"KOH",-5.51580099},
+{"ZOI",-5.516789934},
+{"ORQ",-5.517680018},
+{"BUK",-5.517691063},
+{"SPS",-5.518347773},
+{"AYD",-5.518728608},
+{"EYW",-5.519012795},
+{"OWR",-5.519286904},
+{"TYI",-5.519490254},
+{"NIR",-5.52246892},
+{"NHU",-5.522578329},
+{"HEZ",-5.522879123},
+{"MSH",-5.523042401},
+{"PBO",-5.523375429},
+{"VOG",-5.523417291},
+{"BYP",-5.523458605},
+{"BUO",-5.523472492},
+{"RNU",-5.524205206},
+{"DSE",-5.524235174},
+{"YCI",-5.52666741},
+{"ZAC",-5.527137129},
+{"ODM",-5.527359805},
+{"GNU",-5.527705649},
+{"WCA",-5.528214839},
+{"KOS",-5.528389919},
+{"EIA",-5.528491255},
+{"AKR",-5.528657287},
+{"UKA",-5.530009996},
+{"SOY",-5.530373542},
+{"MFE",-5.530988634},
+{"LYA",-5.531321271},
+{"PAE",-5.531549904},
+{"BEQ",-5.531567994},
+{"NDC",-5.532726638},
+{"TYM",-5.533036523},
+{"UBP",-5.533103133},
+{"BIK",-5.533756912},
+{"NUU",-5.53420972},
+{"DDU",-5.536703114},
+{"LAO",-5.537690472},
+{"BCU",-5.538016138},
+{"IKO",-5.5388968},
+{"AXW",-5.539885935},
+{"XWE",-5.539885935},
+{"XUS",-5.539899353},
+{"SEK",-5.540055448},
+{"UKO",-5.540750844},
+{"YSA",-5.54076242},
+{"ALH",-5.541493445},
+{"PEX",-5.542214305},
+{"TTU",-5.542414103},
+{"GWA",-5.542732931},
+{"KEG",-5.543828808},
+{"PZI",-5.543940475},
+{"YRS",-5.544052822},
+{"IKS",-5.54513686},
+{"OUX",-5.546302613},
+{"GFI",-5.547024942},
+{"CHC",-5.547349802},
+{"UOI",-5.54756023},
+{"ZOR",-5.548663393},
+{"DFI",-5.549732664},
+{"PYL",-5.5502519},
+{"UEV",-5.55139818},
+{"KAH",-5.552393119},
+{"VUE",-5.553425949},
+{"SKR",-5.553689558},
+{"JAG",-5.55434921},
+{"GSH",-5.554564393},
+{"RNW",-5.554657177},
+{"LRI",-5.554876895},
+{"AEG",-5.554972941},
+{"NAA",-5.555417642},
+{"IPZ",-5.556034718},
+{"SHT",-5.5561486},
+{"OHM",-5.556414911},
+{"ADB",-5.556437869},
+{"OHL",-5.556576984},
+{"KKE",-5.556620606},
+{"UZE",-5.556979519},
+{"ATZ",-5.557565413},
+{"RNB",-5.558617524},
+{"XPU",-5.558714475},
+{"HWH",-5.55923279},
+{"AWO",-5.559306693},
+{"LAQ",-5.560039271},
+{"LLW",-5.560754792},
+{"SQL",-5.561933547},
+{"PIX",-5.562309346},
+{"ATP",-5.563776},
+{"AAN",-5.563843249},
+{"NTF",-5.563868498},
+{"BIQ",-5.56475749},
+{"MCN",-5.564873834},
+{"THP",-5.564965351},
+{"SUO",-5.565238115},
+{"MCI",-5.565294027},
+{"DCH",-5.56540359},
+{"IFS",-5.566118179},
+{"ZIS",-5.566428508},
+{"BHO",-5.567530247},
+{"JUP",-5.567933118},
+{"WAU",-5.568289557},
+{"SUZ",-5.569160635},
+{"EEH",-5.569269182},
+{"YSP",-5.569455172},
+{"UJA",-5.569642088},
+{"FIO",-5.569906118},
+{"RSK",-5.57054476},
+{"IAI",-5.570555001},
+{"WAF",-5.570636324},
+{"BIP",-5.571062364},
+{"WBE",-5.571611074},
+{"AGD",-5.573459318},
+{"UIZ",-5.573646879},
+{"UFT",-5.573766173},
+{"AKU",-5.573901406},
+{"MUF",-5.574742771},
+{"RNF",-5.57497367},
+{"AXT",-5.575135583},
+{"LDF",-5.576088596},
+{"AIK",-5.576205987},
+{"KEO",-5.576612384},
+{"RKF",-5.577274344},
+{"WKI",-5.577913427},
+{"UBG",-5.577933477},
+{"SHB",-5.578288972},
+{"YRD",-5.578376304},
+{"INZ",-5.579159153},
+{"FBI",-5.579384082},
+{"ARH",-5.579909345},
+{"KHS",-5.580046821},
+{"RWR",-5.580200007},
+{"YOM",-5.580234257},
+{"MSC",-5.581666905},
+{"JEH",-5.581682863},
+{"CUF",-5.581694635},
+{"TAE",-5.582951111},
+{"HUF",-5.582987084},
+{"WNL",-5.584210359},
+{"LWO",-5.584251523},
+{"ULV",-5.585008263},
+{"LKN",-5.585193871},
+{"WYN",-5.585626787},
+{"LPR",-5.58579312},
+{"VEO",-5.586070908},
+{"PTR",-5.586418275},
+{"LDM",-5.587305634},
+{"PEM",-5.588187191},
+{"DKE",-5.588324826},
+{"OBY",-5.588418532},
+{"OEX",-5.589049409},
+{"ZOL",-5.589183378},
+{"YKE",-5.589745986},
+{"ONH",-5.59012192},
+{"TGR",-5.590147778},
+{"OFL",-5.59048907},
+{"OZY",-5.591124497},
+{"LII",-5.591731102},
+{"VAH",-5.592034318},
+{"OZZ",-5.592470061},
+{"ZHE",-5.592913376},
+{"MOW",-5.593196975},
+{"IIA",-5.594409526},
+{"IHR",-5.594561598},
+{"ZUM",-5.59505292},
+{"UDU",-5.595080296},
+{"BUZ",-5.595349252},
+{"RDM",-5.595544554},
+{"RKO",-5.59567989},
+{"UPG",-5.596228027},
+{"AIE",-5.596587132},
+{"TPL",-5.596759434},
+{"OYN",-5.596870931},
+{"KLU",-5.597422623},
+{"YAH",-5.597729348},
+{"NTZ",-5.598468328},
+{"DUD",-5.599856232},
+{"WSL",-5.599919833},
+{"OXA",-5.600039397},
+{"FFY",-5.6002872},
+{"FWA",-5.600322494},
+{"OIE",-5.601479716},
+{"TCR",-5.602489662},
+{"BAV",-5.603065222},
+{"OVU",-5.603565102},
+{"AEV",-5.60392908},
+{"ZYG",-5.60522914},
+{"AHU",-5.605585418},
+{"PPS",-5.606252702},
+{"RIQ",-5.606851022},
+{"RUV",-5.607357962},
+{"HIU",-5.607938756},
+{"OSK",-5.608168604},
+{"HSO",-5.608279206},
+{"XOD",-5.608437978},
+{"WIZ",-5.608632196},
+{"LML",-5.609152414},
+{"LBI",-5.610868881},
+{"LFW",-5.610902848},
+{"BAF",-5.61092296},
+{"FUZ",-5.611359134},
+{"RDT",-5.612041879},
+{"UNY",-5.612582742},
+{"ETP",-5.612774239},
+{"FAE",-5.613945255},
+{"PEZ",-5.61430961},
+{"MEV",-5.614855608},
+{"JEL",-5.615539435},
+{"IHE",-5.616503468},
+{"RJE",-5.616626145},
+{"TML",-5.616647208},
+{"NDK",-5.616864665},
+{"TIK",-5.617525067},
+{"IBY",-5.618359055},
+{"BIU",-5.618609882},
+{"CAH",-5.619850927},
+{"UOY",-5.620756124},
+{"DWR",-5.621459356},
+{"WEH",-5.623444556},
+{"AEA",-5.624341332},
+{"UXT",-5.624382646},
+{"BAZ",-5.624768953},
+{"MCA",-5.625121377},
+{"THB",-5.625448659},
+{"SCS",-5.625651161},
+{"VSK",-5.627871584},
+{"AEN",-5.628242452},
+{"YOF",-5.628386789},
+{"NUG",-5.62872112},
+{"OMT",-5.628845009},
+{"FFN",-5.629104611},
+{"ARJ",-5.629154753},
+{"EML",-5.629197937},
+{"BIZ",-5.629323019},
+{"LBY",-5.630052547},
+{"KSE",-5.630374466},
+{"PEB",-5.631687665},
+{"TAO",-5.63213554},
+{"WAH",-5.632215585},
+{"BJU",-5.633224159},
+{"PPM",-5.633326738},
+{"MOE",-5.633914209},
+{"GAA",-5.634169015},
+{"SSH",-5.634592775},
+{"LMU",-5.634595274},
+{"GOC",-5.634716297},
+{"HCR",-5.635125313},
+{"PPU",-5.635436798},
+{"RHU",-5.636172826},
+{"NGK",-5.638664065},
+{"TSP",-5.638704242},
+{"TSY",-5.639484006},
+{"AOH",-5.640116022},
+{"TYN",-5.640187699},
+{"OSN",-5.64136034},
+{"EDT",-5.641703271},
+{"RLB",-5.642252597},
+{"OTM",-5.642540427},
+{"GOB",-5.643282049},
+{"PUC",-5.643394954},
+{"GEW",-5.643656114},
+{"YGR",-5.643717624},
+{"NKT",-5.643950255},
+{"KEH",-5.644273247},
+{"OJO",-5.645099012},
+{"JUB",-5.646460412},
+{"DBY",-5.647266828},
+{"TZG",-5.647276843},
+{"KRE",-5.647574826},
+{"VLA",-5.648320682},
+{"ODF",-5.64842173},
+{"JEO",-5.64997154},
+{"OAX",-5.650139654},
+{"LUV",-5.650498107},
+{"MSY",-5.650804887},
+{"YWR",-5.650809055},
+{"JIA",-5.653350715},
+{"HEK",-5.654488393},
+{"WAP",-5.655057603},
+{"GEV",-5.655441112},
+{"DSP",-5.656279308},
+{"OKU",-5.656340192},
+{"CNI",-5.656358112},
+{"KYA",-5.65653341},
+{"PAQ",-5.656816682},
+{"CNA",-5.657091681},
+{"TYS",-5.657356792},
+{"ICN",-5.657717395},
+{"AWH",-5.659019486},
+{"CSI",-5.660482604},
+{"BTI",-5.661332305},
+{"DBU",-5.661573239},
+{"JOC",-5.662003227},
+{"DUF",-5.662231885},
+{"ZEK",-5.662939061},
+{"CYM",-5.663838734},
+{"FAK",-5.664071321},
+{"VEF",-5.664089659},
+{"MSA",-5.664756344},
+{"IIN",-5.665479432},
+{"EFY",-5.665948124},
+{"EWF",-5.666340799},
+{"MRI",-5.666820418},
+{"ZHA",-5.666966339},
+{"VEE",-5.666989991},
+{"DYA",-5.667026722},
+{"ZGE",-5.667142125},
+{"AKY",-5.668593633},
+{"EJA",-5.668908062},
+{"AEU",-5.668962726},
+{"UGN",-5.669682215},
+{"GNP",-5.669812166},
+{"VAJ",-5.670726593},
+{"NGY",-5.672263234},
+{"KSG",-5.672742816},
+{"MOY",-5.674145844},
+{"JIL",-5.674619095},
+{"WST",-5.674847543},
+{"HIH",-5.674975327},
+{"BGR",-5.675037029},
+{"SDU",-5.675115884},
+{"WYO",-5.675123623},
+{"ARZ",-5.675191715},
+{"RNL",-5.675357826},
+{"RGS",-5.675560675},
+{"WDI",-5.675607553},
+{"UKI",-5.677166908},
+{"PIZ",-5.677436587},
+{"EPY",-5.677802532},
+{"MCM",-5.677890664},
+{"CKF",-5.677982464},
+{"MNL",-5.6781603},
+{"IMF",-5.678417172},
+{"PEY",-5.678937895},
+{"LXX",-5.679941592},
+{"RIJ",-5.680134305},
+{"ZEP",-5.680479619},
+{"ISJ",-5.680551036},
+{"VIU",-5.681031025},
+{"CUC",-5.681031621},
+{"JAU",-5.682814482},
+{"YUN",-5.683799604},
+{"NKY",-5.684217067},
+{"NSS",-5.684621114},
+{"KOK",-5.684667278},
+{"ETF",-5.685096302},
+{"OOG",-5.685523042},
+{"KSM",-5.685588368},
+{"ZMA",-5.685731098},
+{"MLA",-5.68611857},
+{"DIK",-5.686514233},
+{"SHV",-5.688198218},
+{"HVI",-5.688198218},
+{"AXY",-5.688668747},
+{"AQI",-5.688926653},
+{"MYL",-5.689009082},
+{"UDW",-5.689060368},
+{"EIK",-5.68959655},
+{"OPF",-5.689597765},
+{"BYI",-5.690458438},
+{"OOC",-5.690767882},
+{"EGH",-5.691029985},
+{"AOT",-5.691992081},
+{"PYT",-5.692025488},
+{"IPB",-5.692339006},
+{"IEK",-5.692648875},
+{"UDR",-5.692688964},
+{"ONB",-5.692824556},
+{"GOP",-5.692938348},
+{"WSU",-5.693115473},
+{"TVI",-5.693545365},
+{"EHM",-5.694238297},
+{"YAK",-5.69525494},
+{"NSN",-5.695724347},
+{"XML",-5.695945263},
+{"BWE",-5.697265082},
+{"DAE",-5.697418405},
+{"KTA",-5.698315504},
+{"ZZO",-5.698439116},
+{"MPY",-5.698879073},
+{"RSL",-5.699623174},
+{"LLT",-5.700546241},
+{"RDB",-5.701289876},
+{"OOO",-5.703098285},
+{"ZOA",-5.70399548},
+{"AJI",-5.704579998},
+{"ENP",-5.706150847},
+{"UAE",-5.706281867},
+{"LNA",-5.70700809},
+{"KTH",-5.707429274},
+{"EKA",-5.708797218},
+{"OUA",-5.709340643},
+{"KUM",-5.709978154},
+{"WKE",-5.710611499},
+{"IYA",-5.710661679},
+{"PCO",-5.710733558},
+{"ODC",-5.711774148},
+{"GWO",-5.712219295},
+{"AIP",-5.712264325},
+{"HHE",-5.713185703},
+{"BYA",-5.713466297},
+{"CAO",-5.714238946},
+{"GHU",-5.714410499},
+{"BSY",-5.71508493},
+{"DSA",-5.715339778},
+{"YLY",-5.715342572},
+{"PBU",-5.716097145},
+{"IOI",-5.71721544},
+{"ILC",-5.717512259},
+{"NAO",-5.717595651},
+{"GAO",-5.718153343},
+{"BEZ",-5.718707418},
+{"HAA",-5.719325973},
+{"GKO",-5.719927923},
+{"KTI",-5.720185847},
+{"IVR",-5.720957055},
+{"OGH",-5.72124653},
+{"RZE",-5.721577952},
+{"GGO",-5.721681649},
+{"GAW",-5.721780571},
+{"DBI",-5.722071359},
+{"BIF",-5.722491791},
+{"GYR",-5.722606635},
+{"KWI",-5.722857297},
+{"LDC",-5.723037103},
+{"ZAS",-5.723329938},
+{"NGB",-5.723431316},
+{"RKY",-5.723451901},
+{"OUM",-5.723473473},
+{"JUX",-5.724310666},
+{"GMU",-5.724409969},
+{"EEW",-5.724538383},
+{"KPI",-5.725979225},
+{"CUD",-5.726499383},
+{"CNE",-5.726500044},
+{"SHC",-5.726677283},
+{"SSB",-5.727185687},
+{"LOH",-5.727387182},
+{"MRN",-5.727740688},
+{"EYD",-5.727977624},
+{"RNY",-5.728457867},
+{"XLI",-5.7285168},
+{"OAF",-5.728637237},
+{"IEZ",-5.729151936},
+{"ZIA",-5.729400412},
+{"RKU",-5.730185058},
+{"KAZ",-5.731025274},
+{"HUI",-5.731584983},
+{"AMW",-5.73344108},
+{"ZIP",-5.733688772},
+{"YUA",-5.733785645},
+{"KAW",-5.733921574},
+{"AMD",-5.734207925},
+{"UNV",-5.735064065},
+{"OJA",-5.735350158},
+{"MHO",-5.735742759},
+{"YFI",-5.735947702},
+{"STB",-5.736119369},
+{"EZZ",-5.736790909},
+{"OEA",-5.736956245},
+{"ZEB",-5.73701476},
+{"YAW",-5.737722764},
+{"ZEE",-5.738072216},
+{"EYR",-5.73870913},
+{"ZHO",-5.740207971},
+{"GUP",-5.740838454},
+{"UJI",-5.740906271},
+{"PAO",-5.741623964},
+{"DII",-5.743132344},
+{"PUI",-5.743766286},
+{"TDE",-5.743770187},
+{"XUD",-5.743981249},
+{"AYG",-5.744238129},
+{"ACP",-5.744459877},
+{"MNO",-5.744469761},
+{"XOG",-5.744787651},
+{"ZAG",-5.744922581},
+{"YAD",-5.745214669},
+{"BEM",-5.745313803},
+{"KOW",-5.74549359},
+{"SKT",-5.746025558},
+{"KEU",-5.746049549},
+{"YOP",-5.747019886},
+{"UFO",-5.747050985},
+{"MCH",-5.74706694},
+{"IAO",-5.747709319},
+{"UBY",-5.7482985},
+{"WUR",-5.74993478},
+{"SVA",-5.750009854},
+{"BDE",-5.750117307},
+{"XCO",-5.750508694},
+{"NBL",-5.751545358},
+{"UWA",-5.752403628},
+{"OIX",-5.752556049},
+{"HMU",-5.753914628},
+{"ZAK",-5.753955739},
+{"RBR",-5.754946867},
+{"TSW",-5.755548195},
+{"AWM",-5.755995962},
+{"TFL",-5.756252138},
+{"LDT",-5.757581717},
+{"AWD",-5.757747104},
+{"BCL",-5.757948712},
+{"CYB",-5.758356241},
+{"FAW",-5.758572971},
+{"MEF",-5.758580926},
+{"TFE",-5.759068082},
+{"PKE",-5.759717522},
+{"KPO",-5.7605809},
+{"KSP",-5.760648055},
+{"ZRA",-5.760728702},
+{"IIR",-5.761576761},
+{"SAO",-5.761755876},
+{"LND",-5.762507337},
+{"ELW",-5.76276103},
+{"NUP",-5.762800949},
+{"PHD",-5.763288784},
+{"OWF",-5.763647303},
+{"LDU",-5.764113122},
+{"KUW",-5.764923126},
+{"OIG",-5.765039274},
+{"JAD",-5.765490908},
+{"BSP",-5.765941442},
+{"TOZ",-5.766459295},
+{"ADP",-5.766893045},
+{"OKK",-5.766988902},
+{"EHU",-5.767773368},
+{"LNS",-5.767915269},
+{"JOV",-5.76830106},
+{"GMS",-5.768482485},
+{"FOD",-5.76889966},
+{"UHR",-5.768927381},
+{"YRN",-5.769534759},
+{"HCA",-5.770227979},
+{"HTR",-5.770329087},
+{"UON",-5.770382395},
+{"PRY",-5.770431805},
+{"AHW",-5.771587041},
+{"RMN",-5.77173056},
+{"KNU",-5.77199668},
+{"UOS",-5.772020558},
+{"RZA",-5.772152216},
+{"DCU",-5.772246422},
+{"NWR",-5.773006208},
+{"LTM",-5.773090657},
+{"OWP",-5.773196608},
+{"WOF",-5.773304674},
+{"VIX",-5.774122914},
+{"HTA",-5.774192565},
+{"EVR",-5.774333747},
+{"KOO",-5.775885836},
+{"OTP",-5.776544234},
+{"SOJ",-5.776871145},
+{"DYK",-5.777406791},
+{"XET",-5.778392578},
+{"OHR",-5.779033758},
+{"UMC",-5.779182872},
+{"XIG",-5.779417102},
+{"NYH",-5.779545291},
+{"MAF",-5.780069403},
+{"HIJ",-5.781901525},
+{"SOH",-5.78193109},
+{"ANM",-5.7822083},
+{"HPL",-5.782794507},
+{"HFI",-5.782956722},
+{"UTZ",-5.783526336},
+{"AZU",-5.784252096},
+{"OZI",-5.784719126},
+{"DSL",-5.785497532},
+{"RTB",-5.786896436},
+{"IIL",-5.787237704},
+{"DHU",-5.787255587},
+{"RJU",-5.787538755},
+{"EZR",-5.787922317},
+{"OEI",-5.787964363},
+{"GSO",-5.789959681},
+{"BNI",-5.790009455},
+{"ACB",-5.790383964},
+{"AMT",-5.790457422},
+{"LSS",-5.790877461},
+{"KDA",-5.791070487},
+{"RJO",-5.79136947},
+{"HTW",-5.791481514},
+{"DEK",-5.791762839},
+{"ISV",-5.792056015},
+{"YMS",-5.792325779},
+{"LIJ",-5.792442691},
+{"FAH",-5.793530407},
+{"BBC",-5.793593461},
+{"YSH",-5.794323751},
+{"EEG",-5.794476146},
+{"ZEU",-5.79453031},
+{"LQU",-5.795243834},
+{"LZH",-5.797177965},
+{"EEX",-5.798166022},
+{"LOK",-5.798621836},
+{"MPK",-5.799017532},
+{"ZAA",-5.799643331},
+{"TZI",-5.799693183},
+{"EOW",-5.799738864},
+{"SGE",-5.800741537},
+{"YSL",-5.800779216},
+{"MEZ",-5.802055449},
+{"ZTE",-5.80210256},
+{"AOI",-5.802230142},
+{"OCS",-5.802675657},
+{"JED",-5.802686432},
+{"SIQ",-5.802761082},
+{"DGW",-5.802944474},
+{"YFR",-5.803407177},
+{"ESW",-5.805031652},
+{"UEF",-5.805047639},
+{"AZT",-5.805663934},
+{"SMY",-5.805673329},
+{"SPP",-5.805708527},
+{"ZUL",-5.806504435},
+{"IJU",-5.80693777},
+{"BIH",-5.807321593},
+{"CZA",-5.808073095},
+{"CBS",-5.808469243},
+{"XUL",-5.808916809},
+{"KUO",-5.809074013},
+{"UZA",-5.809983283},
+{"OUF",-5.810072698},
+{"MII",-5.810386396},
+{"RFS",-5.810811573},
+{"CBE",-5.811028805},
+{"EQS",-5.811674313},
+{"GEH",-5.812159847},
+{"BAX",-5.812583672},
+{"NHY",-5.813057304},
+{"IIS",-5.813147757},
+{"OXO",-5.813341919},
+{"CPU",-5.813702601},
+{"RZO",-5.814440661},
+{"RLF",-5.814477793},
+{"ABW",-5.815086532},
+{"DOY",-5.81518593},
+{"EIE",-5.81539616},
+{"GHD",-5.815630456},
+{"RND",-5.816045758},
+{"UFM",-5.816287862},
+{"VAM",-5.81672198},
+{"MDE",-5.81812879},
+{"LEZ",-5.818389498},
+{"OIM",-5.818578385},
+{"GBY",-5.818687857},
+{"BWA",-5.819794758},
+{"IVU",-5.821333645},
+{"KPA",-5.82172533},
+{"OWO",-5.822204094},
+{"UMV",-5.823420891},
+{"MUI",-5.82423919},
+{"LYB",-5.824583194},
+{"TCL",-5.82549675},
+{"GUJ",-5.825699977},
+{"LNT",-5.8257385},
+{"WDO",-5.825783401},
+{"GSB",-5.826065943},
+{"KOB",-5.826116981},
+{"CKD",-5.827217418},
+{"MEP",-5.827693508},
+{"RPM",-5.827826885},
+{"IEH",-5.828110481},
+{"YBA",-5.829145309},
+{"WSI",-5.829260272},
+{"SHK",-5.829271868},
+{"SAE",-5.829731475},
+{"AYU",-5.830263259},
+{"ORV",-5.830275021},
+{"MAA",-5.830350225},
+{"MSI",-5.830869445},
+{"CGI",-5.831255655},
+{"CNS",-5.833719581},
+{"HBU",-5.835117778},
+{"URZ",-5.83535942},
+{"TYF",-5.83564968},
+{"RKB",-5.835740143},
+{"SST",-5.835902683},
+{"BEK",-5.835957302},
+{"AXL",-5.836366383},
+{"KHR",-5.836430293},
+{"HCH",-5.836430293},
+{"BTU",-5.837273925},
+{"JOG",-5.838060459},
+{"YEI",-5.838958694},
+{"CFA",-5.839184472},
+{"BIM",-5.839380766},
+{"TVA",-5.83947158},
+{"EUB",-5.839491462},
+{"CPH",-5.840184738},
+{"LVO",-5.841006994},
+{"HUY",-5.84141842},
+{"ABJ",-5.841767827},
+{"UOM",-5.841797448},
+{"FTN",-5.84229009},
+{"SOZ",-5.843557929},
+{"CMA",-5.845179759},
+{"YID",-5.845546421},
+{"THT",-5.846458109},
+{"EUI",-5.846948794},
+{"LFG",-5.847464216},
+{"AMH",-5.847506176},
+{"UXL",-5.848122634},
+{"HUX",-5.848122634},
+{"EZA",-5.848482444},
+{"KCA",-5.849225778},
+{"PWR",-5.849500429},
+{"YEW",-5.850013468},
+{"USD",-5.850172937},
+{"EVS",-5.850442614},
+{"FIJ",-5.851178881},
+{"KUA",-5.852006781},
+{"OOZ",-5.852832279},
+{"PUA",-5.853267026},
+{"HTT",-5.853809076},
+{"APN",-5.854540563},
+{"VIP",-5.85462083},
+{"SEZ",-5.854770443},
+{"MUZ",-5.855843392},
+{"JEU",-5.85584562},
+{"VOO",-5.856136975},
+{"FAG",-5.856206686},
+{"CSO",-5.856584863},
+{"TCP",-5.85674855},
+{"PAH",-5.856887732},
+{"TPE",-5.857176957},
+{"YUR",-5.857251305},
+{"LLC",-5.857775826},
+{"OYB",-5.857929963},
+{"FDA",-5.85798623},
+{"ZBE",-5.858334292},
+{"KOM",-5.85845665},
+{"NJI",-5.859030355},
+{"LFF",-5.860022858},
+{"XEG",-5.860238104},
+{"VUS",-5.860249657},
+{"GDE",-5.861176234},
+{"MYA",-5.861813322},
+{"ZWI",-5.862531881},
+{"SJU",-5.862642},
+{"IKK",-5.863043493},
+{"OIA",-5.863306627},
+{"BAJ",-5.863829138},
+{"UWE",-5.864030691},
+{"PIM",-5.864493768},
+{"MHZ",-5.864563772},
+{"ERQ",-5.865532261},
+{"WNF",-5.865805874},
+{"OYH",-5.865905578},
+{"MWO",-5.865942365},
+{"GOY",-5.866772875},
+{"NKM",-5.866956903},
+{"ULW",-5.86723416},
+{"NTN",-5.867477267},
+{"ZVO",-5.868569113},
+{"JIT",-5.86860475},
+{"LSC",-5.868668383},
+{"IAV",-5.869268615},
+{"UIB",-5.869380762},
+{"BOK",-5.869381682},
+{"TPR",-5.87084332},
+{"TCU",-5.871174148},
+{"KAF",-5.871365593},
+{"MAV",-5.871822694},
+{"AYH",-5.871832864},
+{"WKS",-5.872273489},
+{"MIP",-5.873072935},
+{"IPW",-5.873718133},
+{"EZO",-5.873740575},
+{"HBE",-5.875139339},
+{"IDR",-5.875964461},
+{"HOY",-5.876097958},
+{"ODP",-5.876321635},
+{"OWC",-5.876813131},
+{"YEM",-5.87698899},
+{"VAA",-5.877782955},
+{"AVS",-5.879237297},
+{"JIG",-5.879906796},
+{"MSB",-5.8804184},
+{"XUB",-5.880856656},
+{"ZOD",-5.881838558},
+{"KUH",-5.88185685},
+{"SCY",-5.882152466},
+{"JAL",-5.882547145},
+{"WNY",-5.883404516},
+{"ATV",-5.883500271},
+{"EGF",-5.883970014},
+{"TSD",-5.884085389},
+{"RAA",-5.884191124},
+{"FGA",-5.884836394},
+{"KKA",-5.885341443},
+{"BHU",-5.885929049},
+{"MHE",-5.886405092},
+{"LWI",-5.886737469},
+{"PBR",-5.88692904},
+{"BUQ",-5.889517697},
+{"DEJ",-5.89079232},
+{"HYN",-5.891754056},
+{"RFR",-5.891874584},
+{"GMO",-5.892383365},
+{"RCS",-5.893960316},
+{"KBU",-5.894375453},
+{"UVO",-5.89470002},
+{"IOB",-5.894976718},
+{"DCO",-5.895097982},
+{"HNU",-5.895275061},
+{"PCR",-5.895541385},
+{"GWI",-5.895836045},
+{"NRU",-5.896934886},
+{"OUQ",-5.898622876},
+{"KOP",-5.898637299},
+{"KSB",-5.898641233},
+{"OGD",-5.89981606},
+{"TGU",-5.900478567},
+{"NBI",-5.901379539},
+{"DFR",-5.901751479},
+{"WSK",-5.902112999},
+{"ZWE",-5.902984756},
+{"GTI",-5.903272252},
+{"AVR",-5.90329147},
+{"VRI",-5.904611548},
+{"BSA",-5.90469963},
+{"AVU",-5.904812168},
+{"SKO",-5.9049106},
+{"MRO",-5.905195713},
+{"FCA",-5.905294565},
+{"ZAI",-5.905318366},
+{"HSC",-5.905775833},
+{"ITD",-5.906435319},
+{"KBA",-5.906623928},
+{"UFU",-5.906938904},
+{"LSD",-5.907545951},
+{"HPU",-5.908272144},
+{"BPO",-5.908345048},
+{"ZZE",-5.908776689},
+{"XLV",-5.908894484},
+{"UDH",-5.909132689},
+{"NYD",-5.909208424},
+{"SNY",-5.909208424},
+{"STG",-5.909310714},
+{"PAZ",-5.909444785},
+{"UCS",-5.910288465},
+{"LSY",-5.91125526},
+{"KOD",-5.911366978},
+{"SOK",-5.912189377},
+{"RLT",-5.912491833},
+{"UEG",-5.912527708},
+{"UBH",-5.913055354},
+{"MFI",-5.913073824},
+{"WYA",-5.913220926},
+{"GBO",-5.913464739},
+{"GKI",-5.913502051},
+{"BAE",-5.914092871},
+{"ACN",-5.914868896},
+{"LWE",-5.915554787},
+{"SHF",-5.915813725},
+{"AUZ",-5.915899503},
+{"NBY",-5.916176736},
+{"UEP",-5.916994111},
+{"EZV",-5.917668813},
+{"WIX",-5.917878298},
+{"FUJ",-5.918220921},
+{"HCL",-5.918395678},
+{"PMO",-5.919171876},
+{"UBN",-5.919212432},
+{"FOM",-5.919815551},
+{"BAA",-5.920385216},
+{"ZIR",-5.920671364},
+{"DCL",-5.921103183},
+{"AFN",-5.921844643},
+{"YEO",-5.922699616},
+{"STD",-5.92398333},
+{"ULR",-5.924040499},
+{"UBW",-5.924257254},
+{"NDD",-5.924828252},
+{"UFI",-5.924927497},
+{"VEW",-5.926940956},
+{"NUX",-5.927088807},
+{"NMR",-5.927308315},
+{"USQ",-5.92762184},
+{"IIB",-5.927632704},
+{"HYC",-5.927709808},
+{"AGY",-5.928118337},
+{"UKU",-5.928245183},
+{"VRA",-5.929342016},
+{"LKW",-5.929426462},
+{"YLC",-5.930272532},
+{"VUM",-5.930389956},
+{"HUH",-5.930676775},
+{"TAA",-5.930739421},
+{"GWE",-5.930826433},
+{"PIF",-5.930905696},
+{"IMR",-5.931225539},
+{"LSB",-5.93156719},
+{"FII",-5.932348357},
+{"KUS",-5.932355619},
+{"CSF",-5.932455713},
+{"RYC",-5.93258135},
+{"MSK",-5.93315613},
+{"LEK",-5.933175474},
+{"UFL",-5.933424183},
+{"RLU",-5.933691513},
+{"IHU",-5.934494137},
+{"NLU",-5.934494849},
+{"FCC",-5.934729532},
+{"RII",-5.935117446},
+{"DSU",-5.935275241},
+{"MVE",-5.937058829},
+{"RMH",-5.937169685},
+{"LDV",-5.937473206},
+{"HBY",-5.938069577},
+{"FDI",-5.938874047},
+{"ESV",-5.93913036},
+{"YHE",-5.940148291},
+{"HKE",-5.940799821},
+{"AGP",-5.940949035},
+{"TZM",-5.941672888},
+{"APK",-5.943003123},
+{"POA",-5.943737138},
+{"GYA",-5.944173411},
+{"UIX",-5.944586619},
+{"VEZ",-5.944781613},
+{"PPH",-5.946134767},
+{"EXY",-5.946909267},
+{"YRR",-5.947023765},
+{"DOA",-5.947240204},
+{"SJO",-5.947697812},
+{"IGY",-5.948297742},
+{"DBR",-5.94835949},
+{"RKW",-5.949414233},
+{"OLH",-5.949496777},
+{"YGA",-5.95014847},
+{"XYS",-5.95250262},
+{"HPI",-5.953276488},
+{"HBR",-5.953365905},
+{"IEP",-5.953499042},
+{"RSM",-5.953776977},
+{"SOG",-5.953791678},
+{"EIO",-5.95447837},
+{"DGR",-5.955381269},
+{"WWW",-5.955552021},
+{"ZAP",-5.955832956},
+{"UIF",-5.957246739},
+{"PHN",-5.957431738},
+{"AAT",-5.957687227},
+{"CII",-5.958690359},
+{"YBD",-5.959383527},
+{"LLD",-5.959695625},
+{"IPY",-5.959883747},
+{"ZHU",-5.960532325},
+{"ZOS",-5.961456245},
+{"KBE",-5.961723968},
+{"NTP",-5.962083656},
+{"ITB",-5.962887534},
+{"HCE",-5.96387305},
+{"GFR",-5.963995349},
+{"WOW",-5.964417945},
+{"UPC",-5.96464056},
+{"WNR",-5.96474189},
+{"GTE",-5.964763839},
+{"WPE",-5.965068751},
+{"EOB",-5.966761398},
+{"JOT",-5.966800131},
+{"UAW",-5.967249845},
+{"JAF",-5.967761904},
+{"TEZ",-5.968368281},
+{"LMM",-5.969154966},
+{"LFS",-5.969263334},
+{"BAW",-5.969916425},
+{"UYA",-5.970201206},
+{"MPM",-5.970373246},
+{"YTT",-5.970456198},
+{"BOP",-5.970485786},
+{"HDE",-5.970497777},
+{"ZBU",-5.971442585},
+{"ELQ",-5.972396057},
+{"KAO",-5.972663809},
+{"VRO",-5.973115165},
+{"DAF",-5.973284665},
+{"AAA",-5.973938768},
+{"AIU",-5.973942472},
+{"AMR",-5.97422737},
+{"DTA",-5.974703005},
+{"MIB",-5.975443159},
+{"WOT",-5.975632358},
+{"UIG",-5.975747052},
+{"WNH",-5.976279426},
+{"IOF",-5.976384097},
+{"ILP",-5.977638583},
+{"NOH",-5.977640156},
+{"DPE",-5.978290618},
+{"CAJ",-5.97921131},
+{"HRS",-5.979497514},
+{"DYM",-5.979857807},
+{"MOF",-5.97999082},
+{"URQ",-5.980457378},
+{"SSC",-5.981538379},
+{"TIH",-5.98156278},
+{"OTG",-5.981642936},
+{"DLB",-5.981820563},
+{"SKL",-5.982019313},
+{"IMY",-5.982169677},
+{"JIB",-5.982196697},
+{"WSW",-5.982715955},
+{"LLL",-5.982830546},
+{"IGB",-5.983237627},
+{"ASW",-5.983277858},
+{"KII",-5.983279451},
+{"EKK",-5.983281244},
+{"BDA",-5.984003455},
+{"DHY",-5.984202409},
+{"UHN",-5.98436651},
+{"GHP",-5.984830799},
+{"NKO",-5.984901365},
+{"UOL",-5.986081692},
+{"CTH",-5.987647727},
+{"MMS",-5.988041429},
+{"HBA",-5.988662496},
+{"AOU",-5.989908514},
+{"RUH",-5.990486489},
+{"GEG",-5.990817714},
+{"MEU",-5.990911354},
+{"AIF",-5.991426734},
+{"HOH",-5.991678663},
+{"KSI",-5.992159378},
+{"ASD",-5.992174828},
+{"YMU",-5.992471131},
+{"SVO",-5.993136669},
+{"CKR",-5.993672649},
+{"KUB",-5.993771396},
+{"AKK",-5.993835062},
+{"AHS",-5.994117593},
+{"RMC",-5.994159458},
+{"LEJ",-5.994214194},
+{"CCP",-5.994526609},
+{"RUO",-5.99561333},
+{"QIN",-5.995674808},
+{"STV",-5.996156276},
+{"OOE",-5.996682646},
+{"RSS",-5.997903304},
+{"MCP",-5.997931526},
+{"VOD",-5.998641187},
+{"GSL",-5.999226984},
+{"YSC",-5.999492784},
+{"EKH",-5.999494852},
+{"DEY",-6.000072486},
+{"SPN",-6.001080633},
+{"AAM",-6.001120268},
+{"KDR",-6.00163711},
+{"WAC",-6.001989221},
+{"KIO",-6.002732836},
+{"AMF",-6.003131911},
+{"NDG",-6.00332147},
+{"IUL",-6.003836763},
+{"LDY",-6.004023287},
+{"HDI",-6.005286573},
+{"SSS",-6.00536641},
+{"WBU",-6.005784275},
+{"CPA",-6.005904908},
+{"OAV",-6.00609946},
+{"LKH",-6.006457941},
+{"GFE",-6.006464244},
+{"EAE",-6.007369651},
+{"IUD",-6.007569283},
+{"FST",-6.007725389},
+{"BPA",-6.008759083},
+{"HII",-6.008921745},
+{"HRH",-6.009177479},
+{"UKH",-6.01080502},
+{"GEF",-6.01099987},
+{"UML",-6.011002842},
+{"LAA",-6.011134915},
+{"CDS",-6.011439982},
+{"EWY",-6.012156117},
+{"CPS",-6.012292587},
+{"TTP",-6.012343481},
+{"PLC",-6.01566104},
+{"ZOE",-6.016223207},
+{"AIX",-6.016610792},
+{"BEO",-6.01681558},
+{"IJO",-6.016868083},
+{"BSB",-6.017424274},
+{"DYC",-6.018540959},
+{"DPI",-6.018736933},
+{"DNO",-6.018958943},
+{"FCO",-6.01928081},
+{"KOF",-6.021314207},
+{"KSA",-6.021506},
+{"WOB",-6.021865024},
+{"NYE",-6.022424386},
+{"MPF",-6.022468417},
+{"ATW",-6.023286186},
+{"KBI",-6.023400857},
+{"HSA",-6.024205065},
+{"FAO",-6.024230016},
+{"OBN",-6.024302467},
+{"EHL",-6.024930523},
+{"HAJ",-6.025948247},
+{"DHR",-6.026024502},
+{"MBN",-6.026236197},
+{"LZA",-6.026427537},
+{"DTI",-6.026883352},
+{"EHT",-6.026888637},
+{"XOP",-6.026931361},
+{"EYC",-6.027776561},
+{"EDC",-6.02785049},
+{"UYL",-6.028885928},
+{"UGB",-6.029266164},
+{"UEH",-6.029438021},
+{"ELN",-6.029780609},
+{"YUK",-6.029809651},
+{"PYE",-6.029919405},
+{"BBU",-6.030322965},
+{"OLW",-6.030479032},
+{"PYA",-6.030690688},
+{"EKN",-6.030787334},
+{"PRC",-6.030952014},
+{"RVY",-6.031168794},
+{"NBC",-6.031802411},
+{"GYL",-6.03194631},
+{"APB",-6.032119232},
+{"AJP",-6.032179637},
+{"ISW",-6.034513992},
+{"YBI",-6.034817996},
+{"YUC",-6.035210422},
+{"LLK",-6.037579224},
+{"YSU",-6.037926491},
+{"OEY",-6.038060685},
+{"AVL",-6.038199893},
+{"MWA",-6.038511239},
+{"HTU",-6.03861213},
+{"SDR",-6.039013662},
+{"PCS",-6.039140491},
+{"YDO",-6.039172204},
+{"OSG",-6.040729669},
+{"EPW",-6.041028047},
+{"OVS",-6.041199616},
+{"PIQ",-6.04120781},
+{"DGK",-6.041325492},
+{"LSU",-6.04161904},
+{"WAZ",-6.041628608},
+{"TDA",-6.041648428},
+{"OLZ",-6.041878821},
+{"FOY",-6.042334725},
+{"AIB",-6.042684674},
+{"CEK",-6.042760043},
+{"ZUK",-6.043455878},
+{"BTY",-6.043800093},
+{"CME",-6.044213786},
+{"RUX",-6.044976692},
+{"DKA",-6.045638841},
+{"ISZ",-6.045731052},
+{"PFA",-6.045957639},
+{"UEM",-6.046100552},
+{"KKI",-6.046431667},
+{"MLO",-6.046506767},
+{"ULZ",-6.046859635},
+{"WSB",-6.047096962},
+{"DVD",-6.047137799},
+{"EDH",-6.047736477},
+{"INX",-6.047749415},
+{"MCF",-6.048031848},
+{"NPE",-6.049253601},
+{"KHZ",-6.049480642},
+{"GHF",-6.050852365},
+{"LCR",-6.053107539},
+{"LBL",-6.053228022},
+{"TRL",-6.053641431},
+{"LLR",-6.055687569},
+{"OPC",-6.056774652},
+{"VYI",-6.05707246},
+{"BCE",-6.057128174},
+{"AYC",-6.057676963},
+{"KOE",-6.057967112},
+{"LUZ",-6.058403527},
+{"GFO",-6.058666914},
+{"HRM",-6.058851996},
+{"PFI",-6.058879729},
+{"STT",-6.059178036},
+{"HKI",-6.059193218},
+{"LLH",-6.059719448},
+{"TYC",-6.06069336},
+{"OAB",-6.060749065},
+{"MSP",-6.061425231},
+{"RTT",-6.061720758},
+{"FTC",-6.062090988},
+{"UAV",-6.062243612},
+{"QUR",-6.062642024},
+{"OOI",-6.063076223},
+{"CEW",-6.063144204},
+{"LFH",-6.06351517},
+{"TBI",-6.063810685},
+{"TTV",-6.063856481},
+{"YSB",-6.065458996},
+{"ZIC",-6.065864465},
+{"AOM",-6.066293943},
+{"EYF",-6.066386063},
+{"VIM",-6.066744603},
+{"RNP",-6.067449517},
+{"UYT",-6.067712643},
+{"ITK",-6.067763933},
+{"AKB",-6.067827327},
+{"VLO",-6.067955354},
+{"AEF",-6.06859557},
+{"RLW",-6.069246198},
+{"DOF",-6.069584513},
+{"TEK",-6.069590587},
+{"COZ",-6.069593259},
+{"LMY",-6.069970751},
+{"DUV",-6.070257309},
+{"WAA",-6.0707389},
+{"RYG",-6.071195175},
+{"YVE",-6.071813568},
+{"HDO",-6.07193618},
+{"BNA",-6.07220375},
+{"YOD",-6.072519182},
+{"LPY",-6.073432779},
+{"JEM",-6.074475072},
+{"LZE",-6.074479495},
+{"CRC",-6.074991377},
+{"UEI",-6.075036152},
+{"DTE",-6.075584163},
+{"GDR",-6.075706119},
+{"KUT",-6.075780049},
+{"SDS",-6.076003639},
+{"YCK",-6.076377368},
+{"YGM",-6.07668745},
+{"RSF",-6.076830962},
+{"ITW",-6.076929793},
+{"LOZ",-6.076952033},
+{"YEH",-6.0772603},
+{"WYC",-6.078058805},
+{"TKE",-6.078309847},
+{"NKH",-6.078632723},
+{"SGA",-6.078944916},
+{"BAO",-6.078952116},
+{"CAW",-6.078964529},
+{"YEU",-6.079248391},
+{"LUW",-6.080535917},
+{"OVT",-6.081740062},
+{"HDU",-6.082010993},
+{"WNP",-6.082280592},
+{"CDN",-6.083161331},
+{"GPS",-6.083524965},
+{"LFC",-6.083754086},
+{"UJE",-6.084077268},
+{"RIY",-6.084316231},
+{"HFA",-6.085082503},
+{"RUY",-6.085108187},
+{"FUK",-6.08548278},
+{"DRS",-6.085522853},
+{"KIB",-6.085690243},
+{"BUH",-6.085869048},
+{"OOH",-6.087384149},
+{"MUK",-6.087431233},
+{"FEY",-6.087522632},
+{"OAQ",-6.088729828},
+{"TZU",-6.089371939},
+{"GZA",-6.090183366},
+{"IGZ",-6.090183366},
+{"RGM",-6.090530493},
+{"RDH",-6.090862587},
+{"KHI",-6.091762966},
+{"SPB",-6.092195301},
+{"IKU",-6.092494349},
+{"HSH",-6.092586051},
+{"CEH",-6.092633958},
+{"TTM",-6.092893572},
+{"USG",-6.093020487},
+{"DCS",-6.093096142},
+{"YRT",-6.093775313},
+{"UZU",-6.094403323},
+{"NPI",-6.09516365},
+{"LFL",-6.09531237},
+{"ZID",-6.096730983},
+{"ETM",-6.097099692},
+{"GUC",-6.097670061},
+{"GOF",-6.097980167},
+{"LNC",-6.097994173},
+{"FIZ",-6.098015962},
+{"FKA",-6.098019853},
+{"OEO",-6.098037752},
+{"PAX",-6.098711711},
+{"EIU",-6.099374747},
+{"GUB",-6.099642849},
+{"AJU",-6.100185545},
+{"HSU",-6.100763378},
+{"QUY",-6.101168972},
+{"ZOM",-6.101372041},
+{"QUH",-6.102390913},
+{"PWI",-6.103908071},
+{"YUS",-6.104416638},
+{"AFY",-6.105446908},
+{"ZIB",-6.105928222},
+{"TWR",-6.106478835},
+{"ODK",-6.106537559},
+{"IDP",-6.107316268},
+{"RDC",-6.107409564},
+{"XAV",-6.107625916},
+{"SZT",-6.107695935},
+{"EYH",-6.108199931},
+{"AZL",-6.109060915},
+{"OCQ",-6.110176429},
+{"DGS",-6.110581836},
+{"WCH",-6.110637645},
+{"BPS",-6.110702009},
+{"HYO",-6.111311132},
+{"NGZ",-6.111565296},
+{"UOV",-6.111680924},
+{"ZIT",-6.11184746},
+{"OKM",-6.112714908},
+{"FTP",-6.113437315},
+{"RDP",-6.114060786},
+{"CGO",-6.114359928},
+{"KAC",-6.114426462},
+{"CHH",-6.114574113},
+{"DBL",-6.115522102},
+{"SUK",-6.115612045},
+{"KVI",-6.116166697},
+{"JOD",-6.116382045},
+{"AOC",-6.11661564},
+{"PYO",-6.117148804},
+{"HRL",-6.117475582},
+{"PFE",-6.117661454},
+{"LTL",-6.117912303},
+{"SYT",-6.118038053},
+{"ECG",-6.119061435},
+{"OJI",-6.119726033},
+{"HGO",-6.119894865},
+{"DOH",-6.120269858},
+{"TPH",-6.12037936},
+{"WDR",-6.120706393},
+{"AMC",-6.120987449},
+{"AON",-6.121150206},
+{"RPN",-6.121670343},
+{"PBS",-6.123543059},
+{"UHL",-6.123952331},
+{"LXI",-6.124858671},
+{"SUV",-6.125310341},
+{"FDO",-6.125403439},
+{"OKB",-6.125422779},
+{"BJO",-6.125601857},
+{"WBR",-6.126524668},
+{"AFK",-6.127666018},
+{"AHY",-6.12778129},
+{"GEY",-6.127934942},
+{"TAJ",-6.128188739},
+{"GIP",-6.12825965},
+{"MPG",-6.128723782},
+{"YWE",-6.129126822},
+{"OFR",-6.129661349},
+{"RYK",-6.129747571},
+{"BMS",-6.129901361},
+{"KFI",-6.130209106},
+{"CSS",-6.130498339},
+{"DNS",-6.131015526},
+{"CYD",-6.132623321},
+{"WDY",-6.133781678},
+{"OAU",-6.135110923},
+{"MEK",-6.135153022},
+{"JPU",-6.135352554},
+{"OBD",-6.13554143},
+{"EQN",-6.135886596},
+{"LOX",-6.136043425},
+{"EPF",-6.136552521},
+{"LYU",-6.136873244},
+{"TZA",-6.137594671},
+{"LEQ",-6.138855},
+{"OFM",-6.138863265},
+{"CMS",-6.139003498},
+{"PCI",-6.139933834},
+{"WMI",-6.140413479},
+{"MAW",-6.140991299},
+{"AOP",-6.141564153},
+{"MIQ",-6.141690346},
+{"GMI",-6.142339957},
+{"EMF",-6.142570123},
+{"CGU",-6.1427475},
+{"ZUN",-6.14413538},
+{"XIF",-6.144287715},
+{"PYG",-6.144293775},
+{"ZOG",-6.144416145},
+{"WUL",-6.144743596},
+{"UBF",-6.144888631},
+{"NOK",-6.145225114},
+{"KYR",-6.145251142},
+{"UMT",-6.145561859},
+{"EZH",-6.146134692},
+{"LSP",-6.146427192},
+{"UFE",-6.146715536},
+{"LRA",-6.147831264},
+{"NTC",-6.148015751},
+{"KHT",-6.149048756},
+{"CBR",-6.149729637},
+{"ESR",-6.149934519},
+{"PDF",-6.150278155},
+{"YEP",-6.151753169},
+{"LGU",-6.151927876},
+{"EPC",-6.152038022},
+{"HPA",-6.152349518},
+{"KIK",-6.152381268},
+{"EOZ",-6.152721844},
+{"JIH",-6.15275627},
+{"TKA",-6.153104502},
+{"OEH",-6.154057016},
+{"EII",-6.154488117},
+{"FHA",-6.154597732},
+{"RSN",-6.154822367},
+{"IFR",-6.155228483},
+{"DIJ",-6.155438937},
+{"TFR",-6.155727996},
+{"USM",-6.155786957},
+{"TQU",-6.156020509},
+{"IAX",-6.156196942},
+{"MDA",-6.156533104},
+{"FHO",-6.157516974},
+{"NNH",-6.158130532},
+{"GPI",-6.158988464},
+{"KHU",-6.159020703},
+{"KBR",-6.159531474},
+{"OKH",-6.15985617},
+{"YGU",-6.160432611},
+{"DYG",-6.160432611},
+{"ZUC",-6.160568602},
+{"RUK",-6.160940248},
+{"EYT",-6.160964836},
+{"LVD",-6.16100172},
+{"BLV",-6.16100172},
+{"LLG",-6.161404353},
+{"IXP",-6.161726548},
+{"LSW",-6.162307884},
+{"DDT",-6.162797845},
+{"POY",-6.163025557},
+{"KHM",-6.16304484},
+{"OWU",-6.163364034},
+{"MIH",-6.164477168},
+{"UZB",-6.164486237},
+{"LDG",-6.164560307},
+{"ONX",-6.165241134},
+{"TYT",-6.165437107},
+{"BEU",-6.165497401},
+{"ECZ",-6.165720774},
+{"SZA",-6.166707473},
+{"AFS",-6.166972817},
+{"ASR",-6.167104485},
+{"YFA",-6.168600027},
+{"PDE",-6.168755391},
+{"PTN",-6.168911115},
+{"CDC",-6.169670079},
+{"HMM",-6.169843577},
+{"FDR",-6.17036326},
+{"AYY",-6.170859945},
+{"AAD",-6.171501876},
+{"ZOT",-6.172501813},
+{"YAP",-6.173081112},
+{"DBM",-6.173407462},
+{"EFC",-6.173437703},
+{"PCB",-6.173753513},
+{"SUH",-6.174180514},
+{"IWO",-6.175330744},
+{"UNZ",-6.175333224},
+{"IGT",-6.175491946},
+{"NNT",-6.175743167},
+{"CPI",-6.175767987},
+{"VEB",-6.175877521},
+{"CGE",-6.175992671},
+{"CKV",-6.176781848},
+{"GUG",-6.177013903},
+{"RMW",-6.177452533},
+{"GNY",-6.177787173},
+{"TII",-6.177959891},
+{"BCA",-6.178207864},
+{"GPA",-6.178476583},
+{"UJO",-6.178840134},
+{"MSD",-6.179385093},
+{"MBD",-6.179465503},
+{"OHU",-6.180038193},
+{"TBS",-6.18036762},
+{"DHD",-6.180760689},
+{"HAQ",-6.181084069},
+{"LMN",-6.181371546},
+{"IRZ",-6.18152463},
+{"KFL",-6.182122711},
+{"IDB",-6.182442381},
+{"MCO",-6.182879277},
+{"GHZ",-6.183634951},
+{"HTC",-6.183719313},
+{"CFR",-6.183844463},
+{"GPO",-6.183947201},
+{"MML",-6.184346689},
+{"KEB",-6.184601187},
+{"YRY",-6.186296574},
+{"AVD",-6.186717002},
+{"VDA",-6.186717002},
+{"SBR",-6.187034342},
+{"RSV",-6.187714682},
+{"LVU",-6.187746255},
+{"YCY",-6.188023178},
+{"KUG",-6.188664797},
+{"EPM",-6.188708586},
+{"MBH",-6.189437659},
+{"HRB",-6.190287602},
+{"SRS",-6.190329951},
+{"KWH",-6.190605315},
+{"JIV",-6.190787704},
+{"DIW",-6.191925832},
+{"EKD",-6.192073985},
+{"GHG",-6.192189645},
+{"NGC",-6.192357872},
+{"GEC",-6.192998508},
+{"PVC",-6.194366486},
+{"ATQ",-6.194421541},
+{"KYU",-6.195519563},
+{"IHY",-6.196714128},
+{"ICP",-6.196765248},
+{"OLR",-6.197247442},
+{"CLC",-6.197742247},
+{"BPR",-6.197782065},
+{"TRN",-6.197828088},
+{"NHS",-6.19802464},
+{"IDM",-6.198591611},
+{"VLI",-6.198840856},
+{"SZE",-6.199636974},
+{"LYH",-6.199658936},
+{"WPA",-6.199783519},
+{"ABT",-6.200081023},
+{"CDY",-6.200100711},
+{"CEV",-6.200509433},
+{"DPL",-6.201327046},
+{"BCD",-6.203248419},
+{"AUH",-6.203287422},
+{"NII",-6.203478193},
+{"ACG",-6.204382602},
+{"SYB",-6.205097662},
+{"YFO",-6.205720817},
+{"ZCO",-6.205818889},
+{"PPP",-6.206903146},
+{"PSW",-6.207263277},
+{"MGM",-6.207301309},
+{"JEV",-6.208028547},
+{"JEB",-6.209121692},
+{"MSG",-6.209805678},
+{"PSC",-6.210694457},
+{"BLD",-6.210784578},
+{"OXB",-6.211934594},
+{"CAA",-6.2124309},
+{"PWO",-6.21482218},
+{"EAZ",-6.215124396},
+{"EHN",-6.215476793},
+{"GBR",-6.216041498},
+{"CUZ",-6.216993972},
+{"OEK",-6.2174657},
+{"HDL",-6.217635811},
+{"CLN",-6.218142783},
+{"YIK",-6.218216674},
+{"YAO",-6.21872912},
+{"TTF",-6.21908},
+{"LSK",-6.219138964},
+{"GBI",-6.219428762},
+{"KSC",-6.219446602},
+{"MFR",-6.219674469},
+{"KYS",-6.220702043},
+{"MPD",-6.220866543},
+{"RLP",-6.222540548},
+{"GEP",-6.222721993},
+{"WRU",-6.223171957},
+{"COQ",-6.224449336},
+{"OXV",-6.225400972},
+{"BHE",-6.225706465},
+{"IIT",-6.225851633},
+{"TMU",-6.225912569},
+{"NNK",-6.226285335},
+{"LZB",-6.226771456},
+{"KGB",-6.226943508},
+{"LMH",-6.227711065},
+{"ZUS",-6.227806537},
+{"SDN",-6.227862151},
+{"RKT",-6.228838131},
+{"RXE",-6.228995572},
+{"ERX",-6.228995572},
+{"WYL",-6.229292725},
+{"UIU",-6.229449278},
+{"GWY",-6.230150243},
+{"BYG",-6.230546023},
+{"EXF",-6.231141252},
+{"PEV",-6.231475502},
+{"EUZ",-6.231963233},
+{"SOX",-6.23227444},
+{"AWC",-6.232434545},
+{"NAX",-6.232708594},
+{"WII",-6.23277899},
+{"GUD",-6.233066},
+{"MMM",-6.233573952},
+{"FSA",-6.233949808},
+{"UYO",-6.234097048},
+{"GPU",-6.234249308},
+{"DGL",-6.234305043},
+{"TWH",-6.23432386},
+{"KUD",-6.234990782},
+{"CPR",-6.23683342},
+{"ZIZ",-6.236842705},
+{"KAV",-6.23734437},
+{"KOI",-6.237408371},
+{"MUJ",-6.238103329},
+{"MSF",-6.238258791},
+{"PSB",-6.238655579},
+{"ZPA",-6.23877214},
+{"TZP",-6.23877214},
+{"WOH",-6.239657944},
+{"LXV",-6.240434283},
+{"EVL",-6.240593463},
+{"OTZ",-6.242346864},
+{"BHI",-6.242433309},
+{"BUX",-6.243028767},
+{"XBU",-6.243570999},
+{"CRS",-6.243668208},
+{"MCB",-6.244116087},
+{"EBV",-6.244264636},
+{"CDE",-6.244392886},
+{"ASN",-6.244525899},
+{"DSK",-6.245354331},
+{"HGA",-6.245474889},
+{"CSC",-6.245710638},
+{"PGA",-6.245962197},
+{"IWI",-6.24608037},
+{"NIJ",-6.247944025},
+{"NTB",-6.248015836},
+{"PYS",-6.248139334},
+{"RRS",-6.248270933},
+{"RKR",-6.248836274},
+{"ZAW",-6.248898686},
+{"LNI",-6.249478815},
+{"HFO",-6.250606753},
+{"DFL",-6.250808426},
+{"CMU",-6.250856001},
+{"IIE",-6.250981048},
+{"MCE",-6.251273332},
+{"SPD",-6.25243852},
+{"TUK",-6.252506265},
+{"WDL",-6.252539215},
+{"WEC",-6.252990783},
+{"MMT",-6.254465067},
+{"SYK",-6.254566234},
+{"RMP",-6.254640637},
+{"OBH",-6.255616115},
+{"ZHN",-6.255785809},
+{"AGT",-6.255951091},
+{"AHD",-6.25632666},
+{"FIM",-6.256616213},
+{"FUI",-6.256637516},
+{"URW",-6.256718256},
+{"RNN",-6.257145003},
+{"NLR",-6.257250914},
+{"NTD",-6.257515615},
+{"LUY",-6.257978763},
+{"ESF",-6.25826004},
+{"WSY",-6.259942123},
+{"DIH",-6.260215254},
+{"YTA",-6.260261986},
+{"ZAD",-6.26167612},
+{"LKM",-6.261717337},
+{"IAA",-6.261982127},
+{"YXI",-6.262395143},
+{"BOF",-6.26239893},
+{"LKT",-6.262547047},
+{"IOZ",-6.262943156},
+{"YMY",-6.263237914},
+{"DNU",-6.263956109},
+{"CKC",-6.264750505},
+{"BIJ",-6.26568334},
+{"TZH",-6.265911994},
+{"UDN",-6.266539788},
+{"MHC",-6.266582616},
+{"GPL",-6.267179979},
+{"CMO",-6.269089309},
+{"DAO",-6.269151239},
+{"UIO",-6.269166242},
+{"SHD",-6.271108688},
+{"KUY",-6.272317553},
+{"JOW",-6.27298146},
+{"YVO",-6.273298647},
+{"IIC",-6.273443924},
+{"XYT",-6.27366504},
+{"MYD",-6.273743177},
+{"SII",-6.273869935},
+{"KRS",-6.273994008},
+{"JUK",-6.274623085},
+{"HUP",-6.275607064},
+{"IWE",-6.276227926},
+{"LAJ",-6.277826161},
+{"APD",-6.279205049},
+{"EUW",-6.279774309},
+{"XOS",-6.280066912},
+{"RRN",-6.280300899},
+{"OTK",-6.280373923},
+{"JAE",-6.280533828},
+{"GUZ",-6.280865276},
+{"SQQ",-6.282127407},
+{"AAB",-6.282600116},
+{"ZLY",-6.283032031},
+{"MNC",-6.2835101},
+{"MOX",-6.283625026},
+{"LWY",-6.284425183},
+{"JAX",-6.284992554},
+{"DLU",-6.286098325},
+{"OVY",-6.286575378},
+{"CRT",-6.286852967},
+{"OUJ",-6.287076207},
+{"WCE",-6.287314404},
+{"CHK",-6.287938183},
+{"WDU",-6.288537116},
+{"TEY",-6.288920222},
+{"PSK",-6.28983307},
+{"YVA",-6.289860909},
+{"CMP",-6.291135736},
+{"DGU",-6.291280628},
+{"RSW",-6.291397224},
+{"EPB",-6.292061368},
+{"TYE",-6.292065829},
+{"YNY",-6.292263365},
+{"ZAH",-6.292606327},
+{"JAT",-6.292707034},
+{"EUF",-6.292973535},
+{"LYX",-6.294130399},
+{"FEO",-6.294943634},
+{"MUY",-6.295592785},
+{"CWT",-6.29565575},
+{"GSA",-6.29584429},
+{"AVV",-6.29602882},
+{"SHS",-6.296276893},
+{"WEX",-6.297169653},
+{"HUK",-6.297232437},
+{"AWG",-6.297295229},
+{"NEK",-6.297842279},
+{"SYE",-6.29848508},
+{"OUK",-6.298556286},
+{"CCC",-6.298556698},
+{"QRS",-6.298691735},
+{"CEZ",-6.299597318},
+{"ITV",-6.299726074},
+{"BCH",-6.299849502},
+{"EXL",-6.30071448},
+{"UIM",-6.301649583},
+{"OKC",-6.301782268},
+{"AIJ",-6.301817933},
+{"JID",-6.302350366},
+{"OBW",-6.302431761},
+{"ELZ",-6.302654847},
+{"BYN",-6.303296493},
+{"AFD",-6.304358557},
+{"OSV",-6.304755884},
+{"UPK",-6.305049522},
+{"YWI",-6.30536092},
+{"EBN",-6.305470484},
+{"LCY",-6.305674633},
+{"IIH",-6.305826133},
+{"FHE",-6.306395358},
+{"GAK",-6.306400806},
+{"CUV",-6.306499734},
+{"DOK",-6.307083276},
+{"WGI",-6.307842929},
+{"OHS",-6.307987195},
+{"DWY",-6.308309968},
+{"AKW",-6.308830614},
+{"YFL",-6.308923773},
+{"FOT",-6.309007253},
+{"PSS",-6.309148953},
+{"UEC",-6.310813595},
+{"JEJ",-6.31207339},
+{"FIQ",-6.312776748},
+{"IHN",-6.312935852},
+{"TAZ",-6.314038419},
+{"MGA",-6.314299133},
+{"EEO",-6.314966778},
+{"ZEO",-6.31497832},
+{"ANR",-6.315171592},
+{"LRU",-6.315304622},
+{"VCR",-6.315763057},
+{"OIK",-6.316176104},
+{"RFD",-6.317067809},
+{"YGD",-6.317570683},
+{"MYG",-6.317570683},
+{"YEK",-6.317627024},
+{"MMP",-6.317756507},
+{"QAE",-6.318192989},
+{"UKT",-6.31851482},
+{"MTS",-6.318613959},
+{"WOD",-6.318940417},
+{"KYI",-6.320488065},
+{"MGR",-6.320764377},
+{"RZB",-6.320845399},
+{"WSR",-6.321531871},
+{"CNN",-6.321695519},
+{"WSG",-6.322666951},
+{"CCD",-6.323175046},
+{"HYX",-6.32350626},
+{"VOX",-6.324836707},
+{"PCA",-6.325569821},
+{"WDN",-6.325671461},
+{"ZEG",-6.326074309},
+{"MVI",-6.326126501},
+{"FJO",-6.326819182},
+{"TNF",-6.327641033},
+{"LRB",-6.327698256},
+{"HSE",-6.327850152},
+{"FTR",-6.328084485},
+{"GMB",-6.329709346},
+{"AYP",-6.330049123},
+{"LSR",-6.330166426},
+{"VEU",-6.332216136},
+{"YLS",-6.332386975},
+{"UEY",-6.332516929},
+{"FDC",-6.332580585},
+{"EKO",-6.333301482},
+{"ZLO",-6.333392905},
+{"EKT",-6.334322496},
+{"UZO",-6.334346633},
+{"PAJ",-6.335922007},
+{"PAA",-6.336018919},
+{"GTA",-6.337319902},
+{"ABM",-6.33793918},
+{"WSM",-6.338085684},
+{"DFE",-6.338482169},
+{"KYE",-6.338803592},
+{"CFC",-6.339185817},
+{"JRA",-6.339196665},
+{"HSP",-6.339791016},
+{"KAA",-6.341170108},
+{"MBY",-6.341424462},
+{"YUM",-6.342071921},
+{"GHM",-6.342090577},
+{"EGT",-6.342460677},
+{"DSB",-6.342476617},
+{"AAF",-6.343055411},
+{"SGT",-6.343433638},
+{"FAA",-6.344476951},
+{"MHA",-6.344639409},
+{"FEZ",-6.345371451},
+{"CDU",-6.345371909},
+{"KIV",-6.345962841},
+{"HLU",-6.346562393},
+{"HYE",-6.347285252},
+{"TSF",-6.347449224},
+{"SUJ",-6.349161733},
+{"YNB",-6.350033039},
+{"RIW",-6.350372405},
+{"ATB",-6.351243822},
+{"IOH",-6.352162162},
+{"TZT",-6.352345225},
+{"WSC",-6.352351282},
+{"UMD",-6.352690133},
+{"ORZ",-6.353327068},
+{"IOO",-6.353771843},
+{"UZC",-6.354075317},
+{"HLB",-6.355619818},
+{"AGW",-6.355630146},
+{"MYN",-6.355877613},
+{"IBT",-6.35643646},
+{"VVY",-6.356907031},
+{"TZB",-6.357752988},
+{"IZM",-6.358184849},
+{"HCP",-6.359220703},
+{"LUH",-6.35928887},
+{"YUL",-6.360120985},
+{"OYT",-6.36012383},
+{"CIQ",-6.360154663},
+{"LTP",-6.360301265},
+{"OVN",-6.360854909},
+{"TIW",-6.361115356},
+{"LFD",-6.361243736},
+{"AZQ",-6.361342661},
+{"ZQU",-6.361342661},
+{"AJR",-6.361562472},
+{"UHE",-6.362188256},
+{"LFP",-6.362576848},
+{"PVT",-6.362693255},
+{"MKI",-6.362802057},
+{"OPD",-6.363490335},
+{"MLU",-6.363840863},
+{"DPH",-6.363951867},
+{"TOH",-6.36430181},
+{"KUK",-6.364672647},
+{"BMU",-6.364883599},
+{"OOB",-6.365435436},
+{"AAP",-6.365985572},
+{"YAQ",-6.366527259},
+{"VLE",-6.36670444},
+{"KSK",-6.366749228},
+{"EEU",-6.367254258},
+{"VIJ",-6.368703692},
+{"QUM",-6.370429896},
+{"UMR",-6.370429896},
+{"NPS",-6.370955275},
+{"RFC",-6.371021904},
+{"MNY",-6.371504174},
+{"VEK",-6.371689243},
+{"NCC",-6.372189812},
+{"NTT",-6.372469348},
+{"HOX",-6.372813527},
+{"GIQ",-6.373951011},
+{"WTE",-6.373974027},
+{"IAU",-6.374403704},
+{"UAH",-6.374422821},
+{"EJI",-6.374425762},
+{"SMT",-6.375005574},
+{"MPN",-6.37513469},
+{"KJA",-6.375750359},
+{"HSL",-6.375900847},
+{"DJI",-6.376373303},
+{"THG",-6.37680339},
+{"AEP",-6.377268936},
+{"YBU",-6.377311866},
+{"EMG",-6.377347891},
+{"KAK",-6.377441669},
+{"YEG",-6.378112033},
+{"LSL",-6.378420144},
+{"UJU",-6.378709166},
+{"FTU",-6.378993427},
+{"FRG",-6.379794716},
+{"IPC",-6.382465088},
+{"YVI",-6.382612925},
+{"LTW",-6.382823781},
+{"WEF",-6.383306835},
+{"UZM",-6.383494001},
+{"EOA",-6.383734832},
+{"SCM",-6.384081042},
+{"FUD",-6.384777304},
+{"LKO",-6.385032913},
+{"IJK",-6.385333409},
+{"EDP",-6.385520444},
+{"EZY",-6.385629082},
+{"GSW",-6.385919923},
+{"KSW",-6.386376706},
+{"FOB",-6.38871547},
+{"LYV",-6.389081393},
+{"RBC",-6.389797405},
+{"KCL",-6.390132727},
+{"CMC",-6.39035286},
+{"IAF",-6.390619405},
+{"XMA",-6.391254381},
+{"NGG",-6.391323689},
+{"GHR",-6.391517401},
+{"EIH",-6.391751501},
+{"XYZ",-6.392228761},
+{"DMS",-6.393279048},
+{"DSS",-6.393494123},
+{"JNA",-6.393835902},
+{"SEJ",-6.393938436},
+{"KOG",-6.394900364},
+{"DKI",-6.395349206},
+{"MIY",-6.395504583},
+{"YAZ",-6.395904601},
+{"CBC",-6.396431828},
+{"RUJ",-6.397298012},
+{"AAK",-6.397451504},
+{"KTU",-6.397668656},
+{"KTR",-6.39795836},
+{"RLM",-6.398674138},
+{"RKD",-6.399841487},
+{"TIJ",-6.400632228},
+{"TVO",-6.400843162},
+{"GWR",-6.402330939},
+{"YIT",-6.402437068},
+{"TSV",-6.402528579},
+{"MEQ",-6.402984331},
+{"AZD",-6.40305606},
+{"EWG",-6.403649718},
+{"WGA",-6.403649718},
+{"RVU",-6.404183288},
+{"IGF",-6.404622387},
+{"WFL",-6.404681248},
+{"EKY",-6.405615147},
+{"CPM",-6.405778457},
+{"YUE",-6.405935503},
+{"POH",-6.407218237},
+{"GTZ",-6.408402451},
+{"IUT",-6.408444331},
+{"EOX",-6.409673363},
+{"CEG",-6.409960018},
+{"SDL",-6.410117519},
+{"OGT",-6.410744899},
+{"MBP",-6.41093201},
+{"OUZ",-6.411265384},
+{"ACF",-6.411751236},
+{"FDE",-6.412045146},
+{"FSO",-6.412092724},
+{"AUQ",-6.412156884},
+{"JHA",-6.412550602},
+{"TVE",-6.412580573},
+{"DZE",-6.412674783},
+{"GGP",-6.413041644},
+{"TBY",-6.413303725},
+{"IKT",-6.413612101},
+{"BUP",-6.413658242},
+{"MMH",-6.41419996},
+{"MHG",-6.41419996},
+{"SNC",-6.414216615},
+{"YMC",-6.414880617},
+{"SRC",-6.415057138},
+{"NND",-6.415211652},
+{"NRC",-6.415795752},
+{"BFA",-6.416109679},
+{"WOS",-6.416539945},
+{"VGO",-6.416871167},
+{"OVG",-6.416871167},
+{"LDP",-6.416932793},
+{"GAF",-6.418127568},
+{"CSE",-6.419007749},
+{"RRM",-6.419269652},
+{"AUI",-6.420917495},
+{"NFT",-6.421016805},
+{"OEW",-6.421120505},
+{"FOV",-6.421160354},
+{"KHY",-6.421666699},
+{"UDP",-6.422135882},
+{"WYS",-6.422277612},
+{"CDA",-6.42236081},
+{"DGY",-6.422464284},
+{"PLS",-6.422863078},
+{"AVG",-6.423610158},
+{"ZAE",-6.423725461},
+{"XNE",-6.424262298},
+{"OKW",-6.42433268},
+{"SFR",-6.425977252},
+{"KAE",-6.426257201},
+{"MTO",-6.42645167},
+{"YOI",-6.427001295},
+{"HTG",-6.427263081},
+{"UPF",-6.427344472},
+{"XPT",-6.427562142},
+{"RIH",-6.427563251},
+{"LUJ",-6.427722834},
+{"YYA",-6.427775488},
+{"KUZ",-6.428471667},
+{"OAO",-6.428807119},
+{"YYI",-6.429236809},
+{"IMH",-6.42935751},
+{"YTR",-6.429714803},
+{"MDR",-6.43010694},
+{"YII",-6.430465408},
+{"WOP",-6.430658423},
+{"ODT",-6.431853008},
+{"APC",-6.432178204},
+{"CYH",-6.432202842},
+{"BVR",-6.43307277},
+{"ZDA",-6.433136738},
+{"IUN",-6.433622979},
+{"UXO",-6.434033282},
+{"QOS",-6.434083331},
+{"IGW",-6.4344057},
+{"LTK",-6.435693057},
+{"YPL",-6.436063513},
+{"WNC",-6.43653042},
+{"DLL",-6.437539432},
+{"RLH",-6.438432623},
+{"EXX",-6.438450233},
+{"XXO",-6.438450233},
+{"IFN",-6.438503635},
+{"YDS",-6.439491622},
+{"YEY",-6.441580204},
+{"THK",-6.442410661},
+{"IHM",-6.44271231},
+{"VIF",-6.442733536},
+{"KMT",-6.442945284},
+{"VNA",-6.443625987},
+{"MCR",-6.444928324},
+{"ZIU",-6.445205762},
+{"BCS",-6.446523269},
+{"ZOV",-6.447754238},
+{"WFA",-6.447892389},
+{"YOV",-6.44823912},
+{"PEJ",-6.448732689},
+{"XIR",-6.449007912},
+{"UZI",-6.449093482},
+{"DCR",-6.449498859},
+{"OIB",-6.450014281},
+{"HUJ",-6.45009188},
+{"MSU",-6.450477165},
+{"CMV",-6.451865857},
+{"PUY",-6.452554829},
+{"BFO",-6.452763789},
+{"TZV",-6.453278988},
+{"JIK",-6.453769494},
+{"DUH",-6.454302974},
+{"TNC",-6.454332434},
+{"DHC",-6.454439688},
+{"IZV",-6.454492735},
+{"FUH",-6.454496271},
+{"ADZ",-6.455048351},
+{"AEZ",-6.456542363},
+{"CTY",-6.456696373},
+{"RFF",-6.456902001},
+{"EPN",-6.457607327},
+{"ODV",-6.45779438},
+{"IYE",-6.458030836},
+{"PCC",-6.458298935},
+{"ZNI",-6.458362566},
+{"DUQ",-6.458475578},
+{"CAX",-6.458816578},
+{"YTU",-6.45907861},
+{"EKM",-6.460035176},
+{"PSP",-6.460379196},
+{"FSU",-6.460526204},
+{"GBE",-6.461114136},
+{"BYW",-6.461574631},
+{"MLL",-6.461642938},
+{"VPN",-6.463008942},
+{"KVA",-6.463357131},
+{"YLK",-6.463608072},
+{"EKB",-6.463630345},
+{"SNR",-6.463640579},
+{"BYV",-6.463759189},
+{"CBM",-6.464045912},
+{"YCR",-6.464355135},
+{"FAZ",-6.464988131},
+{"FFT",-6.465037651},
+{"AIO",-6.465084156},
+{"DTR",-6.46515181},
+{"TUY",-6.466459832},
+{"NGP",-6.466522852},
+{"CSA",-6.467119571},
+{"YHW",-6.467138384},
+{"GZH",-6.467636298},
+{"VEJ",-6.46773838},
+{"VAX",-6.467957817},
+{"NCZ",-6.468094033},
+{"KIF",-6.46812931},
+{"RZL",-6.468353204},
+{"YUB",-6.468524854},
+{"PHP",-6.470334946},
+{"BOZ",-6.470398531},
+{"PRS",-6.470745967},
+{"SYG",-6.471199642},
+{"RDF",-6.47123701},
+{"TDS",-6.471250488},
+{"WNG",-6.473749263},
+{"MTP",-6.474134542},
+{"GSU",-6.474502263},
+{"KMO",-6.474788141},
+{"ITG",-6.475045159},
+{"ICD",-6.475446436},
+{"UGD",-6.475932298},
+{"NDQ",-6.475974411},
+{"CCT",-6.476607836},
+{"IMC",-6.476673587},
+{"OGW",-6.477188772},
+{"SHG",-6.477234113},
+{"ULH",-6.478463218},
+{"VAY",-6.478868914},
+{"ZHI",-6.480201463},
+{"BEX",-6.480377235},
+{"ETD",-6.480916254},
+{"TLC",-6.481122397},
+{"GAH",-6.482101188},
+{"QBA",-6.482738587},
+{"IQB",-6.482738587},
+{"YEV",-6.482739216},
+{"GTP",-6.482822889},
+{"JIE",-6.48291413},
+{"NRS",-6.483063933},
+{"QIS",-6.4843223},
+{"HCG",-6.485503282},
+{"FCS",-6.486470435},
+{"PMS",-6.486967524},
+{"KRY",-6.487595571},
+{"PCM",-6.487788363},
+{"TMS",-6.488522773},
+{"PYN",-6.488902886},
+{"HSV",-6.489028601},
+{"VYG",-6.489337617},
+{"UMG",-6.490127759},
+{"CNR",-6.490296073},
+{"EXN",-6.490475339},
+{"OSF",-6.49157175},
+{"PYM",-6.49159743},
+{"WUP",-6.492607223},
+{"MCT",-6.493629044},
+{"BEB",-6.493916825},
+{"GRS",-6.494589917},
+{"ASZ",-6.494711469},
+{"GGU",-6.495169535},
+{"UYU",-6.49564882},
+{"KOZ",-6.495759001},
+{"ZRO",-6.495926271},
+{"TZR",-6.495926271},
+{"ATG",-6.496165617},
+{"CDR",-6.496653149},
+{"OWK",-6.496822062},
+{"MAQ",-6.497925514},
+{"POF",-6.497947012},
+{"CBA",-6.498287218},
+{"DBC",-6.498482859},
+{"EDK",-6.499033735},
+{"FPE",-6.499261731},
+{"RPC",-6.49935976},
+{"FTB",-6.499820795},
+{"NPV",-6.499916332},
+{"GOX",-6.499927458},
+{"VUR",-6.500700405},
+{"GMY",-6.501134644},
+{"HEJ",-6.501153021},
+{"VEP",-6.501416279},
+{"SPC",-6.502277415},
+{"TTN",-6.502487371},
+{"CRM",-6.502530822},
+{"ZVE",-6.503210156},
+{"GMP",-6.503393514},
+{"KMS",-6.503729432},
+{"YNU",-6.50385423},
+{"WYM",-6.504729482},
+{"EMK",-6.504768526},
+{"TUX",-6.505049217},
+{"ATD",-6.505065773},
+{"DCE",-6.505642973},
+{"OXU",-6.506242854},
+{"BII",-6.50624883},
+{"POZ",-6.506784387},
+{"GMT",-6.506993207},
+{"MGO",-6.508781594},
+{"HNQ",-6.508816328},
+{"JME",-6.509171176},
+{"CMD",-6.509591889},
+{"XOL",-6.510197253},
+{"NAJ",-6.510933666},
+{"PCP",-6.511198893},
+{"QAT",-6.511253301},
+{"TCI",-6.511985453},
+{"VLS",-6.512254689},
+{"ICM",-6.512620445},
+{"OCD",-6.513075543},
+{"UOK",-6.513751317},
+{"UFR",-6.514045313},
+{"XEI",-6.514382809},
+{"CFS",-6.51547148},
+{"BMW",-6.515581379},
+{"JII",-6.515798546},
+{"MFL",-6.515848102},
+{"FPA",-6.516711154},
+{"BJP",-6.516966321},
+{"WYT",-6.517230491},
+{"VYA",-6.517926409},
+{"YDG",-6.518106534},
+{"SIH",-6.51812223},
+{"NRH",-6.518419201},
+{"TEJ",-6.518525067},
+{"JSP",-6.519431108},
+{"WWI",-6.520101769},
+{"YSQ",-6.520520171},
+{"YAU",-6.520626551},
+{"AXM",-6.52073433},
+{"HKO",-6.52091425},
+{"JOZ",-6.521584455},
+{"FFH",-6.521625732},
+{"UXA",-6.521777115},
+{"PTF",-6.522688594},
+{"YTW",-6.523349802},
+{"TIY",-6.523397465},
+{"ODZ",-6.523485896},
+{"CDM",-6.523931089},
+{"JFK",-6.523933855},
+{"SNM",-6.524088121},
+{"APG",-6.524162852},
+{"OXC",-6.524504843},
+{"HUO",-6.524663469},
+{"GSM",-6.525110564},
+{"IBW",-6.525175067},
+{"MRP",-6.525409578},
+{"GCL",-6.525504667},
+{"AAG",-6.527411535},
+{"EGB",-6.52837825},
+{"CLR",-6.529454985},
+{"TYO",-6.530620078},
+{"FRC",-6.531410275},
+{"DUX",-6.531994707},
+{"TCE",-6.532048261},
+{"CVD",-6.532196977},
+{"RVL",-6.532242096},
+{"AYK",-6.532370427},
+{"YKH",-6.532370427},
+{"RGB",-6.532861537},
+{"CAQ",-6.533006295},
+{"KIW",-6.533494589},
+{"RJA",-6.533523579},
+{"AKP",-6.534125026},
+{"NPC",-6.535990554},
+{"VAZ",-6.536457301},
+{"SCC",-6.536507136},
+{"IJH",-6.536646704},
+{"JHO",-6.536646704},
+{"OAA",-6.536723628},
+{"JOP",-6.537512174},
+{"CNU",-6.538093448},
+{"OFN",-6.538937465},
+{"OKR",-6.539063493},
+{"OSD",-6.541166242},
+{"GHY",-6.541345471},
+{"SYA",-6.541645792},
+{"IDF",-6.541779095},
+{"WNB",-6.542543671},
+{"JEZ",-6.54288817},
+{"AAV",-6.542897563},
+{"UYG",-6.542969821},
+{"PPB",-6.543412304},
+{"OPW",-6.543542532},
+{"SUU",-6.543907377},
+{"JTH",-6.543918965},
+{"LCD",-6.543946486},
+{"YGY",-6.544154401},
+{"MKE",-6.544260933},
+{"UDB",-6.545156251},
+{"FSR",-6.545616236},
+{"PDI",-6.545689675},
+{"BRD",-6.546097089},
+{"FRS",-6.546386147},
+{"CPP",-6.547067688},
+{"LNO",-6.547353744},
+{"MUO",-6.547719615},
+{"NYP",-6.547859911},
+{"SGS",-6.548579639},
+{"DPR",-6.548855705},
+{"XAD",-6.549493451},
+{"EIX",-6.549522795},
+{"MSM",-6.550248226},
+{"ZVA",-6.550304814},
+{"WOC",-6.551432221},
+{"KGS",-6.551691674},
+{"IJN",-6.551966037},
+{"IRH",-6.552118044},
+{"HIQ",-6.552428126},
+{"TQM",-6.552543355},
+{"ICB",-6.552586205},
+{"NZW",-6.55271404},
+{"USZ",-6.552751732},
+{"GSP",-6.552977957},
+{"CPC",-6.553064486},
+{"JEK",-6.553167308},
+{"CLS",-6.553393009},
+{"SPF",-6.553450008},
+{"VYW",-6.554973238},
+{"UYV",-6.555105493},
+{"XOC",-6.555428871},
+{"LJU",-6.555683282},
+{"NPH",-6.556211922},
+{"HEH",-6.557215126},
+{"NLV",-6.557381681},
+{"SMC",-6.557590151},
+{"YLP",-6.558532877},
+{"MIJ",-6.558624266},
+{"YCU",-6.558906044},
+{"PWE",-6.559073998},
+{"UIK",-6.55927653},
+{"KFE",-6.559539212},
+{"AGC",-6.55974196},
+{"CBD",-6.560054529},
+{"KOY",-6.560095119},
+{"KJV",-6.560383119},
+{"GZE",-6.560818112},
+{"IPF",-6.561694688},
+{"KPE",-6.562030562},
+{"GII",-6.563510744},
+{"WSS",-6.563567571},
+{"NHC",-6.563982253},
+{"IKR",-6.564515023},
+{"EOK",-6.565339751},
+{"CPL",-6.56534812},
+{"GDI",-6.56559623},
+{"LWR",-6.565676934},
+{"RIR",-6.566706848},
+{"FME",-6.568157897},
+{"CPT",-6.568872204},
+{"AJJ",-6.569423298},
+{"NFF",-6.569602285},
+{"CFT",-6.56992511},
+{"WIK",-6.570197392},
+{"WLB",-6.570474463},
+{"JOF",-6.570552229},
+{"DLC",-6.570896568},
+{"MTV",-6.570951286},
+{"AUA",-6.571552104},
+{"FEK",-6.571647818},
+{"SYI",-6.57165631},
+{"BCC",-6.571915775},
+{"EFD",-6.572959835},
+{"LKB",-6.573374287},
+{"FGO",-6.573534751},
+{"QUU",-6.573691397},
+{"RKG",-6.573747245},
+{"PEQ",-6.574384572},
+{"FSK",-6.574644896},
+{"LNF",-6.574665107},
+{"NMP",-6.57478328},
+{"YAY",-6.575250071},
+{"ECM",-6.575480539},
+{"KUI",-6.575642562},
+{"OKF",-6.576862796},
+{"OSZ",-6.576951092},
+{"QIA",-6.577194193},
+{"TZW",-6.577302108},
+{"HOZ",-6.577643232},
+{"HVE",-6.577748127},
+{"EVD",-6.578461144},
+{"VYN",-6.578639189},
+{"WMO",-6.579476272},
+{"MYX",-6.579499853},
+{"RMB",-6.579688547},
+{"SFS",-6.579810456},
+{"KSL",-6.579894632},
+{"CUY",-6.580648226},
+{"AUJ",-6.581557111},
+{"IAW",-6.581562639},
+{"PTM",-6.581964833},
+{"IYO",-6.582199684},
+{"IFC",-6.583230734},
+{"HCI",-6.583231527},
+{"QAD",-6.583524977},
+{"HWY",-6.583858322},
+{"RSZ",-6.58386388},
+{"CRP",-6.584073545},
+{"IDC",-6.584353257},
+{"DHS",-6.584401748},
+{"ECJ",-6.585078006},
+{"OMC",-6.585228517},
+{"AFP",-6.585265954},
+{"WND",-6.585275513},
+{"NUJ",-6.585353584},
+{"KMU",-6.586143057},
+{"MRE",-6.586323482},
+{"NZB",-6.586337056},
+{"WLT",-6.586579877},
+{"HVA",-6.587349973},
+{"HHS",-6.587509281},
+{"GCH",-6.588415002},
+{"ZNE",-6.589530911},
+{"UZN",-6.589530911},
+{"OXH",-6.589945386},
+{"UZY",-6.58997679},
+{"UKK",-6.592298075},
+{"ZUG",-6.592697374},
+{"CYO",-6.592827043},
+{"RCM",-6.593604247},
+{"AJN",-6.594543939},
+{"RGN",-6.594720561},
+{"DTO",-6.596549605},
+{"PSL",-6.597069047},
+{"GNR",-6.597475217},
+{"UDC",-6.598010532},
+{"GRM",-6.598622074},
+{"UDF",-6.598663148},
+{"PDS",-6.599322506},
+{"HBS",-6.599353772},
+{"CKJ",-6.600223545},
+{"CGA",-6.600741624},
+{"JPE",-6.60091418},
+{"IUE",-6.601301646},
+{"GHQ",-6.602183616},
+{"YUP",-6.602778674},
+{"MYK",-6.60326909},
+{"GOK",-6.603343822},
+{"KUF",-6.603475878},
+{"UOQ",-6.604141757},
+{"RCP",-6.604155068},
+{"KDE",-6.605042024},
+{"CHP",-6.605257165},
+{"SAZ",-6.605645188},
+{"DIQ",-6.605803835},
+{"AZR",-6.605841418},
+{"GTU",-6.605853111},
+{"AOD",-6.605859793},
+{"OTF",-6.607024012},
+{"HPV",-6.607683614},
+{"WLO",-6.608642535},
+{"AOK",-6.608915821},
+{"JHE",-6.608992371},
+{"XYR",-6.609175812},
+{"IAK",-6.609202745},
+{"OLQ",-6.609655815},
+{"BFI",-6.609678565},
+{"TAQ",-6.609944072},
+{"HFE",-6.610046947},
+{"YOO",-6.610129602},
+{"BCG",-6.610480638},
+{"MWI",-6.610842942},
+{"YPU",-6.611211467},
+{"BNT",-6.612531763},
+{"NYC",-6.612709917},
+{"IVF",-6.612888143},
+{"PTT",-6.614038187},
+{"CSP",-6.61468467},
+{"FCP",-6.614955815},
+{"OIF",-6.615353459},
+{"GEU",-6.615383339},
+{"UUN",-6.616292694},
+{"TYB",-6.616939973},
+{"YSR",-6.617852597},
+{"FMS",-6.617953068},
+{"DYW",-6.61888762},
+{"TGF",-6.619084761},
+{"ZAV",-6.619394857},
+{"MBF",-6.620241857},
+{"CYG",-6.620250491},
+{"HBV",-6.620327339},
+{"BLS",-6.620424065},
+{"NZU",-6.620943477},
+{"WFI",-6.621405507},
+{"AFM",-6.621696474},
+{"EYG",-6.621751052},
+{"LIW",-6.6223215},
+{"MCQ",-6.622560131},
+{"KOA",-6.623202918},
+{"XHU",-6.623204656},
+{"NMD",-6.623242906},
+{"TUU",-6.623341154},
+{"CNC",-6.623665618},
+{"YLM",-6.62367345},
+{"KBP",-6.623843175},
+{"RJI",-6.624536691},
+{"MCV",-6.624795737},
+{"AFC",-6.625123909},
+{"KOJ",-6.627451783},
+{"KTE",-6.627691494},
+{"RSQ",-6.627870705},
+{"CBT",-6.628251335},
+{"PDP",-6.628393827},
+{"PSD",-6.628775796},
+{"PFC",-6.630199254},
+{"XSL",-6.630259329},
+{"SNP",-6.631139315},
+{"OUW",-6.632287302},
+{"NPT",-6.632389393},
+{"MLN",-6.632463092},
+{"YGL",-6.632726021},
+{"CSM",-6.633375145},
+{"AEB",-6.633418751},
+{"MDS",-6.633999395},
+{"CCS",-6.634333707},
+{"PML",-6.635761212},
+{"CDI",-6.635793426},
+{"IMK",-6.636067334},
+{"RYZ",-6.636450738},
+{"JPN",-6.63673941},
+{"TEQ",-6.637204199},
+{"WSD",-6.637739591},
+{"SMR",-6.638113678},
+{"PDO",-6.638398957},
+{"ICZ",-6.638404359},
+{"PNI",-6.638456576},
+{"RZY",-6.639629511},
+{"GYZ",-6.639652081},
+{"YRG",-6.639652081},
+{"DAQ",-6.640031435},
+{"TNT",-6.640221236},
+{"ZOH",-6.640333348},
+{"HRD",-6.640853602},
+{"TDI",-6.640942333},
+{"GUF",-6.641496863},
+{"FLP",-6.641910503},
+{"ASF",-6.641965866},
+{"OZL",-6.642143802},
+{"FLG",-6.642668049},
+{"FEP",-6.642672594},
+{"ZEZ",-6.643482475},
+{"JYA",-6.643692016},
+{"AJY",-6.643692016},
+{"MCW",-6.643803205},
+{"EJB",-6.643991015},
+{"MCS",-6.644323984},
+{"GRP",-6.645950531},
+{"IKL",-6.64747471},
+{"JEP",-6.647860962},
+{"AMK",-6.648188626},
+{"WPI",-6.648372815},
+{"MOJ",-6.648403214},
+{"NKW",-6.648450198},
+{"CVS",-6.648616986},
+{"CCY",-6.6489526},
+{"LBJ",-6.649248783},
+{"PRK",-6.649745642},
+{"VOB",-6.650264348},
+{"RSR",-6.650542911},
+{"MPC",-6.650805906},
+{"NFS",-6.650824433},
+{"XAR",-6.650960628},
+{"KFR",-6.651236857},
+{"GOZ",-6.654043379},
+{"YSK",-6.654103111},
+{"DTL",-6.654770053},
+{"JCS",-6.656419383},
+{"OGB",-6.656799589},
+{"IEJ",-6.657002501},
+{"PFR",-6.657019415},
+{"PUJ",-6.657024113},
+{"VCH",-6.658304898},
+{"YAE",-6.658562263},
+{"XYP",-6.658891499},
+{"XIU",-6.659314493},
+{"MBB",-6.65955828},
+{"NUK",-6.6596339},
+{"CSR",-6.659680224},
+{"TLS",-6.65975492},
+{"CBI",-6.660449548},
+{"QAS",-6.660841831},
+{"ICJ",-6.661104499},
+{"DUU",-6.662255661},
+{"MTR",-6.662468751},
+{"EMC",-6.662753352},
+{"MNU",-6.662862863},
+{"TDM",-6.662935251},
+{"NHL",-6.663373647},
+{"ZCA",-6.663697963},
+{"DTS",-6.66382203},
+{"PCT",-6.664407533},
+{"FOP",-6.664766101},
+{"FYO",-6.664797669},
+{"MFA",-6.665145071},
+{"WUZ",-6.665452509},
+{"EDV",-6.665473587},
+{"FFD",-6.665705518},
+{"VNT",-6.666221577},
+{"ECB",-6.666305087},
+{"EMT",-6.666539383},
+{"VPO",-6.667284402},
+{"TZL",-6.667529817},
+{"MND",-6.667556773},
+{"UKS",-6.667934333},
+{"JOO",-6.668360444},
+{"JIS",-6.668423143},
+{"IRQ",-6.668607433},
+{"TZO",-6.66893858},
+{"PNG",-6.668939546},
+{"ZYL",-6.669234219},
+{"VTH",-6.670003243},
+{"YKO",-6.670437205},
+{"MTD",-6.670890034},
+{"OHD",-6.671337509},
+{"CML",-6.671727119},
+{"VBA",-6.673499831},
+{"GVE",-6.67381129},
+{"VDS",-6.67382008},
+{"SSK",-6.674580641},
+{"YNM",-6.674941835},
+{"YTL",-6.675280789},
+{"IBD",-6.675715155},
+{"POB",-6.676034097},
+{"TLV",-6.676963799},
+{"PFL",-6.677540703},
+{"CBF",-6.677604741},
+{"ZYI",-6.678553614},
+{"BIW",-6.678665208},
+{"CHG",-6.679461024},
+{"LPM",-6.679964971},
+{"MUB",-6.680090801},
+{"UMW",-6.680098729},
+{"GCS",-6.680343563},
+{"MSW",-6.680654017},
+{"FTM",-6.681023279},
+{"VHD",-6.681130543},
+{"JAQ",-6.681164317},
+{"XOM",-6.681666267},
+{"UFG",-6.68177369},
+{"LPU",-6.682266386},
+{"BVO",-6.682549317},
+{"ZNA",-6.682897255},
+{"ZUO",-6.683131697},
+{"ZOB",-6.683891761},
+{"PDR",-6.684465936},
+{"YLT",-6.684880535},
+{"PNP",-6.684973723},
+{"USR",-6.685536287},
+{"APW",-6.685575423},
+{"IPK",-6.685607537},
+{"UXB",-6.686459426},
+{"HYI",-6.686722966},
+{"TSS",-6.686824602},
+{"LNG",-6.687075272},
+{"LVY",-6.687750486},
+{"RZI",-6.688193472},
+{"BSH",-6.690658821},
+{"KYD",-6.690715684},
+{"FEX",-6.690803023},
+{"AFB",-6.691274555},
+{"VOV",-6.691402688},
+{"ADK",-6.691976702},
+{"TVS",-6.692098931},
+{"FEF",-6.692470921},
+{"YRC",-6.693085147},
+{"ZIJ",-6.693278165},
+{"PCH",-6.69337113},
+{"HOJ",-6.694869485},
+{"PMU",-6.695053041},
+{"BGE",-6.695060221},
+{"BPL",-6.696195084},
+{"HRT",-6.696234164},
+{"LCS",-6.697182411},
+{"KCO",-6.697273123},
+{"BLM",-6.697324672},
+{"LCL",-6.69734117},
+{"JOM",-6.698210213},
+{"PKA",-6.698332142},
+{"GEZ",-6.698486152},
+{"KEC",-6.698776749},
+{"ASV",-6.69925288},
+{"CCF",-6.699694285},
+{"OCN",-6.70083926},
+{"NYX",-6.701602868},
+{"IEI",-6.701630983},
+{"MTA",-6.701713255},
+{"FNA",-6.702379296},
+{"LZN",-6.702586926},
+{"OAZ",-6.702945034},
+{"HNY",-6.703054718},
+{"ECQ",-6.703262671},
+{"TKY",-6.703836887},
+{"TTK",-6.703836887},
+{"SHP",-6.704448546},
+{"YKI",-6.704603693},
+{"WYK",-6.704713796},
+{"OZN",-6.704759943},
+{"CVI",-6.705648179},
+{"ALJ",-6.705791138},
+{"VOE",-6.705953075},
+{"VHF",-6.706075094},
+{"FOK",-6.70612349},
+{"BEP",-6.706547713},
+{"JPA",-6.706963917},
+{"NBS",-6.707373135},
+{"SKV",-6.708296343},
+{"MDI",-6.708521634},
+{"UKY",-6.709410183},
+{"DRG",-6.709511968},
+{"JIW",-6.709775025},
+{"CRF",-6.710849056},
+{"VHS",-6.711138468},
+{"MMC",-6.711240659},
+{"KUE",-6.711257693},
+{"MEJ",-6.711311995},
+{"SZL",-6.711329032},
+{"WNU",-6.711744516},
+{"RPY",-6.712260697},
+{"AHT",-6.71242293},
+{"VND",-6.713376205},
+{"TZK",-6.715396527},
+{"BIX",-6.716047302},
+{"KYW",-6.716048379},
+{"FBA",-6.716487801},
+{"NKV",-6.717112157},
+{"KVD",-6.717112157},
+{"KGU",-6.717773075},
+{"SJI",-6.718061732},
+{"ASJ",-6.718061732},
+{"DTV",-6.718548668},
+{"GYO",-6.719302871},
+{"OXL",-6.719388561},
+{"LYF",-6.719894363},
+{"PMM",-6.720041004},
+{"WEM",-6.720464912},
+{"JKS",-6.720643294},
+{"WAW",-6.720811955},
+{"YIM",-6.721286732},
+{"IWW",-6.722951456},
+{"BCR",-6.7229788},
+{"BMD",-6.723087098},
+{"PPT",-6.723089286},
+{"IUC",-6.723476758},
+{"UCN",-6.723476758},
+{"IJE",-6.723642141},
+{"NKC",-6.72396871},
+{"IEY",-6.724784013},
+{"GSG",-6.725025716},
+{"NSJ",-6.725260955},
+{"PRP",-6.725291744},
+{"GTS",-6.725740624},
+{"CIX",-6.725844108},
+{"TDR",-6.726451198},
+{"YKS",-6.726910108},
+{"BZW",-6.727508743},
+{"SLT",-6.727852614},
+{"KUC",-6.729547189},
+{"TCD",-6.731925622},
+{"MMR",-6.732619555},
+{"SHH",-6.732834329},
+{"AUU",-6.733022344},
+{"PAF",-6.733453518},
+{"HSS",-6.733667584},
+{"HRK",-6.733897458},
+{"HCV",-6.734584441},
+{"TRS",-6.734809181},
+{"VLL",-6.73492834},
+{"NFP",-6.735187006},
+{"OIV",-6.735271387},
+{"GLC",-6.735660877},
+{"PYH",-6.736264939},
+{"AXS",-6.736439778},
+{"YQU",-6.736502962},
+{"NYQ",-6.736502962},
+{"DTP",-6.736916147},
+{"PBA",-6.737624895},
+{"ZWA",-6.737855742},
+{"NGX",-6.73815127},
+{"GXI",-6.73815127},
+{"WUH",-6.739726274},
+{"TRP",-6.740285935},
+{"FAQ",-6.741072042},
+{"RNK",-6.741432532},
+{"UXH",-6.741779615},
+{"YKN",-6.743191353},
+{"OKT",-6.743887469},
+{"UHF",-6.743959783},
+{"GFL",-6.744042441},
+{"TGI",-6.74438817},
+{"TTW",-6.744446776},
+{"OZC",-6.744611144},
+{"ZKO",-6.74486184},
+{"DDM",-6.745296876},
+{"ICF",-6.745769233},
+{"SDP",-6.745897204},
+{"NZH",-6.746075964},
+{"KSS",-6.746534158},
+{"UUS",-6.747350178},
+{"XAE",-6.747552686},
+{"LJA",-6.748173529},
+{"BLJ",-6.748173529},
+{"GCC",-6.750117074},
+{"BRZ",-6.750476997},
+{"OCP",-6.751296963},
+{"MLR",-6.751595942},
+{"DCC",-6.751627487},
+{"CSU",-6.751680066},
+{"BMP",-6.752164101},
+{"DFT",-6.75234546},
+{"JLI",-6.753588933},
+{"AJL",-6.753588933},
+{"XBR",-6.753696923},
+{"AGB",-6.754031629},
+{"ZHD",-6.754171459},
+{"HYU",-6.754233751},
+{"PRL",-6.754265488},
+{"CPO",-6.754300754},
+{"RNC",-6.75505496},
+{"SRH",-6.755065558},
+{"PLL",-6.755501511},
+{"GHK",-6.755954422},
+{"DTD",-6.755995726},
+{"OMK",-6.756092512},
+{"PSM",-6.756469238},
+{"PCF",-6.757138466},
+{"KAJ",-6.757391764},
+{"DHP",-6.757811097},
+{"KSD",-6.758133571},
+{"PSF",-6.758313881},
+{"EPD",-6.75944728},
+{"CPD",-6.761290307},
+{"MSN",-6.761314201},
+{"UKD",-6.761323758},
+{"FPS",-6.761749298},
+{"THV",-6.761809099},
+{"YGN",-6.763836406},
+{"DPS",-6.764253591},
+{"YOW",-6.764317346},
+{"YAJ",-6.765069882},
+{"FSC",-6.765594418},
+{"HMG",-6.766512371},
+{"IHL",-6.767045917},
+{"VSE",-6.767147619},
+{"OXS",-6.76718758},
+{"IIG",-6.767215434},
+{"BPD",-6.767919636},
+{"MRC",-6.768648067},
+{"CYI",-6.769472668},
+{"CGT",-6.769712558},
+{"ZOY",-6.769768593},
+{"EYK",-6.769783211},
+{"YKJ",-6.769783211},
+{"SCF",-6.77010373},
+{"TRH",-6.770293959},
+{"YWC",-6.770445226},
+{"VGL",-6.7705221},
+{"ZFE",-6.770874917},
+{"OAI",-6.771015392},
+{"PPD",-6.771295254},
+{"GSR",-6.771642583},
+{"OVL",-6.771881227},
+{"KSU",-6.771980394},
+{"IMT",-6.772545224},
+{"FML",-6.772697278},
+{"SFC",-6.773629155},
+{"IJM",-6.773688155},
+{"WTS",-6.773738557},
+{"OIO",-6.773813557},
+{"WBC",-6.77388365},
+{"KIY",-6.773926696},
+{"CWI",-6.774033713},
+{"ZOU",-6.775073273},
+{"BBB",-6.775217579},
+{"MSL",-6.775284198},
+{"CPE",-6.775555715},
+{"UIJ",-6.775756994},
+{"AHH",-6.776238959},
+{"CUJ",-6.776894797},
+{"YUH",-6.777120238},
+{"LZM",-6.778034348},
+{"KKH",-6.778315045},
+{"XLY",-6.778568572},
+{"XPS",-6.778743891},
+{"WBY",-6.779572952},
+{"PMN",-6.779594135},
+{"KHW",-6.780753294},
+{"UPJ",-6.782309102},
+{"PJO",-6.782309102},
+{"PBL",-6.783054558},
+{"IEA",-6.783127415},
+{"GFP",-6.783715745},
+{"FGR",-6.783768583},
+{"TDN",-6.784803991},
+{"RDK",-6.784849394},
+{"LIY",-6.784906154},
+{"DPP",-6.785615652},
+{"AMZ",-6.785712951},
+{"FAF",-6.786047978},
+{"ZVI",-6.786654212},
+{"DSD",-6.787501065},
+{"UOX",-6.788929746},
+{"HPS",-6.789082552},
+{"CTV",-6.789254523},
+{"EBH",-6.789629275},
+{"TJO",-6.790129446},
+{"NTJ",-6.790129446},
+{"LGH",-6.790197116},
+{"ALQ",-6.790345259},
+{"HLS",-6.790350369},
+{"CDF",-6.790536899},
+{"PKC",-6.79235401},
+{"YSV",-6.793039801},
+{"JNO",-6.793136207},
+{"CSD",-6.793361237},
+{"IPX",-6.794053774},
+{"FSS",-6.794526828},
+{"IIO",-6.794546173},
+{"CMN",-6.794637754},
+{"XYC",-6.794941011},
+{"BPH",-6.795672279},
+{"PFO",-6.796048729},
+{"RYX",-6.796095323},
+{"EEQ",-6.796280454},
+{"DBS",-6.796705387},
+{"VHI",-6.796789645},
+{"RYU",-6.796792238},
+{"XCV",-6.796928384},
+{"DCI",-6.797235841},
+{"PNS",-6.798186831},
+{"WEU",-6.798462644},
+{"SKB",-6.799003068},
+{"IQS",-6.799371984},
+{"RFM",-6.799749045},
+{"DFS",-6.800174774},
+{"KJE",-6.801100803},
+{"GZI",-6.801737612},
+{"HPO",-6.80208655},
+{"KKU",-6.802414754},
+{"ZSI",-6.802418694},
+{"VAV",-6.802564498},
+{"OMD",-6.803182408},
+{"SKJ",-6.803242931},
+{"KJO",-6.803242931},
+{"IGC",-6.803510125},
+{"GPM",-6.803770896},
+{"YLH",-6.80412279},
+{"YFE",-6.804180807},
+{"CYX",-6.804323246},
+{"CBO",-6.80455679},
+{"KWR",-6.804622785},
+{"ZNS",-6.806161999},
+{"LYK",-6.806818218},
+{"NLD",-6.807375789},
+{"CVE",-6.807430257},
+{"FEH",-6.809274233},
+{"GUH",-6.810396428},
+{"CNT",-6.810851475},
+{"EWK",-6.811164932},
+{"MLS",-6.811327108},
+{"CFM",-6.811410229},
+{"FCR",-6.811736166},
+{"WMD",-6.811805946},
+{"EMD",-6.811933456},
+{"OZS",-6.81211472},
+{"BRN",-6.812335024},
+{"YJA",-6.812856677},
+{"PYJ",-6.812856677},
+{"MKH",-6.813508278},
+{"HFR",-6.813967948},
+{"TPN",-6.814957686},
+{"WAJ",-6.816646657},
+{"TCM",-6.816895071},
+{"TMP",-6.817067551},
+{"MFN",-6.817121889},
+{"CCK",-6.817687414},
+{"VIH",-6.817749993},
+{"EBM",-6.818124297},
+{"YUD",-6.819515445},
+{"MHS",-6.819600149},
+{"SVP",-6.820281113},
+{"FDM",-6.820804182},
+{"RSG",-6.820987817},
+{"CDP",-6.821134506},
+{"XOI",-6.82215585},
+{"KYP",-6.822721091},
+{"MPP",-6.822740358},
+{"NKJ",-6.822781647},
+{"BGO",-6.823171335},
+{"UGR",-6.824516582},
+{"SDF",-6.82463544},
+{"WWF",-6.824920279},
+{"RFP",-6.826011583},
+{"XRD",-6.82721269},
+{"KYN",-6.827627253},
+{"ZEV",-6.827756711},
+{"UMH",-6.827794303},
+{"XFA",-6.82790849},
+{"CPB",-6.828419918},
+{"SBC",-6.831098352},
+{"NUZ",-6.8311208},
+{"BJA",-6.831231656},
+{"IJD",-6.832061865},
+{"FDP",-6.832579618},
+{"MHD",-6.832926069},
+{"MDL",-6.833264336},
+{"PDM",-6.833489994},
+{"KRT",-6.833960022},
+{"CNO",-6.834027815},
+{"JDB",-6.834215715},
+{"IZD",-6.834340085},
+{"AEI",-6.834730385},
+{"FIP",-6.834762925},
+{"NLM",-6.835323576},
+{"HIY",-6.835609843},
+{"PCL",-6.835679313},
+{"RFT",-6.835805521},
+{"TFS",-6.836451314},
+{"SBS",-6.837189118},
+{"CZI",-6.837515061},
+{"WUT",-6.837688807},
+{"KGO",-6.838902696},
+{"NKG",-6.838902696},
+{"AGF",-6.839872247},
+{"NPD",-6.840950158},
+{"BYD",-6.840986039},
+{"BGP",-6.842661379},
+{"TMJ",-6.843702912},
+{"HRP",-6.843886377},
+{"UGW",-6.844435789},
+{"CGM",-6.844508132},
+{"VAQ",-6.844987346},
+{"FLS",-6.845311948},
+{"UVU",-6.845552658},
+{"RVN",-6.845851556},
+{"OPJ",-6.846131778},
+{"PJE",-6.846131778},
+{"MRT",-6.846787304},
+{"EKG",-6.846845492},
+{"LCC",-6.847044843},
+{"WLR",-6.847171486},
+{"CFU",-6.847535609},
+{"PBX",-6.84842827},
+{"RVS",-6.849058029},
+{"PSG",-6.849438372},
+{"ZEW",-6.849568643},
+{"XUN",-6.849996323},
+{"AJM",-6.850068132},
+{"SND",-6.851334809},
+{"CFO",-6.851453888},
+{"DWT",-6.851453888},
+{"IHC",-6.851730393},
+{"CCM",-6.851871656},
+{"ORJ",-6.852599295},
+{"UTV",-6.852833754},
+{"NPN",-6.853424149},
+{"FIU",-6.853576306},
+{"CLV",-6.853664965},
+{"BPM",-6.854036054},
+{"NYU",-6.854263891},
+{"PDC",-6.854358612},
+{"OPG",-6.854697704},
+{"DYB",-6.855029648},
+{"LTN",-6.855654214},
+{"XYA",-6.856018092},
+{"RCC",-6.856136975},
+{"YSW",-6.856254404},
+{"ZAF",-6.856525059},
+{"XOU",-6.856847982},
+{"SCT",-6.857352939},
+{"EOH",-6.857433429},
+{"LZI",-6.857813721},
+{"KKO",-6.85851702},
+{"TCC",-6.859570363},
+{"LPG",-6.859654262},
+{"PMT",-6.860294521},
+{"YDB",-6.861305562},
+{"YHA",-6.86155079},
+{"LCK",-6.861638082},
+{"VCS",-6.861907595},
+{"EYP",-6.862080834},
+{"WFP",-6.862524038},
+{"HHI",-6.862533088},
+{"WLD",-6.862750337},
+{"SLR",-6.862996382},
+{"JIU",-6.864916693},
+{"OIP",-6.865918803},
+{"APF",-6.866464862},
+{"ZNO",-6.866745003},
+{"UHO",-6.866786126},
+{"VOP",-6.867054281},
+{"DRC",-6.867139638},
+{"UYN",-6.867523952},
+{"CWA",-6.867792564},
+{"VMS",-6.868169816},
+{"HKA",-6.868929897},
+{"HDT",-6.868954389},
+{"LMQ",-6.869004907},
+{"EBK",-6.869017154},
+{"BKN",-6.869017154},
+{"YLB",-6.869772587},
+{"IKY",-6.869964335},
+{"QCD",-6.870772142},
+{"HLG",-6.870953568},
+{"PVA",-6.871516777},
+{"HUV",-6.871790952},
+{"LLV",-6.871940435},
+{"DRZ",-6.872222589},
+{"ZEJ",-6.872222589},
+{"HYK",-6.873360774},
+{"UDM",-6.873408714},
+{"AAU",-6.873526268},
+{"ZEF",-6.873872926},
+{"VGA",-6.875736304},
+{"PYW",-6.876378935},
+{"FPR",-6.876612571},
+{"UKL",-6.876653081},
+{"FMR",-6.877144173},
+{"CDT",-6.877917013},
+{"QUT",-6.878099885},
+{"LPW",-6.879382152},
+{"ESG",-6.879760196},
+{"IID",-6.879906168},
+{"CTC",-6.879946986},
+{"ZKR",-6.880019212},
+{"MVP",-6.88073899},
+{"AZH",-6.880772021},
+{"IGD",-6.880863264},
+{"HLT",-6.881104049},
+{"WCR",-6.881159149},
+{"TPS",-6.881661671},
+{"YZS",-6.881817744},
+{"ZST",-6.881817744},
+{"OFY",-6.881822475},
+{"PEH",-6.881876089},
+{"PRT",-6.881962832},
+{"XEU",-6.882082724},
+{"RCQ",-6.882592635},
+{"PII",-6.882736402},
+{"XMO",-6.883413221},
+{"EXM",-6.883413221},
+{"VLD",-6.884254387},
+{"PNA",-6.884495473},
+{"HPR",-6.884947871},
+{"QNS",-6.886209133},
+{"FDD",-6.88674943},
+{"NLS",-6.886794086},
+{"NCN",-6.886878627},
+{"UPM",-6.886924892},
+{"EUA",-6.887248886},
+{"BOJ",-6.887656216},
+{"XHT",-6.888009545},
+{"HDY",-6.888407984},
+{"ECF",-6.888592125},
+{"HHA",-6.889000718},
+{"BTH",-6.889872062},
+{"FHY",-6.891337869},
+{"AAI",-6.891339481},
+{"TYX",-6.891400731},
+{"TRC",-6.891828111},
+{"EQQ",-6.891829725},
+{"SCP",-6.892330215},
+{"SCN",-6.893281119},
+{"UZH",-6.893616372},
+{"BMJ",-6.894026477},
+{"CLL",-6.895381116},
+{"HLM",-6.895519416},
+{"FMC",-6.895599162},
+{"DRV",-6.895843374},
+{"YOZ",-6.895864545},
+{"TOJ",-6.895973676},
+{"VNI",-6.896265369},
+{"FLN",-6.896529529},
+{"FSL",-6.896586621},
+{"SLN",-6.896586621},
+{"VSS",-6.896886889},
+{"CGS",-6.89739161},
+{"PLP",-6.897641738},
+{"AAH",-6.898021291},
+{"JAJ",-6.898180082},
+{"DLS",-6.898304537},
+{"DNP",-6.89851914},
+{"FRP",-6.898792873},
+{"SPX",-6.89959868},
+{"AQS",-6.899861588},
+{"XEY",-6.900228281},
+{"JFE",-6.90077808},
+{"HBC",-6.900779727},
+{"MFC",-6.900860445},
+{"DDC",-6.901552929},
+{"DLP",-6.901919402},
+{"GBU",-6.902048237},
+{"TTT",-6.902153976},
+{"KKN",-6.902391982},
+{"CKK",-6.902391982},
+{"FWH",-6.903492806},
+{"WHM",-6.903492806},
+{"OEG",-6.903776326},
+{"VYS",-6.905328187},
+{"KCR",-6.906009498},
+{"AEE",-6.906313018},
+{"XSE",-6.908254213},
+{"PGS",-6.908482174},
+{"NLF",-6.909270904},
+{"ZIF",-6.910305133},
+{"QLD",-6.91041627},
+{"LTT",-6.911539337},
+{"CLT",-6.911642346},
+{"ZTS",-6.911954899},
+{"QSA",-6.9124453},
+{"ABP",-6.912678859},
+{"CVP",-6.913251438},
+{"SMP",-6.913253133},
+{"BGL",-6.914111724},
+{"BHP",-6.914679394},
+{"TFP",-6.914893738},
+{"DCT",-6.914985632},
+{"CPG",-6.915012864},
+{"HSW",-6.915252916},
+{"MGH",-6.915358513},
+{"ZAJ",-6.915909054},
+{"IDJ",-6.915963635},
+{"LRC",-6.916723361},
+{"YSD",-6.916841281},
+{"UHI",-6.917248263},
+{"AUW",-6.917366325},
+{"FPC",-6.917883438},
+{"QOL",-6.918243383},
+{"PLR",-6.918751242},
+{"KIU",-6.919058647},
+{"ZBI",-6.920297342},
+{"CFD",-6.920480004},
+{"BMC",-6.921214874},
+{"MFS",-6.9222849},
+{"HBH",-6.922974292},
+{"BHB",-6.922974292},
+{"YXE",-6.923093921},
+{"GJI",-6.92320838},
+{"NGJ",-6.92320838},
+{"JIR",-6.923394006},
+{"ALX",-6.924269424},
+{"ETV",-6.924448547},
+{"ICQ",-6.924523348},
+{"WCC",-6.927032286},
+{"FAP",-6.927328101},
+{"TLL",-6.927345611},
+{"MHI",-6.928383474},
+{"IMD",-6.928738178},
+{"DSR",-6.928912123},
+{"DNB",-6.931356476},
+{"DVT",-6.931414801},
+{"DNR",-6.931481973},
+{"CAZ",-6.932992539},
+{"WNA",-6.93301915},
+{"TLN",-6.933095442},
+{"SPM",-6.934156047},
+{"GIK",-6.93460986},
+{"PRD",-6.934681089},
+{"AQA",-6.934953649},
+{"QAB",-6.934953649},
+{"WOJ",-6.935638477},
+{"UAU",-6.93575629},
+{"KGA",-6.935767002},
+{"PDG",-6.935956289},
+{"DGF",-6.935956289},
+{"FSM",-6.937151058},
+{"UFB",-6.937211957},
+{"HCC",-6.937418004},
+{"XIK",-6.938676115},
+{"LPC",-6.938814532},
+{"VOZ",-6.938888252},
+{"PPC",-6.939075307},
+{"MUA",-6.939530691},
+{"OWG",-6.93965677},
+{"LHY",-6.93974685},
+{"DMZ",-6.940091125},
+{"PCE",-6.940280503},
+{"RHS",-6.940356277},
+{"MTB",-6.940899713},
+{"TYG",-6.941042455},
+{"PHC",-6.941394994},
+{"RHW",-6.941776782},
+{"OXW",-6.941822039},
+{"XWO",-6.941822039},
+{"BCP",-6.941852817},
+{"KPD",-6.942307499},
+{"GML",-6.943176522},
+{"SGM",-6.943176522},
+{"POQ",-6.943628957},
+{"XYM",-6.944544351},
+{"TLU",-6.944877867},
+{"VBS",-6.945750226},
+{"IGV",-6.948085735},
+{"WHU",-6.948526768},
+{"XMI",-6.948747452},
+{"AJC",-6.949961382},
+{"TRW",-6.95048558},
+{"MRU",-6.950607491},
+{"RTP",-6.950638898},
+{"GSK",-6.951546987},
+{"DTC",-6.952455123},
+{"OEE",-6.953179284},
+{"SWR",-6.953893487},
+{"OEP",-6.954161616},
+{"PVD",-6.954370275},
+{"OPN",-6.955161109},
+{"JPL",-6.955489803},
+{"ZAY",-6.956056263},
+{"FDN",-6.956222789},
+{"WTP",-6.95674711},
+{"BUA",-6.95677709},
+{"GNG",-6.957469085},
+{"BYH",-6.958481872},
+{"PKU",-6.958756614},
+{"DHH",-6.958811207},
+{"VNE",-6.959334894},
+{"LMB",-6.959338664},
+{"LCM",-6.959361283},
+{"UHM",-6.95940087},
+{"PLD",-6.959574342},
+{"HCN",-6.960493768},
+{"CVA",-6.961210646},
+{"TYW",-6.961543952},
+{"CDD",-6.961917332},
+{"WTU",-6.962097503},
+{"EJM",-6.962959564},
+{"MTF",-6.963096436},
+{"CMM",-6.963482571},
+{"CTW",-6.963709086},
+{"YAI",-6.965798966},
+{"CGH",-6.967581866},
+{"VUD",-6.967825906},
+{"MFG",-6.968085469},
+{"AVP",-6.968843898},
+{"ABK",-6.969578563},
+{"WUM",-6.970163714},
+{"BRS",-6.97019077},
+{"WDM",-6.971458478},
+{"GMC",-6.971982124},
+{"DZI",-6.972011234},
+{"PRN",-6.972376245},
+{"RUU",-6.972432577},
+{"SIW",-6.972759059},
+{"PNC",-6.97294962},
+{"CXI",-6.97306244},
+{"PGO",-6.973076058},
+{"YAA",-6.973122753},
+{"VAO",-6.973311527},
+{"FDG",-6.973560757},
+{"PTP",-6.973586077},
+{"RLL",-6.974592296},
+{"XUE",-6.974809055},
+{"SLP",-6.975147103},
+{"TWY",-6.975773088},
+{"YUZ",-6.975806368},
+{"OYU",-6.975806368},
+{"FYF",-6.976896251},
+{"IUG",-6.977611256},
+{"YEC",-6.977735126},
+{"NMS",-6.977902309},
+{"MMF",-6.978024294},
+{"GNL",-6.979305243},
+{"DAJ",-6.979439468},
+{"HSB",-6.979889822},
+{"BMT",-6.980322838},
+{"RLV",-6.980328773},
+{"PGP",-6.980401974},
+{"KBY",-6.980425718},
+{"LBM",-6.981097015},
+{"FTT",-6.983617183},
+{"NRR",-6.98374876},
+{"NPP",-6.984091846},
+{"FPG",-6.984610979},
+{"CRH",-6.985216752},
+{"SDY",-6.985512949},
+{"MDU",-6.985891494},
+{"EOY",-6.985905521},
+{"SDH",-6.986713813},
+{"GBS",-6.986890514},
+{"TJE",-6.987744912},
+{"ETJ",-6.987744912},
+{"UDV",-6.987865668},
+{"GOH",-6.988526398},
+{"EZB",-6.989396143},
+{"ZBO",-6.989396143},
+{"JAA",-6.989640631},
+{"OUY",-6.989703291},
+{"MTC",-6.990190727},
+{"NCP",-6.990380996},
+{"SLS",-6.990735442},
+{"GVH",-6.991053677},
+{"PRZ",-6.991120596},
+{"SVC",-6.991339679},
+{"HTP",-6.991658357},
+{"OGF",-6.992040267},
+{"CFP",-6.992186619},
+{"WDH",-6.992316752},
+{"OFC",-6.992453026},
+{"TWP",-6.992520162},
+{"LHR",-6.99256289},
+{"TXT",-6.993188016},
+{"WMS",-6.993346986},
+{"DDD",-6.993599828},
+{"ZSA",-6.993612066},
+{"IZS",-6.993612066},
+{"EFN",-6.99398345},
+{"RZK",-6.994375584},
+{"MNR",-6.994892843},
+{"YOA",-6.995923062},
+{"WNM",-6.996423692},
+{"CGL",-6.996460647},
+{"TGL",-6.996460647},
+{"PSR",-6.99654894},
+{"ZGI",-6.99686119},
+{"VCC",-6.997449322},
+{"XYH",-6.997589275},
+{"AIY",-6.997751924},
+{"TMV",-6.99776428},
+{"FGF",-6.997784873},
+{"ZMI",-6.998188701},
+{"NUH",-6.998308273},
+{"AFH",-6.999028464},
+{"FMD",-6.99935077},
+{"SVS",-6.999813986},
+{"VST",-6.999813986},
+{"QTL",-6.999813986},
+{"NLP",-6.999832608},
+{"DMF",-7.000455861},
+{"HLV",-7.000955523},
+{"ELJ",-7.001754934},
+{"UGC",-7.002224884},
+{"YIP",-7.002601627},
+{"RGV",-7.00335401},
+{"IXB",-7.003372784},
+{"XBY",-7.003372784},
+{"MBT",-7.00341868},
+{"BZH",-7.003445802},
+{"OBZ",-7.003445802},
+{"PMC",-7.003650318},
+{"DAX",-7.004076355},
+{"GDU",-7.004471439},
+{"BSS",-7.004475622},
+{"BPE",-7.004816648},
+{"AZN",-7.005151658},
+{"IDH",-7.005329737},
+{"TFT",-7.005602235},
+{"YIC",-7.00569031},
+{"ITP",-7.006313631},
+{"LTC",-7.006868447},
+{"MLC",-7.00706827},
+{"DTT",-7.007263975},
+{"YLD",-7.007640904},
+{"IVS",-7.007676719},
+{"APJ",-7.007704108},
+{"GCM",-7.008321889},
+{"RPG",-7.008378862},
+{"SZI",-7.009795032},
+{"WAE",-7.009816204},
+{"MTT",-7.010121193},
+{"HCF",-7.010649077},
+{"IVC",-7.012128019},
+{"MQU",-7.013407025},
+{"PUK",-7.014013736},
+{"OOX",-7.014139885},
+{"FBE",-7.014544235},
+{"FFB",-7.014544235},
+{"SDK",-7.014689808},
+{"DCF",-7.014758329},
+{"HRC",-7.015279019},
+{"PBG",-7.015723062},
+{"BGC",-7.015723062},
+{"JDS",-7.016103111},
+{"UAF",-7.016229868},
+{"TJI",-7.016446945},
+{"CSL",-7.016943836},
+{"NJY",-7.017100981},
+{"MVA",-7.01732711},
+{"NXE",-7.017758159},
+{"SQR",-7.017863831},
+{"CMT",-7.017889714},
+{"ITJ",-7.018937105},
+{"TJA",-7.018937105},
+{"JND",-7.019636049},
+{"GSS",-7.019737847},
+{"IXF",-7.01998486},
+{"IZC",-7.020407709},
+{"RZS",-7.021028632},
+{"IFK",-7.021046013},
+{"FKI",-7.021046013},
+{"WOY",-7.021178568},
+{"DOJ",-7.021335078},
+{"PWM",-7.021409006},
+{"DCM",-7.021443799},
+{"TCS",-7.021724425},
+{"AXC",-7.021750539},
+{"LNW",-7.022092341},
+{"MZA",-7.022905474},
+{"FUA",-7.023936612},
+{"NMY",-7.024085367},
+{"MVS",-7.024210099},
+{"RPF",-7.024477189},
+{"SKM",-7.02477293},
+{"OXG",-7.024974588},
+{"XGL",-7.024974588},
+{"TBT",-7.025878816},
+{"VSN",-7.027551763},
+{"GPR",-7.027871677},
+{"CFI",-7.028006333},
+{"AQF",-7.028061531},
+{"WAQ",-7.028061531},
+{"VSD",-7.028720039},
+{"LCP",-7.029432704},
+{"PGE",-7.029521316},
+{"MTG",-7.029827165},
+{"LMW",-7.029973517},
+{"HJA",-7.031255091},
+{"SVM",-7.031457557},
+{"SCD",-7.032134611},
+{"NGQ",-7.033337646},
+{"GQI",-7.033337646},
+{"BMR",-7.033507545},
+{"VCO",-7.034396124},
+{"PFF",-7.034474549},
+{"ZIV",-7.035187751},
+{"RDJ",-7.035643646},
+{"GYB",-7.035765},
+{"KMI",-7.036275504},
+{"VIY",-7.036953356},
+{"EEY",-7.03735471},
+{"MDC",-7.037650326},
+{"MLP",-7.037788048},
+{"DYT",-7.038312241},
+{"WBS",-7.038726169},
+{"PDU",-7.038882342},
+{"GMD",-7.039138226},
+{"AHV",-7.039355732},
+{"WWO",-7.03949853},
+{"OWW",-7.03949853},
+{"CMY",-7.039582417},
+{"LTB",-7.039772924},
+{"SRM",-7.039986209},
+{"BHC",-7.040151918},
+{"SRT",-7.040417638},
+{"OMH",-7.042387211},
+{"TNY",-7.04331932},
+{"YNS",-7.043683111},
+{"KNT",-7.044120522},
+{"USW",-7.044125104},
+{"SGB",-7.045077029},
+{"GPC",-7.045571017},
+{"PCK",-7.045729672},
+{"CMR",-7.046657468},
+{"PRF",-7.046763496},
+{"PVP",-7.047716608},
+{"KSR",-7.047788233},
+{"RGT",-7.049956444},
+{"CLP",-7.05008651},
+{"RLC",-7.050860742},
+{"TLT",-7.051149398},
+{"VMA",-7.051219263},
+{"GNN",-7.051547779},
+{"SPQ",-7.052401684},
+{"KLM",-7.052602572},
+{"PBC",-7.053201115},
+{"NRM",-7.054105169},
+{"HGH",-7.054400682},
+{"DHT",-7.054940631},
+{"LJE",-7.055382479},
+{"SPT",-7.055396588},
+{"OIZ",-7.056069646},
+{"KKK",-7.056795647},
+{"AVC",-7.056871145},
+{"EHS",-7.056911259},
+{"SMB",-7.057499233},
+{"FLR",-7.057695402},
+{"STK",-7.057754506},
+{"TKN",-7.057754506},
+{"RZF",-7.05783963},
+{"UOH",-7.058000466},
+{"XAZ",-7.058829241},
+{"ECP",-7.059286929},
+{"JNR",-7.059405579},
+{"GBT",-7.059543255},
+{"LGB",-7.059543255},
+{"OMG",-7.060201376},
+{"PMI",-7.060791443},
+{"ZDI",-7.062093376},
+{"SRP",-7.062853447},
+{"UOA",-7.062913258},
+{"BSD",-7.063828188},
+{"EMR",-7.063837778},
+{"MBM",-7.064425608},
+{"MQV",-7.06522826},
+{"QVI",-7.06522826},
+{"SSD",-7.065533849},
+{"NRW",-7.06579389},
+{"SLC",-7.065887832},
+{"NKU",-7.066073366},
+{"FKO",-7.06612157},
+{"EFK",-7.06612157},
+{"DWH",-7.066193886},
+{"CVC",-7.066242103},
+{"ABG",-7.066287914},
+{"XSA",-7.066599077},
+{"ZEY",-7.067381585},
+{"NDZ",-7.067381585},
+{"OBC",-7.067543576},
+{"SNS",-7.06761371},
+{"HTD",-7.067737078},
+{"DPM",-7.068155819},
+{"YOH",-7.068359285},
+{"WTR",-7.068385936},
+{"CPK",-7.068431974},
+{"AXF",-7.068434397},
+{"XFI",-7.068434397},
+{"VRM",-7.069006648},
+{"DLR",-7.069237216},
+{"XSW",-7.069842129},
+{"PPG",-7.071027672},
+{"AVM",-7.071242243},
+{"KSV",-7.071266633},
+{"XRA",-7.071964762},
+{"HMC",-7.073410964},
+{"BNP",-7.073437927},
+{"RTD",-7.07411255},
+{"TYD",-7.074594014},
+{"BFU",-7.074699712},
+{"OBF",-7.074699712},
+{"PDT",-7.074758718},
+{"LMC",-7.074923485},
+{"NHK",-7.075270437},
+{"LTV",-7.076732647},
+{"TDC",-7.076895694},
+{"UUT",-7.077622737},
+{"CFE",-7.07877018},
+{"BPP",-7.079157475},
+{"DMC",-7.079294104},
+{"EUH",-7.081463557},
+{"LRR",-7.082723868},
+{"BUJ",-7.082786479},
+{"YSG",-7.082956826},
+{"JMS",-7.083014459},
+{"KHP",-7.0831498},
+{"ZRE",-7.083510916},
+{"MTX",-7.083515933},
+{"CTP",-7.083889908},
+{"SDC",-7.08468662},
+{"PKK",-7.084701714},
+{"FWE",-7.084885398},
+{"EFW",-7.084885398},
+{"JBL",-7.084918116},
+{"VFR",-7.085678897},
+{"TDD",-7.086360194},
+{"IAJ",-7.086385448},
+{"TPD",-7.086425857},
+{"TZF",-7.086441012},
+{"MKS",-7.086794764},
+{"PUH",-7.087764005},
+{"LFV",-7.087791875},
+{"FVE",-7.087791875},
+{"WCT",-7.087850152},
+{"HCT",-7.090710282},
+{"CTD",-7.090730688},
+{"ACZ",-7.091379087},
+{"GKA",-7.09155795},
+{"IZH",-7.092894084},
+{"JEG",-7.09299664},
+{"BSQ",-7.093291622},
+{"LMG",-7.093686956},
+{"CND",-7.09444783},
+{"MMW",-7.094573914},
+{"MWR",-7.094573914},
+{"CRL",-7.094671719},
+{"KPC",-7.095741286},
+{"KVP",-7.096570401},
+{"UVB",-7.09955381},
+{"IHS",-7.099611084},
+{"GIY",-7.100920034},
+{"BYB",-7.101562914},
+{"YBL",-7.101562914},
+{"DBH",-7.101617838},
+{"NCB",-7.101727708},
+{"OSR",-7.101730324},
+{"KSZ",-7.102715161},
+{"TLB",-7.103035189},
+{"QAZ",-7.103140168},
+{"JIF",-7.103142793},
+{"PDB",-7.104159781},
+{"RLR",-7.104170305},
+{"OFD",-7.10422556},
+{"ZTL",-7.1042624},
+{"SZK",-7.104351883},
+{"FBS",-7.105118506},
+{"EPZ",-7.105179156},
+{"NPY",-7.105398094},
+{"QED",-7.105632981},
+{"THZ",-7.105841583},
+{"RTV",-7.106124279},
+{"AMV",-7.106140137},
+{"NMU",-7.107052924},
+{"IIJ",-7.107556438},
+{"IZY",-7.107585607},
+{"DNC",-7.109078476},
+{"MFY",-7.109086459},
+{"PPF",-7.10915565},
+{"PCV",-7.109416545},
+{"EAY",-7.110437672},
+{"AOA",-7.110656606},
+{"SWF",-7.111656565},
+{"SBP",-7.111699395},
+{"CWM",-7.114398178},
+{"KCH",-7.114538273},
+{"UKC",-7.114538273},
+{"ULQ",-7.116025534},
+{"LFB",-7.116120178},
+{"GSF",-7.11654498},
+{"UOP",-7.118009261},
+{"UJJ",-7.118155961},
+{"JJA",-7.118155961},
+{"GCO",-7.118931033},
+{"TKO",-7.119116167},
+{"TSL",-7.120261394},
+{"IQH",-7.120269585},
+{"DIY",-7.120583692},
+{"TBC",-7.120682068},
+{"WUS",-7.120813271},
+{"MGS",-7.12093084},
+{"EOQ",-7.121401437},
+{"DRM",-7.121639665},
+{"TKR",-7.12209732},
+{"RZU",-7.122986605},
+{"JKO",-7.123044307},
+{"AJK",-7.123044307},
+{"YPD",-7.123990608},
+{"TMD",-7.123993362},
+{"MTM",-7.124081495},
+{"TPM",-7.124260572},
+{"VHE",-7.124588611},
+{"CLB",-7.124594126},
+{"XAF",-7.124599641},
+{"BNF",-7.125972406},
+{"FLL",-7.126817},
+{"AVF",-7.127352298},
+{"PYK",-7.127457772},
+{"HHH",-7.127502189},
+{"OZU",-7.127507742},
+{"FYN",-7.127574377},
+{"CWS",-7.128711533},
+{"TSR",-7.12941645},
+{"MDP",-7.129860048},
+{"SRD",-7.129966132},
+{"MVD",-7.130866097},
+{"DBP",-7.130899672},
+{"PVS",-7.131386803},
+{"OXP",-7.132169036},
+{"OHT",-7.133247966},
+{"SVD",-7.134259084},
+{"EIY",-7.134278822},
+{"FOF",-7.134812109},
+{"HDP",-7.134970246},
+{"FCI",-7.134987193},
+{"SOQ",-7.135086061},
+{"BDS",-7.135094537},
+{"DLN",-7.135569429},
+{"LRS",-7.135767454},
+{"XOK",-7.135787262},
+{"FPM",-7.13580141},
+{"QIU",-7.136149615},
+{"QTY",-7.136897925},
+{"CUK",-7.13703412},
+{"UCD",-7.137286761},
+{"XBO",-7.138757264},
+{"GLS",-7.139481545},
+{"BKS",-7.139575733},
+{"TUH",-7.139878415},
+{"VEV",-7.139926978},
+{"XVM",-7.140647491},
+{"PWS",-7.14091656},
+{"SRL",-7.141240236},
+{"AOB",-7.141311878},
+{"YXO",-7.141343404},
+{"JCP",-7.142043306},
+{"IBP",-7.142474134},
+{"ZIK",-7.14253161},
+{"HTB",-7.142583344},
+{"NYV",-7.142767341},
+{"LHC",-7.143089522},
+{"CFL",-7.143550196},
+{"IBC",-7.143968104},
+{"TBP",-7.144331579},
+{"NAQ",-7.145420938},
+{"GNB",-7.145609035},
+{"MTU",-7.14561193},
+{"XEW",-7.14597099},
+{"MGD",-7.146333246},
+{"VOJ",-7.147203896},
+{"OJV",-7.147203896},
+{"JVO",-7.147203896},
+{"MKA",-7.147689315},
+{"KSY",-7.147904584},
+{"IUP",-7.14882213},
+{"MTN",-7.149005871},
+{"RYY",-7.149437825},
+{"IAQ",-7.149467027},
+{"SPG",-7.149583853},
+{"TNG",-7.14977084},
+{"VDT",-7.149928672},
+{"LNV",-7.149957907},
+{"DMD",-7.150212331},
+{"BWO",-7.150469831},
+{"EHD",-7.150554723},
+{"KXP",-7.150791921},
+{"RKX",-7.150791921},
+{"AHP",-7.150926684},
+{"UAX",-7.150976499},
+{"IVL",-7.151052696},
+{"LTG",-7.151692111},
+{"MVC",-7.151774306},
+{"ESJ",-7.151841835},
+{"SJA",-7.151841835},
+{"DMT",-7.152247229},
+{"FUO",-7.152626527},
+{"OOU",-7.152720667},
+{"DML",-7.152897236},
+{"PRM",-7.153397905},
+{"RBF",-7.153453897},
+{"EUY",-7.153515793},
+{"XVN",-7.153595385},
+{"DPC",-7.1542297},
+{"VDC",-7.154256273},
+{"FLC",-7.154433467},
+{"PRB",-7.154743732},
+{"HTV",-7.155261332},
+{"PMR",-7.155726218},
+{"TPP",-7.156093742},
+{"JPS",-7.156802993},
+{"XTV",-7.157287373},
+{"VHP",-7.159081009},
+{"IIP",-7.159660606},
+{"LSF",-7.160112271},
+{"ECN",-7.160453576},
+{"MSR",-7.160591371},
+{"MLT",-7.160672271},
+{"AZC",-7.160993023},
+{"CNV",-7.161139989},
+{"JVM",-7.161184989},
+{"NLC",-7.161196989},
+{"GCA",-7.16153014},
+{"MZI",-7.161608212},
+{"ZAZ",-7.161737362},
+{"GBM",-7.161845517},
+{"IJP",-7.161914631},
+{"JPH",-7.161914631},
+{"MTI",-7.163046045},
+{"UXM",-7.163483151},
+{"NDJ",-7.163805987},
+{"IWC",-7.164243859},
+{"EVC",-7.165042222},
+{"TPC",-7.165102764},
+{"FFF",-7.165454074},
+{"IMG",-7.166209139},
+{"MDM",-7.1667801},
+{"VOA",-7.1674492},
+{"SLD",-7.167613591},
+{"VSA",-7.167823737},
+{"DDP",-7.167881622},
+{"PFS",-7.168616507},
+{"VPS",-7.168744706},
+{"CCB",-7.168888211},
+{"TCT",-7.169111197},
+{"HZE",-7.169386268},
+{"CHZ",-7.169386268},
+{"BDC",-7.169499403},
+{"UOG",-7.16977472},
+{"SRB",-7.170080833},
+{"VMI",-7.170142082},
+{"PDL",-7.170270731},
+{"OYG",-7.170442324},
+{"TRT",-7.170586391},
+{"MLF",-7.170764243},
+{"SWD",-7.170797981},
+{"NSR",-7.171221471},
+{"TTC",-7.171765247},
+{"JMP",-7.171866705},
+{"DJS",-7.172217376},
+{"DPT",-7.17233433},
+{"KYM",-7.173419188},
+{"YML",-7.173419188},
+{"BCM",-7.174383038},
+{"LGT",-7.174398502},
+{"PCD",-7.174850286},
+{"HDC",-7.175321136},
+{"HGE",-7.175519542},
+{"YRM",-7.176099778},
+{"CLK",-7.176289221},
+{"CBL",-7.176342031},
+{"WGL",-7.176814503},
+{"GYU",-7.176870487},
+{"IZN",-7.176948256},
+{"KBS",-7.177119395},
+{"DZO",-7.177181645},
+{"PPV",-7.177222111},
+{"OPB",-7.177823332},
+{"MLD",-7.177916861},
+{"ZRU",-7.178116456},
+{"IUK",-7.179284679},
+{"HRR",-7.179387909},
+{"VVI",-7.179434839},
+{"NYN",-7.180390197},
+{"TRD",-7.1804341},
+{"RDG",-7.1804341},
+{"GBL",-7.181429378},
+{"CWC",-7.18169664},
+{"PZT",-7.181926301},
+{"HUZ",-7.182071082},
+{"JTS",-7.182943934},
+{"VTR",-7.182959706},
+{"VWF",-7.183016488},
+{"CBP",-7.183281571},
+{"HWN",-7.183919696},
+{"PMG",-7.183938665},
+{"KPM",-7.183938665},
+{"TLX",-7.184065143},
+{"SWB",-7.184226456},
+{"VDD",-7.184406818},
+{"IOQ",-7.184523936},
+{"HAX",-7.184732926},
+{"UUC",-7.184878645},
+{"UCP",-7.184878645},
+{"BYU",-7.184900824},
+{"PRG",-7.185246329},
+{"GRT",-7.186096997},
+{"DSN",-7.186300388},
+{"MDB",-7.186901585},
+{"FHR",-7.186911134},
+{"GCE",-7.186930234},
+{"CMB",-7.188444962},
+{"IOJ",-7.188620694},
+{"CGY",-7.188886023},
+{"FNI",-7.189257116},
+{"UOC",-7.189285921},
+{"DVB",-7.189526037},
+{"PFP",-7.18992332},
+{"MUX",-7.190327384},
+{"IVP",-7.190773573},
+{"SWS",-7.190995233},
+{"JKE",-7.191188073},
+{"PFD",-7.191213791},
+{"PLM",-7.191664111},
+{"DPG",-7.19223089},
+{"VDI",-7.192379147},
+{"AXU",-7.192672588},
+{"SWP",-7.192733881},
+{"DAA",-7.192785503},
+{"MSV",-7.193292368},
+{"YSY",-7.193676947},
+{"TUZ",-7.194123356},
+{"ZJA",-7.194217225},
+{"TZJ",-7.194217225},
+{"PTW",-7.194330542},
+{"CBN",-7.194819764},
+{"FPL",-7.195179742},
+{"NUY",-7.195907095},
+{"UYB",-7.196225696},
+{"QAM",-7.196385083},
+{"SNF",-7.19683103},
+{"AZS",-7.196853827},
+{"LMP",-7.197039512},
+{"WRS",-7.197815684},
+{"IIM",-7.19832519},
+{"WBI",-7.19864884},
+{"IJR",-7.198792762},
+{"EVV",-7.198877829},
+{"VVE",-7.198877829},
+{"IJL",-7.19930014},
+{"WIH",-7.199477044},
+{"DMK",-7.199775322},
+{"IHT",-7.200031152},
+{"NNN",-7.200142714},
+{"BJT",-7.200142714},
+{"KSN",-7.200159123},
+{"GWU",-7.200251023},
+{"LGW",-7.200251023},
+{"TCF",-7.200267436},
+{"WHS",-7.200717389},
+{"YLG",-7.200835702},
+{"LGL",-7.200835702},
+{"EAI",-7.200888296},
+{"JJI",-7.201352056},
+{"CJD",-7.201378383},
+{"HND",-7.201506752},
+{"IVT",-7.201618695},
+{"HCS",-7.20179984},
+{"VCE",-7.202419596},
+{"IVB",-7.202422895},
+{"COJ",-7.202752916},
+{"JCA",-7.202838763},
+{"NRL",-7.203473233},
+{"PVR",-7.203526147},
+{"DFG",-7.203893418},
+{"ZSE",-7.205173018},
+{"PMP",-7.206313243},
+{"ZTA",-7.206336545},
+{"IZT",-7.206336545},
+{"XIP",-7.206459728},
+{"HPC",-7.207222914},
+{"DHV",-7.207259608},
+{"FYC",-7.207519886},
+{"WIU",-7.207706849},
+{"JTY",-7.207763622},
+{"OJT",-7.207763622},
+{"EMW",-7.208498995},
+{"JYO",-7.208649565},
+{"BNC",-7.208672992},
+{"NHW",-7.208686379},
+{"TFC",-7.20888389},
+{"XLL",-7.209312697},
+{"KAX",-7.209533967},
+{"FWS",-7.209842591},
+{"UJR",-7.209856014},
+{"QIG",-7.209866082},
+{"PWD",-7.2099802},
+{"LFK",-7.210265628},
+{"FKN",-7.210265628},
+{"DPN",-7.210312657},
+{"QAN",-7.210931234},
+{"KIG",-7.211453002},
+{"EBC",-7.211860754},
+{"EAA",-7.213197898},
+{"BYX",-7.213285834},
+{"GLP",-7.213346724},
+{"AJF",-7.213377171},
+{"CBU",-7.213840921},
+{"GND",-7.214095008},
+{"IJT",-7.21448829},
+{"JTI",-7.21448829},
+{"BSK",-7.21457988},
+{"OYK",-7.214668097},
+{"IEO",-7.214881927},
+{"KPR",-7.215309904},
+{"AEW",-7.215765517},
+{"DHL",-7.215901614},
+{"ZOC",-7.215928838},
+{"CRD",-7.216133076},
+{"JUJ",-7.216374881},
+{"ZKY",-7.216405542},
+{"MRL",-7.2165248},
+{"PKG",-7.216627047},
+{"SVT",-7.21738101},
+{"NMC",-7.217480044},
+{"MDF",-7.217794369},
+{"FRD",-7.218327875},
+{"TUV",-7.218392898},
+{"FMV",-7.218536668},
+{"DFD",-7.218605146},
+{"WKY",-7.218649663},
+{"JRS",-7.218694185},
+{"OFW",-7.218886022},
+{"EHC",-7.219547823},
+{"WUC",-7.220062874},
+{"NOJ",-7.220300003},
+{"TNS",-7.220561338},
+{"AAE",-7.220743679},
+{"FCM",-7.220898556},
+{"SRR",-7.221112033},
+{"RKC",-7.221922133},
+{"OGP",-7.221960089},
+{"LHS",-7.222025658},
+{"XSO",-7.222243143},
+{"VNO",-7.222391648},
+{"HFS",-7.2224331},
+{"BAQ",-7.222761403},
+{"EKR",-7.222878961},
+{"HSD",-7.223304511},
+{"VUT",-7.223436066},
+{"RRR",-7.22379285},
+{"OEQ",-7.223796315},
+{"BDD",-7.22383097},
+{"PGM",-7.223928019},
+{"FLT",-7.224198485},
+{"LCT",-7.22424011},
+{"TNM",-7.224538539},
+{"UYP",-7.224583668},
+{"NWF",-7.226113892},
+{"VHA",-7.226532163},
+{"YRW",-7.226580988},
+{"CPF",-7.226811235},
+{"ZUB",-7.226867071},
+{"AWU",-7.227177789},
+{"NNP",-7.227876843},
+{"PDD",-7.227904829},
+{"JUE",-7.228401873},
+{"STQ",-7.228520968},
+{"WNO",-7.229980783},
+{"CWH",-7.230364095},
+{"NRT",-7.23054004},
+{"YMR",-7.230712535},
+{"NRP",-7.23107535},
+{"TND",-7.231177556},
+{"AMJ",-7.231741886},
+{"DUY",-7.232204478},
+{"UYC",-7.232204478},
+{"WYG",-7.232310485},
+{"IWY",-7.232310485},
+{"RBN",-7.232434192},
+{"DRP",-7.232451867},
+{"MBC",-7.233205504},
+{"RJR",-7.23347118},
+{"ACV",-7.233573952},
+{"PUV",-7.233776023},
+{"DCB",-7.233939166},
+{"RPP",-7.23405979},
+{"HNT",-7.234073983},
+{"OXX",-7.234421862},
+{"OXT",-7.235492092},
+{"XRO",-7.23565232},
+{"EXR",-7.23565232},
+{"GYG",-7.235670126},
+{"YOB",-7.236119098},
+{"PBI",-7.236226065},
+{"GVN",-7.236811281},
+{"PIB",-7.237111331},
+{"NLT",-7.237812256},
+{"BPI",-7.23793396},
+{"FBR",-7.238152398},
+{"TRV",-7.238184635},
+{"OJU",-7.238342277},
+{"UBZ",-7.238589602},
+{"BZO",-7.238589602},
+{"GDS",-7.238639801},
+{"CKX",-7.238851419},
+{"IFP",-7.239213918},
+{"KHB",-7.239573128},
+{"RFG",-7.239695326},
+{"CPN",-7.239824751},
+{"VBE",-7.240310436},
+{"IPJ",-7.240332035},
+{"PJA",-7.240332035},
+{"XUP",-7.240656143},
+{"HYV",-7.240893977},
+{"ZBL",-7.241243756},
+{"YDD",-7.241323127},
+{"DFP",-7.241828553},
+{"UFC",-7.242077872},
+{"FCH",-7.242077872},
+{"ETK",-7.242222471},
+{"HFC",-7.242613127},
+{"SDM",-7.242642079},
+{"JUC",-7.242862898},
+{"LZO",-7.243344745},
+{"YNH",-7.243576802},
+{"SRF",-7.243652972},
+{"NYG",-7.243812611},
+{"BMO",-7.243830756},
+{"OXM",-7.244084859},
+{"FCT",-7.244099383},
+{"DUJ",-7.244161119},
+{"WTA",-7.244193806},
+{"SLM",-7.244375444},
+{"PLN",-7.244662588},
+{"LSM",-7.245211962},
+{"WOG",-7.24598809},
+{"TRF",-7.246203319},
+{"USV",-7.24647707},
+{"BRL",-7.246871574},
+{"WOA",-7.247076273},
+{"CSH",-7.247376185},
+{"TLR",-7.247742212},
+{"GSD",-7.247855743},
+{"DCP",-7.247874057},
+{"NGV",-7.247932668},
+{"GVI",-7.247932668},
+{"HBL",-7.248145198},
+{"VUN",-7.248409174},
+{"JCL",-7.248952294},
+{"MUP",-7.249044105},
+{"HKL",-7.249058796},
+{"SML",-7.249135935},
+{"DTY",-7.249227784},
+{"LGN",-7.249937515},
+{"MCU",-7.250044258},
+{"UOB",-7.250759013},
+{"TMT",-7.250869647},
+{"NPM",-7.251297698},
+{"WTC",-7.25143432},
+{"SVR",-7.251914686},
+{"TWU",-7.252277159},
+{"DDB",-7.252465912},
+{"CTT",-7.252843666},
+{"RCD",-7.253377525},
+{"HUQ",-7.253407204},
+{"NHT",-7.253473987},
+{"NYR",-7.253551913},
+{"EBP",-7.254049489},
+{"BKI",-7.25446953},
+{"BQU",-7.254919759},
+{"UBQ",-7.254919759},
+{"GTR",-7.255094768},
+{"BGI",-7.255132013},
+{"MDD",-7.255225139},
+{"NCM",-7.255269847},
+{"VUH",-7.255497182},
+{"YOJ",-7.255769396},
+{"VSP",-7.256086572},
+{"IZR",-7.256445073},
+{"BYO",-7.257035752},
+{"NFC",-7.257552319},
+{"MRY",-7.257604759},
+{"AQL",-7.258444657},
+{"JDC",-7.258733747},
+{"WPB",-7.258895271},
+{"MIW",-7.259252339},
+{"JRO",-7.259252339},
+{"FHI",-7.259259859},
+{"OFH",-7.259259859},
+{"QFD",-7.260223545},
+{"NRV",-7.260645831},
+{"TPI",-7.26095149},
+{"VPI",-7.261011892},
+{"EHP",-7.261268697},
+{"MGT",-7.262055161},
+{"SLL",-7.262240642},
+{"JSO",-7.262437564},
+{"MFP",-7.262873384},
+{"JDK",-7.263047835},
+{"VLF",-7.263639972},
+{"TLP",-7.26364377},
+{"ZIY",-7.26373874},
+{"BSN",-7.263879333},
+{"BEJ",-7.264168262},
+{"QUS",-7.264282366},
+{"CEQ",-7.26438889},
+{"TLD",-7.264445967},
+{"WML",-7.264617244},
+{"WIA",-7.264708619},
+{"TMR",-7.264777163},
+{"UDZ",-7.264857144},
+{"DZU",-7.264857144},
+{"KEK",-7.264975239},
+{"EKU",-7.264975239},
+{"WTI",-7.265188654},
+{"ICG",-7.265196278},
+{"NPK",-7.266180882},
+{"PQU",-7.26621909},
+{"MPQ",-7.26621909},
+{"PHB",-7.266589882},
+{"CZY",-7.266635775},
+{"ZYK",-7.266635775},
+{"JCZ",-7.266635775},
+{"MMD",-7.266647249},
+{"JTP",-7.266651074},
+{"UHV",-7.267497171},
+{"JCI",-7.267635153},
+{"OJC",-7.267635153},
+{"FGM",-7.268007156},
+{"SRN",-7.268091572},
+{"UHT",-7.268126111},
+{"DBT",-7.268383318},
+{"JSC",-7.26841788},
+{"OTD",-7.269459866},
+{"YBC",-7.269563817},
+{"OIQ",-7.270087801},
+{"QCA",-7.270099367},
+{"BFL",-7.270161056},
+{"DSV",-7.270315315},
+{"ZUT",-7.270488922},
+{"GLM",-7.270809314},
+{"RCN",-7.271017888},
+{"XVE",-7.271176317},
+{"GAJ",-7.27128068},
+{"PYU",-7.271307741},
+{"RRC",-7.271330938},
+{"VDU",-7.271586182},
+{"FAJ",-7.27185706},
+{"KDP",-7.271907385},
+{"BGB",-7.271961587},
+{"CVM",-7.272042903},
+{"ZCZ",-7.272135854},
+{"SZC",-7.272135854},
+{"FDS",-7.272356692},
+{"MIV",-7.272763794},
+{"VTI",-7.272977191},
+{"GCD",-7.273039289},
+{"FSI",-7.273283889},
+{"BDN",-7.273423722},
+{"DNF",-7.273423722},
+{"AXN",-7.273789054},
+{"CTB",-7.274937575},
+{"VGE",-7.27501945},
+{"EVG",-7.27501945},
+{"ZTO",-7.27502335},
+{"YSZ",-7.27502335},
+{"ZYS",-7.27502335},
+{"KRZ",-7.27502335},
+{"AJZ",-7.275144242},
+{"JZE",-7.275144242},
+{"ESZ",-7.275218354},
+{"PNM",-7.275327595},
+{"VDF",-7.276085233},
+{"TBF",-7.276327644},
+{"PYC",-7.276358932},
+{"MHU",-7.276699342},
+{"RCB",-7.277447616},
+{"XYE",-7.277600564},
+{"PMD",-7.277961576},
+{"UVS",-7.278256103},
+{"PIJ",-7.278480076},
+{"FFK",-7.278574415},
+{"DNY",-7.279105456},
+{"IUX",-7.279223553},
+{"FNR",-7.279522876},
+{"RMR",-7.27973962},
+{"EZC",-7.279952529},
+{"LLQ",-7.280264195},
+{"PLT",-7.280382608},
+{"PRR",-7.28065508},
+{"RBH",-7.280726187},
+{"XYU",-7.280765697},
+{"MWD",-7.281073993},
+{"RYV",-7.281299425},
+{"WYD",-7.281374595},
+{"PLF",-7.282345059},
+{"TYH",-7.282456107},
+{"DDN",-7.282567184},
+{"FZA",-7.282686227},
+{"AFZ",-7.282686227},
+{"OXN",-7.282821181},
+{"XNA",-7.282821181},
+{"EOE",-7.28283706},
+{"WCI",-7.282972062},
+{"SYO",-7.283011776},
+{"JAO",-7.28362781},
+{"QDS",-7.283886408},
+{"XVT",-7.283886408},
+{"SCB",-7.284220824},
+{"XHE",-7.284308451},
+{"ILJ",-7.284774768},
+{"LJO",-7.284774768},
+{"UFK",-7.284814648},
+{"FKL",-7.284814648},
+{"TMC",-7.28499814},
+{"EZF",-7.28504203},
+{"ZFA",-7.28504203},
+{"AKV",-7.285285501},
+{"MRF",-7.285525114},
+{"PTB",-7.285792838},
+{"BPC",-7.286004737},
+{"GTT",-7.286096725},
+{"TVP",-7.286452863},
+{"VPE",-7.286452863},
+{"EZD",-7.286504908},
+{"QQA",-7.286661079},
+{"AQQ",-7.286661079},
+{"QAR",-7.286661079},
+{"SAQ",-7.286661079},
+{"ZDO",-7.28733446},
+{"BKH",-7.287370564},
+{"EUO",-7.28744278},
+{"JHS",-7.287571193},
+{"CSG",-7.288684362},
+{"XYY",-7.289397162},
+{"TBM",-7.290733286},
+{"DGO",-7.291518307},
+{"WCS",-7.29164388},
+{"IPN",-7.292154648},
+{"HCM",-7.292548268},
+{"DNL",-7.292763489},
+{"NWP",-7.292767551},
+{"MLB",-7.293169858},
+{"DPU",-7.293348781},
+{"WOZ",-7.293413862},
+{"JDR",-7.293706848},
+{"DVM",-7.293890065},
+{"LUQ",-7.294485033},
+{"FVC",-7.294485033},
+{"QID",-7.294795066},
+{"CYE",-7.295125739},
+{"FSB",-7.295231935},
+{"HLH",-7.295358586},
+{"RFB",-7.295620177},
+{"FBO",-7.295620177},
+{"CIJ",-7.295722404},
+{"CRB",-7.296164301},
+{"FNU",-7.297131495},
+{"QTD",-7.297234078},
+{"CMF",-7.29753376},
+{"RGD",-7.297772011},
+{"NMF",-7.29795284},
+{"TGS",-7.298368211},
+{"GBA",-7.298499896},
+{"DFC",-7.298573987},
+{"YOE",-7.298833404},
+{"MFT",-7.299245495},
+{"AOE",-7.299398068},
+{"DUZ",-7.299402192},
+{"SMD",-7.299402192},
+{"PPX",-7.300099768},
+{"NNW",-7.300393167},
+{"CDL",-7.300393167},
+{"ZCH",-7.300434506},
+{"TZC",-7.300434506},
+{"KCN",-7.300740543},
+{"SFT",-7.301929512},
+{"HBT",-7.30251068},
+{"IPD",-7.302597922},
+{"QAI",-7.302793242},
+{"RZH",-7.302805713},
+{"QOD",-7.302872227},
+{"CSV",-7.302951225},
+{"AVN",-7.303184147},
+{"QUB",-7.303213271},
+{"GMM",-7.304033704},
+{"UCB",-7.304133761},
+{"GYI",-7.304196309},
+{"FRB",-7.304713714},
+{"JCC",-7.304922519},
+{"HFL",-7.305306984},
+{"VRY",-7.305311165},
+{"HMD",-7.305716897},
+{"TBL",-7.305863388},
+{"CYZ",-7.306072747},
+{"VCI",-7.306995128},
+{"YAV",-7.307255426},
+{"KGL",-7.30803305},
+{"NCF",-7.308369752},
+{"YPY",-7.309018638},
+{"ZRI",-7.309136721},
+{"AAY",-7.309149375},
+{"AJS",-7.309233743},
+{"JSH",-7.309233743},
+{"IKM",-7.309541823},
+{"UHU",-7.310243205},
+{"MRD",-7.310247433},
+{"NWS",-7.310623946},
+{"NTV",-7.31116602},
+{"TSZ",-7.311450032},
+{"MGB",-7.311492438},
+{"VTE",-7.311725744},
+{"SKN",-7.311819101},
+{"QTI",-7.31223521},
+{"BCI",-7.31251142},
+{"OFG",-7.312626206},
+{"LBP",-7.312677231},
+{"WPL",-7.31276654},
+{"FSW",-7.313038833},
+{"GFA",-7.313179301},
+{"OOQ",-7.313434813},
+{"XHL",-7.313912172},
+{"XXY",-7.314808638},
+{"NBT",-7.315201958},
+{"TNP",-7.31583544},
+{"EDX",-7.316118237},
+{"LFM",-7.316294006},
+{"BNL",-7.316598556},
+{"XIQ",-7.316748765},
+{"AOY",-7.316997797},
+{"JPR",-7.317100887},
+{"KPH",-7.317212594},
+{"TOQ",-7.317625303},
+{"YUV",-7.317986746},
+{"IOK",-7.318146048},
+{"PBT",-7.318292485},
+{"MGE",-7.318512234},
+{"IHD",-7.31910309},
+{"JOJ",-7.319176464},
+{"SVG",-7.319560802},
+{"EVN",-7.319677466},
+{"RMV",-7.319867652},
+{"YIV",-7.319975749},
+{"OTV",-7.320079548},
+{"RKV",-7.320122805},
+{"WKN",-7.32040408},
+{"AMQ",-7.320494992},
+{"IYI",-7.320897832},
+{"XXM",-7.321253335},
+{"UFS",-7.321318398},
+{"AUY",-7.321418179},
+{"XXL",-7.321791478}};
+
+#endif
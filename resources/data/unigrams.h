@@ -0,0 +1,58 @@
+#ifndef ANALYSIS_UNIGRAMS_H
+#define ANALYSIS_UNIGRAMS_H
+
+#include<array>
+
+struct Unigram
+{
+  const char* bg;
+  float score;
+};
+
+struct UnigramContainer
+{
+  constexpr UnigramContainer(std::initializer_list<Unigram> list)
+  {
+    for(const Unigram& l : list)
+    {
+      unigrams[l.bg[0] -65] = l.score;
+    }
+  }
+
+  constexpr float score(int b1) const
+  {
+    return unigrams[b1 % 26];
+  }
+
+  std::array<float, 26> unigrams{};
+};
+
+constexpr UnigramContainer unigram_scores{
+{"E",-0.90336585},
+{"T",-1.032659634},
+{"A",-1.094711264},
+{"O",-1.116867253},
+{"I",-1.12094557},
+{"N",-1.140643756},
+{"S",-1.186234488},
+{"R",-1.202080419},
+{"H",-1.296424797},
+{"L",-1.390513799},
+{"D",-1.418282587},
+{"C",-1.475763124},
+{"U",-1.563884787},
+{"M",-1.600021756},
+{"F",-1.619223931},
+{"P",-1.67042091},
+{"G",-1.728303373},
+{"W",-1.775813011},
+{"Y",-1.778590954},
+{"B",-1.828376277},
+{"V",-1.977467865},
+{"K",-2.267193463},
+{"X",-2.629196699},
+{"J",-2.799221369},
+{"Q",-2.919124981},
+{"Z",-3.045995483}};
+
+#endif
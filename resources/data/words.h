@@ -0,0 +1,39 @@
+#ifndef ANALYSIS_WORDS_H
+#define ANALYSIS_WORDS_H
+
+// German and English words of Enigma traffic for WordFitness: common words, military and naval
+// terms, the abbreviations of the signals (KR, OKW, OKM) and the numerals as they were spelled out.
+// Umlauts are written out (FUEHRER), as the operators did.
+constexpr const char* word_list[] = {
+  "AN", "AUF", "AUS", "BEI", "BIS", "DAS", "DEM", "DEN", "DER", "DES", "DIE", "DIES", "EIN", "EINE",
+  "EINEM", "EINEN", "EINER", "FUER", "GEGEN", "HAT", "HABEN", "IST", "IM", "IN", "MIT", "NACH",
+  "NICHT", "NOCH", "NUR", "ODER", "SIND", "SOFORT", "UND", "UM", "UNTER", "VON", "VOR", "WIRD",
+  "WURDE", "ZU", "ZUM", "ZUR", "UEBER", "WIR", "SIE", "ALLE", "KR", "KRKR", "FLOTTE", "OKW", "OKM",
+  "OBERKOMMANDO", "FUEHRER", "BEFEHL", "BEFEHLSHABER", "KOMMANDANT", "KOMMANDEUR", "MELDUNG",
+  "MELDET", "GEHEIM", "GEHEIME", "KOMMANDOSACHE", "ANGRIFF", "ABWEHR", "ARMEE", "DIVISION",
+  "REGIMENT", "BATAILLON", "KORPS", "KOMPANIE", "STAB", "STELLUNG", "FRONT", "FEIND", "FEINDLICHE",
+  "FEINDLICHER", "TRUPPEN", "PANZER", "ARTILLERIE", "INFANTERIE", "LUFTWAFFE", "FLIEGER",
+  "FLUGZEUG", "FLUGZEUGE", "BOMBER", "JAEGER", "KRIEGSMARINE", "MARINE", "UBOOT", "UBOOTE", "BOOT",
+  "BOOTE", "SCHIFF", "SCHIFFE", "KREUZER", "ZERSTOERER", "GELEIT", "KONVOI", "DAMPFER", "TANKER",
+  "HAFEN", "KURS", "FAHRT", "POSITION", "QUADRAT", "PLANQUADRAT", "GRAD", "MINUTEN", "UHR",
+  "UHRZEIT", "ZEIT", "TAG", "NACHT", "MORGEN", "ABEND", "HEUTE", "STUNDE", "STUNDEN", "NORD",
+  "NORDEN", "SUED", "SUEDEN", "OST", "OSTEN", "WEST", "WESTEN", "NORDOST", "NORDWEST", "SUEDOST",
+  "SUEDWEST", "WETTER", "WIND", "SICHT", "SEE", "STAERKE", "BEWOELKT", "REGEN", "NEBEL", "FUNK",
+  "FUNKSPRUCH", "SPRUCH", "VERBINDUNG", "STOP", "ANKUNFT", "ABFAHRT", "EINGANG", "AUSGANG",
+  "BESTAETIGT", "BESTAETIGEN", "ERBITTE", "ERBETEN", "SOFORTIGE", "LAGE", "BERICHT", "VERSENKT",
+  "GESICHTET", "MUNITION", "TREIBSTOFF", "OEL", "VERPFLEGUNG", "NACHSCHUB", "VERLUSTE", "GEFALLEN",
+  "VERWUNDET", "GEFANGEN", "RUECKZUG", "VORMARSCH", "ANGREIFEN", "HALTEN", "NULL", "NUL", "EINS",
+  "ZWO", "ZWEI", "DREI", "VIER", "FUNF", "FUENF", "SECHS", "SIEBEN", "ACHT", "NEUN", "ZEHN", "ELF",
+  "ZWOELF", "ZWANZIG", "DREISSIG", "VIERZIG", "FUENFZIG", "HUNDERT", "TAUSEND", "THE", "AND", "OF",
+  "TO", "IS", "THAT", "IT", "FOR", "THIS", "WITH", "AS", "ARE", "BE", "BY", "NOT", "ON", "OR",
+  "WHICH", "WE", "CAN", "HAS", "HAVE", "WAS", "WERE", "WILL", "WOULD", "SHOULD", "COULD", "FROM",
+  "AT", "ALL", "ONE", "ANY", "IF", "NO", "SO", "SUCH", "THAN", "THEN", "THERE", "THEIR", "THEY",
+  "THESE", "THOSE", "WHAT", "WHEN", "WHERE", "WHO", "HOW", "ATTACK", "ENEMY", "ARMY", "NAVY",
+  "FLEET", "SHIP", "SHIPS", "CONVOY", "SUBMARINE", "CRUISER", "DESTROYER", "AIRCRAFT", "REPORT",
+  "ORDER", "ORDERS", "COMMAND", "COURSE", "SPEED", "NORTH", "SOUTH", "EAST", "MESSAGE", "SECRET",
+  "URGENT", "ARRIVE", "ARRIVAL", "DEPART", "WEATHER", "HOUR", "HOURS", "TIME", "DAY", "NIGHT",
+  "TODAY", "TOMORROW", "ZERO", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT", "NINE",
+  "TEN", "HUNDRED", "THOUSAND",
+};
+
+#endif
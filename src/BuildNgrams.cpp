@@ -0,0 +1,313 @@
+#include <analysis/fitness/NgramModel.h>
+#include <enigma/Rotor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <execution>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Builds the binary n-gram models (1grams.bin up to 5grams.bin) of a plaintext corpus.
+// usage: build_ngrams <corpus> <output directory>
+//
+// The corpus is UTF-8 text. It is normalized the way Enigma operators wrote their messages:
+// letters are upper cased, umlauts are written out (AE, OE, UE, SS), every run of whitespace
+// becomes a single X and everything else is dropped. The corpus is normalized and counted chunk
+// by chunk in one pass. Only the 5-grams are counted, in parallel on at most maxTables tables,
+// the lower orders are sums over them.
+//
+// There is no build target for it, it builds on its own like the benchmarks:
+//   g++ -std=c++17 -O2 -Isrc -Iresources src/BuildNgrams.cpp -ltbb -lpthread -o build_ngrams
+
+constexpr int maxOrder = NgramModel::maxOrder;
+// bytes of the corpus per chunk and the most 5-gram tables counted at the same time
+constexpr size_t chunkBytes = 16 << 20;
+constexpr int maxTables = 4;
+
+// marks what the bytes of the corpus become, letters map to their index
+constexpr int8_t skip = -1;
+constexpr int8_t space = -2;
+constexpr int8_t utf8Lead = -3;
+
+constexpr std::array<int8_t, 256> makeByteClasses()
+{
+	std::array<int8_t, 256> classes{};
+	for (int i = 0; i < 256; ++i)
+		classes[i] = skip;
+	for (int i = 0; i < 26; ++i)
+	{
+		classes['A' + i] = i;
+		classes['a' + i] = i;
+	}
+	for (char c : {' ', '\t', '\n', '\r', '\f', '\v'})
+		classes[static_cast<unsigned char>(c)] = space;
+	classes[0xC3] = utf8Lead;
+	return classes;
+}
+constexpr std::array<int8_t, 256> byteClasses = makeByteClasses();
+
+// whether the text before position ends in whitespace after a letter
+bool spaceBefore(const unsigned char* corpus, size_t position)
+{
+	bool seenSpace = false;
+	for (size_t p = position; p > 0; --p)
+	{
+		const int8_t c = byteClasses[corpus[p - 1]];
+		if (c >= 0 || c == utf8Lead)
+			return seenSpace;
+		seenSpace |= c == space;
+	}
+	return false;
+}
+
+// normalizes the corpus byte by byte and hands the letters to a sink with add(letter) and full().
+// The pending X is kept between calls, so a chunk can be continued into the next one.
+struct Normalizer
+{
+	bool pendingSpace;
+	bool anyLetter;
+
+	// normalizes [p, end) until the sink is full, returns where it stopped
+	template<class Sink>
+	const unsigned char* run(const unsigned char* p, const unsigned char* end, Sink& sink)
+	{
+		auto emit = [&](int8_t letter) {
+			if (pendingSpace)
+				sink.add(charToIndex('X'));
+			pendingSpace = false;
+			anyLetter = true;
+			sink.add(letter);
+		};
+
+		for (; p < end && !sink.full(); ++p)
+		{
+			const int8_t c = byteClasses[*p];
+			if (c >= 0)
+			{
+				emit(c);
+			}
+			else if (c == space)
+			{
+				// no X in front of the first letter
+				pendingSpace = pendingSpace || anyLetter;
+			}
+			else if (c == utf8Lead && p + 1 < end)
+			{
+				// the umlauts and sharp s of latin-1 supplement in both cases
+				switch (*++p)
+				{
+				case 0x84:
+				case 0xA4:
+					emit(charToIndex('A'));
+					emit(charToIndex('E'));
+					break;
+				case 0x96:
+				case 0xB6:
+					emit(charToIndex('O'));
+					emit(charToIndex('E'));
+					break;
+				case 0x9C:
+				case 0xBC:
+					emit(charToIndex('U'));
+					emit(charToIndex('E'));
+					break;
+				case 0x9F:
+					emit(charToIndex('S'));
+					emit(charToIndex('S'));
+					break;
+				default:
+					break;
+				}
+			}
+		}
+		return p;
+	}
+};
+
+// counts the 5-grams that start in the letters of one chunk. The letters after the end of the
+// chunk only complete the 5-grams of its last letters.
+struct Counter
+{
+	static constexpr int leading = NgramModel::tableSize(maxOrder - 1);
+
+	uint32_t* counts;
+	// the last maxOrder letters, the index of the 5-gram that ends with the last letter
+	int index{0};
+	size_t letters{0};
+	// letters of the chunk itself, unknown until its end
+	size_t owned{std::numeric_limits<size_t>::max()};
+
+	void add(int8_t letter)
+	{
+		index = index % leading * 26 + letter;
+		++letters;
+		if (letters >= maxOrder && letters - maxOrder < owned)
+			counts[index]++;
+	}
+
+	bool full() const { return owned < std::numeric_limits<size_t>::max() && letters >= owned + maxOrder - 1; }
+};
+
+// what the n-grams of the whole corpus need to know about a chunk
+struct ChunkEnd
+{
+	size_t letters{0};
+	// the last min(letters, maxOrder - 1) letters as an index
+	int tail{0};
+};
+
+int main(int argc, char** argv)
+{
+	using std::chrono::high_resolution_clock;
+
+	if (argc != 3)
+	{
+		std::cerr << "usage: build_ngrams <corpus> <output directory>\n";
+		return 1;
+	}
+
+	const int fd = ::open(argv[1], O_RDONLY);
+	struct stat info;
+	if (fd < 0 || ::fstat(fd, &info) != 0 || info.st_size == 0)
+	{
+		std::cerr << "can't read " << argv[1] << "\n";
+		return 1;
+	}
+	const size_t size = info.st_size;
+	void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		std::cerr << "can't map " << argv[1] << "\n";
+		return 1;
+	}
+	::madvise(mapping, size, MADV_SEQUENTIAL);
+	const unsigned char* corpus = static_cast<const unsigned char*>(mapping);
+
+	auto t1 = high_resolution_clock::now();
+
+	// chunks start at an ascii letter, so no chunk splits a UTF-8 sequence or a run of whitespace
+	const size_t chunks = std::max<size_t>(1, (size + chunkBytes - 1) / chunkBytes);
+	std::vector<size_t> bounds{0};
+	std::vector<bool> afterSpace{false};
+	for (size_t c = 1; c < chunks; ++c)
+	{
+		size_t bound = std::max(bounds.back(), size / chunks * c);
+		while (bound < size && byteClasses[corpus[bound]] < 0)
+			++bound;
+		bounds.push_back(bound);
+		afterSpace.push_back(spaceBefore(corpus, bound));
+	}
+	bounds.push_back(size);
+
+	// the chunks are normalized and counted in one pass, never holding more than a few letters.
+	// A 5-gram table takes 47.5 MB, so only a few workers count with a table each.
+	const int tableSize = NgramModel::tableSize(maxOrder);
+	const int workers = std::clamp<int>(std::thread::hardware_concurrency(), 1, maxTables);
+	std::vector<std::vector<uint32_t>> partial(workers);
+	std::vector<ChunkEnd> ends(chunks);
+	std::atomic<size_t> nextChunk{0};
+	std::vector<int> ints(workers);
+	std::iota(ints.begin(), ints.end(), 0);
+	std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int w) {
+		partial[w].assign(tableSize, 0);
+		for (size_t c = nextChunk++; c < chunks; c = nextChunk++)
+		{
+			Counter counter{partial[w].data()};
+			Normalizer normalizer{afterSpace[c], false};
+			normalizer.run(corpus + bounds[c], corpus + bounds[c + 1], counter);
+			counter.owned = counter.letters;
+			ends[c] = {counter.letters, counter.index % Counter::leading};
+
+			// the 5-grams of the last letters end in the following chunks
+			normalizer.run(corpus + bounds[c + 1], corpus + size, counter);
+		}
+	});
+	::munmap(mapping, size);
+
+	// the last maxOrder - 1 letters of the corpus, some may lie in earlier chunks
+	size_t total = 0;
+	int last = 0;
+	int lastLetters = 0;
+	int weight = 1;
+	for (size_t c = chunks; c-- > 0;)
+	{
+		total += ends[c].letters;
+		for (int tail = ends[c].tail, n = std::min<size_t>(ends[c].letters, maxOrder - 1); n > 0 && lastLetters < maxOrder - 1; --n)
+		{
+			last += tail % 26 * weight;
+			tail /= 26;
+			weight *= 26;
+			++lastLetters;
+		}
+	}
+	if (total < maxOrder)
+	{
+		std::cerr << "the corpus has less than " << maxOrder << " letters\n";
+		return 1;
+	}
+
+	auto t2 = high_resolution_clock::now();
+
+	// merge the tables block by block
+	std::vector<std::vector<uint64_t>> counts(maxOrder + 1);
+	counts[maxOrder].assign(tableSize, 0);
+	constexpr int block = 1 << 16;
+	std::vector<int> blocks((tableSize + block - 1) / block);
+	std::iota(blocks.begin(), blocks.end(), 0);
+	std::for_each(std::execution::par, blocks.cbegin(), blocks.cend(), [&](int b) {
+		const int end = std::min(tableSize, (b + 1) * block);
+		for (const std::vector<uint32_t>& table : partial)
+		{
+			for (int i = b * block; i < end; ++i)
+				counts[maxOrder][i] += table[i];
+		}
+	});
+	std::vector<std::vector<uint32_t>>().swap(partial);
+
+	// an n-gram is counted by all (n+1)-grams it starts, except for the last one of the corpus
+	for (int order = maxOrder - 1; order >= 1; --order)
+	{
+		counts[order].assign(NgramModel::tableSize(order), 0);
+		for (size_t i = 0; i < counts[order].size(); ++i)
+		{
+			for (int next = 0; next < 26; ++next)
+				counts[order][i] += counts[order + 1][i * 26 + next];
+		}
+		counts[order][last % NgramModel::tableSize(order)]++;
+	}
+
+	auto t3 = high_resolution_clock::now();
+
+	// log10 probabilities, n-grams never seen get a hundredth of a single occurrence
+	const std::string directory = argv[2];
+	for (int order = 1; order <= maxOrder; ++order)
+	{
+		const double n = total - order + 1;
+		std::vector<float> logProbabilities(counts[order].size());
+		for (size_t i = 0; i < logProbabilities.size(); ++i)
+		{
+			const double count = counts[order][i] > 0 ? counts[order][i] : 0.01;
+			logProbabilities[i] = std::log10(count / n);
+		}
+		NgramModel::write(directory + "/" + NgramModels::fileName(order), order, logProbabilities);
+	}
+
+	auto t4 = high_resolution_clock::now();
+	std::cout << total << " letters from " << size << " bytes\n";
+	std::cout << "Normalize and count " << std::chrono::duration<double, std::milli>(t2 - t1).count() << "ms\n";
+	std::cout << "Merge " << std::chrono::duration<double, std::milli>(t3 - t2).count() << "ms\n";
+	std::cout << "Write " << std::chrono::duration<double, std::milli>(t4 - t3).count() << "ms\n";
+	return 0;
+}
@@ -0,0 +1,197 @@
+#include <analysis/FastRandom.h>
+#include <analysis/fitness/BigramFitness.h>
+#include <analysis/fitness/IoCFitness.h>
+#include <analysis/fitness/QuadgramFitness.h>
+#include <analysis/fitness/TrigramFitness.h>
+#include <analysis/fitness/UnigramFitness.h>
+#include <analysis/fitness/WeightedFitness.h>
+#include <analysis/fitness/WordFitness.h>
+#include <enigma/Enigma.h>
+
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Compares the quantized quadgram scores with the exact float scores of the list for the ranking
+// of the same decryptions, and the throughput of all fitness functions.
+// The decryptions are those of the README message under the right rotors with a part of the
+// right plugs and some wrong ones, so they range from garbage to nearly readable.
+
+constexpr int messageSize = 584;
+using Message = std::array<int8_t, messageSize>;
+
+template<class Score>
+double scoresPerSecond(int rounds, size_t count, Score score)
+{
+	using std::chrono::high_resolution_clock;
+	volatile float sink = 0;
+	auto t1 = high_resolution_clock::now();
+	for (int round = 0; round < rounds; ++round)
+	{
+		for (size_t i = 0; i < count; ++i)
+			sink = sink + score(i);
+	}
+	auto t2 = high_resolution_clock::now();
+	return rounds * count / std::chrono::duration<double>(t2 - t1).count();
+}
+
+int main()
+{
+	const char* ciphertext = "OZLUDYAKMGMXVFVARPMJIKVWPMBVWMOIDHYPLAYUWGBZFAFAFUQFZQISLEZMYPVBRDDLAGIHIFUJDFADORQOOMIZPYXDCBPWDSSNUSYZTJEWZPWFBWBMIEQXRFASZLOPPZRJKJSPPSTXKPUWYSKNMZZLHJDXJMMMDFODIHUBVCXMNICNYQBNQODFQLOGPZYXRJMTLMRKQAUQJPADHDZPFIKTQBFXAYMVSZPKXIQLOQCVRPKOBZSXIUBAAJBRSNAFDMLLBVSYXISFXQZKQJRIQHOSHVYJXIFUZRMXWJVWHCCYHCXYGRKMKBPWRDBXXRGABQBZRJDVHFPJZUSEBHWAEOGEUQFZEEBDCWNDHIAQDMHKPRVYHQGRDYQIOEOLUBGBSNXWPZCHLDZQBWBEWOCQDBAFGUVHNGCIKXEIZGIZHPJFCTMNNNAUXEVWTWACHOLOLSLTMDRZJZEVKKSSGUUTHVXXODSKTFGRUEIIXVWQYUIPIDBFPGLBYXZTCOQBCAHJYNSGDYLREYBRAKXGKQKWJEKWGAPTHGOMXJDSQKYHMFGOLXBSKVLGNZOAXGVTGXUIVFTGKPJU";
+	Message msg;
+	for (size_t i = 0; i < msg.size(); ++i)
+		msg[i] = charToIndex(ciphertext[i]);
+
+	const std::array<const char*, 5> rightPlugs{"AF", "TV", "KO", "BL", "RW"};
+	const int candidates = 2000;
+	FastRandom gen(42);
+	std::vector<Message> arrays;
+	std::vector<std::string> strings;
+	for (int c = 0; c < candidates; ++c)
+	{
+		Plugboard board;
+		for (const char* plug : rightPlugs)
+		{
+			if (gen.below(2))
+				board.addPlug(charToIndex(plug[0]), charToIndex(plug[1]));
+		}
+		for (uint32_t extra = gen.below(4); extra > 0; --extra)
+		{
+			int8_t a = gen.below(26);
+			int8_t b = gen.below(26);
+			if (a != b && !board.plugged[a] && !board.plugged[b])
+				board.addPlug(a, b);
+		}
+
+		Enigma e{{2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, board};
+		arrays.push_back(e.encrypt(msg));
+		std::string text;
+		for (int8_t c : arrays.back())
+			text += indexToChar(c);
+		strings.push_back(text);
+	}
+
+	QuadgramFitness quadgrams;
+	TrigramFitness trigrams;
+	BigramFitness bigrams;
+	UnigramFitness unigrams;
+
+	// the exact scores the quantized table was built from
+	std::vector<float> exact(26 * 26 * 26 * 26, quadgram_scores.floor);
+	for (const Quadgram& q : quadgram_list)
+		exact[(((q.bg[0] - 'A') * 26 + q.bg[1] - 'A') * 26 + q.bg[2] - 'A') * 26 + q.bg[3] - 'A'] = q.score;
+	auto exactScore = [&](const Message& text) {
+		float fitness = 0;
+		for (size_t i = 3; i < text.size(); ++i)
+			fitness += exact[((text[i - 3] % 26 * 26 + text[i - 2] % 26) * 26 + text[i - 1] % 26) * 26 + text[i] % 26];
+		return fitness;
+	};
+
+	std::vector<float> floats(candidates);
+	std::vector<float> quantized(candidates);
+	float maxDifference = 0;
+	for (int c = 0; c < candidates; ++c)
+	{
+		floats[c] = exactScore(arrays[c]);
+		quantized[c] = quadgrams.score(arrays[c]);
+		maxDifference = std::max(maxDifference, std::abs(floats[c] - quantized[c]));
+	}
+
+	// pairs of decryptions the quantized scores order differently, ties of the float scores don't count
+	long long pairs = 0;
+	long long swapped = 0;
+	for (int a = 0; a < candidates; ++a)
+	{
+		for (int b = a + 1; b < candidates; ++b)
+		{
+			if (floats[a] == floats[b])
+				continue;
+			++pairs;
+			if ((floats[a] < floats[b]) != (quantized[a] < quantized[b]))
+				++swapped;
+		}
+	}
+
+	std::vector<int> byFloat(candidates);
+	std::iota(byFloat.begin(), byFloat.end(), 0);
+	std::vector<int> byQuantized = byFloat;
+	std::sort(byFloat.begin(), byFloat.end(), [&](int l, int r) { return floats[l] > floats[r]; });
+	std::sort(byQuantized.begin(), byQuantized.end(), [&](int l, int r) { return quantized[l] > quantized[r]; });
+	const bool sameTop = std::equal(byFloat.begin(), byFloat.begin() + 10, byQuantized.begin());
+
+	std::cout << "Quadgram accuracy over " << candidates << " decryptions:\n";
+	std::cout << "  largest score difference " << maxDifference << "\n";
+	std::cout << "  pairs ordered differently " << swapped << " of " << pairs << "\n";
+	std::cout << "  same top 10 " << (sameTop ? "yes" : "no") << "\n";
+
+	const int rounds = 200;
+	std::cout << "Throughput in million scores per second:\n";
+	std::cout << "  quadgrams exact (float) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return exactScore(arrays[i]); }) / 1e6
+			  << "\n";
+	std::cout << "  quadgrams (string) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return quadgrams.score(strings[i]); }) / 1e6
+			  << "\n";
+	std::cout << "  quadgrams quantized (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return quadgrams.score(arrays[i]); }) / 1e6
+			  << "\n";
+	std::cout << "  trigrams (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return trigrams.score(arrays[i]); }) / 1e6
+			  << "\n";
+	std::cout << "  bigrams (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return bigrams.score(arrays[i]); }) / 1e6
+			  << "\n";
+	// the batched scores take 16 decryptions per call, each call counts for all of them
+	constexpr size_t batch = 16;
+	std::vector<std::array<std::array<int8_t, batch>, messageSize>> batches(candidates / batch);
+	for (size_t b = 0; b < batches.size(); ++b)
+	{
+		std::array<Message, batch> group;
+		std::copy(arrays.begin() + b * batch, arrays.begin() + (b + 1) * batch, group.begin());
+		BigramFitness::transpose(group, batches[b]);
+	}
+	std::array<float, batch> batchScores;
+	std::cout << "  bigrams batched (int8) "
+			  << batch
+						 * scoresPerSecond(rounds,
+								 batches.size(),
+								 [&](size_t b) {
+									 bigrams.score(batches[b], batchScores);
+									 return std::accumulate(batchScores.begin(), batchScores.end(), 0.0f);
+								 })
+						 / 1e6
+			  << "\n";
+	std::cout << "  unigrams (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return unigrams.score(arrays[i]); }) / 1e6
+			  << "\n";
+	WordFitness words;
+	std::cout << "  words (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return words.score(arrays[i]); }) / 1e6 << "\n";
+	IoCFitness ioc;
+	std::cout << "  IoC (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return ioc.score(arrays[i]); }) / 1e6 << "\n";
+	// all decryptions have the same length, so the coincidences alone order them
+	std::cout << "  IoC coincidences (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return float(ioc.coincidences(arrays[i])); }) / 1e6
+			  << "\n";
+	std::cout << "  IoC batched (int8) "
+			  << batch
+						 * scoresPerSecond(rounds,
+								 batches.size(),
+								 [&](size_t b) {
+									 ioc.score(batches[b], batchScores);
+									 return std::accumulate(batchScores.begin(), batchScores.end(), 0.0f);
+								 })
+						 / 1e6
+			  << "\n";
+	// both terms share one histogram
+	const auto combined = weighted(0.7f, ioc) + weighted(0.3f, unigrams);
+	std::cout << "  IoC + unigrams weighted (int8) "
+			  << scoresPerSecond(rounds, candidates, [&](size_t i) { return combined.score(arrays[i]); }) / 1e6
+			  << "\n";
+	return 0;
+}
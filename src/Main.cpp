@@ -2,15 +2,27 @@
 #include <analysis/fitness/BigramFitness.h>
 #include <analysis/fitness/IoCFitness.h>
 #include <analysis/fitness/KnownPlaintextFitness.h>
+#include <analysis/fitness/NgramFitness.h>
 #include <analysis/fitness/QuadgramFitness.h>
 
 #include <chrono>
 #include <iostream>
+#include <memory>
+#include <string>
 
-int main()
+int main(int argc, char** argv)
 {
 	using std::chrono::high_resolution_clock;
 
+	// --model <directory> scores with the binary n-gram models of that directory
+	// instead of the compiled in English tables, see NgramModel.h
+	std::unique_ptr<NgramModels> models;
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::string(argv[i]) == "--model")
+			models = std::make_unique<NgramModels>(argv[++i]);
+	}
+
 	IoCFitness ioc;
 	BigramFitness bigrams;
 	QuadgramFitness quadgrams;
@@ -29,13 +41,14 @@ int main()
 	// Begin by finding the best combination of rotors and start positions (returns top n)
 	// the selection of a fitness function was patched out during optimization
 	std::vector<ScoredEnigmaKey> rotorConfigurations = EnigmaAnalysis::findRotorConfiguration<584>(
-			msg, EnigmaAnalysis::AvailableRotors::FIVE, Plugboard{}, ioc);
+			msg, EnigmaAnalysis::AvailableRotors::FIVE, std::array<char, 3>{'A', 'B', 'C'}, Plugboard{}, ioc);
 
 	std::cout << "\nTop 10 rotor configurations: \n";
-	for (const ScoredEnigmaKey& key : rotorConfigurations)
+	for (size_t i = 0; i < 10 && i < rotorConfigurations.size(); ++i)
 	{
+		const ScoredEnigmaKey& key = rotorConfigurations[i];
 		std::cout << (int)key.rotors[0] << " " << (int)key.rotors[1] << " " << (int)key.rotors[2]
-				  << " / " << (int)key.indicators[0] << " " << (int)key.indicators[1] << " "
+				  << " " << key.reflector << " / " << (int)key.indicators[0] << " " << (int)key.indicators[1] << " "
 				  << (int)key.indicators[2] << " / " << key.score << "\n";
 	}
 
@@ -45,7 +58,7 @@ int main()
 	{
 		std::cout << "Current Rotors: " << (int)rotorConfigurations[i].rotors[0] << " "
 				  << (int)rotorConfigurations[i].rotors[1] << " "
-				  << (int)rotorConfigurations[i].rotors[2] << "\n";
+				  << (int)rotorConfigurations[i].rotors[2] << " " << rotorConfigurations[i].reflector << "\n";
 		// Next find the best ring settings for the top 10 configurations
 		ScoredEnigmaKey ringConfig = EnigmaAnalysis::findRingSettings(rotorConfigurations[i], ciphertext, ioc);
 
@@ -53,12 +66,14 @@ int main()
 				  << (int)ringConfig.rings[1] << " " << (int)ringConfig.rings[2] << "\n";
 		{
 			const ScoredEnigmaKey& key = ringConfig;
-			Enigma e(key.rotors, 'B', key.indicators, key.rings, key.plugboard);
+			Enigma e = key.createEnigma();
 			std::cout << "Current decryption:" << encryptString(e, ciphertext) << "\n";
 		}
 
 		// Next find the best ring settings for the top 10 configurations
-		ScoredEnigmaKey startConfig = EnigmaAnalysis::findStartingPositions(ringConfig, ciphertext, bigrams);
+		ScoredEnigmaKey startConfig =
+				models ? EnigmaAnalysis::findStartingPositions(ringConfig, ciphertext, NgramFitness(models->get(2)))
+					   : EnigmaAnalysis::findStartingPositions(ringConfig, ciphertext, bigrams);
 
 		std::cout << "Best starting positions settings:" << (int)startConfig.indicators[0] << " "
 				  << (int)startConfig.indicators[1] << " " << (int)startConfig.indicators[2] << "\n";
@@ -67,7 +82,7 @@ int main()
 
 		{
 			const ScoredEnigmaKey& key = startConfig;
-			Enigma e(key.rotors, 'B', key.indicators, key.rings, key.plugboard);
+			Enigma e = key.createEnigma();
 			std::cout << "Current decryption:" << encryptString(e, ciphertext) << "\n";
 		}
 
@@ -76,7 +91,7 @@ int main()
 		std::cout << "Best plugboard: " << optimalKeyWithPlugs.plugboard.ToString() << "\n";
 		{
 			const ScoredEnigmaKey& key = optimalKeyWithPlugs;
-			Enigma e(key.rotors, 'B', key.indicators, key.rings, key.plugboard);
+			Enigma e = key.createEnigma();
 			std::cout << "Current decryption:" << encryptString(e, ciphertext) << "\n";
 		}
 	}
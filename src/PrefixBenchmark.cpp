@@ -0,0 +1,96 @@
+#include <analysis/EnigmaAnalysis.h>
+#include <analysis/fitness/IoCFitness.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Runs the rotor search of the README message with IoC once in full and then with prefix bounds
+// of several lengths and false negative rates. Reports the speedup, including the calibration,
+// and the recall: the share of the top keys of the full search (as many as the bound keeps)
+// that are also among the top keys of the bounded search, and whether the best key stays on top.
+
+constexpr int messageSize = 584;
+using Message = std::array<int8_t, messageSize>;
+
+template<class Search>
+double secondsOf(Search search)
+{
+	using std::chrono::high_resolution_clock;
+	auto t1 = high_resolution_clock::now();
+	search();
+	auto t2 = high_resolution_clock::now();
+	return std::chrono::duration<double>(t2 - t1).count();
+}
+
+bool sameKey(const ScoredEnigmaKey& l, const ScoredEnigmaKey& r)
+{
+	return l.rotors == r.rotors && l.reflector == r.reflector && l.indicators == r.indicators;
+}
+
+int main()
+{
+	const char* ciphertext = "OZLUDYAKMGMXVFVARPMJIKVWPMBVWMOIDHYPLAYUWGBZFAFAFUQFZQISLEZMYPVBRDDLAGIHIFUJDFADORQOOMIZPYXDCBPWDSSNUSYZTJEWZPWFBWBMIEQXRFASZLOPPZRJKJSPPSTXKPUWYSKNMZZLHJDXJMMMDFODIHUBVCXMNICNYQBNQODFQLOGPZYXRJMTLMRKQAUQJPADHDZPFIKTQBFXAYMVSZPKXIQLOQCVRPKOBZSXIUBAAJBRSNAFDMLLBVSYXISFXQZKQJRIQHOSHVYJXIFUZRMXWJVWHCCYHCXYGRKMKBPWRDBXXRGABQBZRJDVHFPJZUSEBHWAEOGEUQFZEEBDCWNDHIAQDMHKPRVYHQGRDYQIOEOLUBGBSNXWPZCHLDZQBWBEWOCQDBAFGUVHNGCIKXEIZGIZHPJFCTMNNNAUXEVWTWACHOLOLSLTMDRZJZEVKKSSGUUTHVXXODSKTFGRUEIIXVWQYUIPIDBFPGLBYXZTCOQBCAHJYNSGDYLREYBRAKXGKQKWJEKWGAPTHGOMXJDSQKYHMFGOLXBSKVLGNZOAXGVTGXUIVFTGKPJU";
+	Message msg;
+	for (size_t i = 0; i < msg.size(); ++i)
+		msg[i] = charToIndex(ciphertext[i]);
+
+	const auto rotors = EnigmaAnalysis::AvailableRotors::FIVE;
+	const std::array<char, 3> reflectors{'A', 'B', 'C'};
+	IoCFitness ioc;
+
+	std::vector<ScoredEnigmaKey> full;
+	const double fullSeconds = secondsOf(
+			[&] { full = EnigmaAnalysis::findRotorConfiguration<messageSize>(msg, rotors, reflectors, Plugboard{}, ioc); });
+	std::cout << "Full search " << fullSeconds << "s, best key score " << full[0].score << "\n";
+	std::cout << "prefix\tfalse negative rate\tspeedup\trecall\tsame best key\n";
+
+	const int keep = PrefixBound{}.keep;
+	auto report = [&](const std::string& prefix, float falseNegativeRate, auto makeBound) {
+		std::vector<ScoredEnigmaKey> bounded;
+		const double seconds = secondsOf([&] {
+			bounded = EnigmaAnalysis::findRotorConfiguration<messageSize>(
+					msg, rotors, reflectors, Plugboard{}, ioc, makeBound());
+		});
+
+		int found = 0;
+		for (int k = 0; k < keep; ++k)
+		{
+			for (int c = 0; c < keep; ++c)
+			{
+				if (sameKey(full[k], bounded[c]))
+				{
+					++found;
+					break;
+				}
+			}
+		}
+		std::cout << prefix << "\t" << falseNegativeRate << "\t" << fullSeconds / seconds << "\t"
+				  << float(found) / keep << "\t" << (sameKey(full[0], bounded[0]) ? "yes" : "no") << "\n";
+	};
+
+	for (int prefix : {50, 100, 150, 250})
+	{
+		for (float falseNegativeRate : {0.01f, 0.05f})
+		{
+			report(std::to_string(prefix), falseNegativeRate, [&] {
+				return EnigmaAnalysis::calibratePrefixBound(msg, rotors, reflectors, Plugboard{}, ioc, prefix, falseNegativeRate);
+			});
+		}
+	}
+
+	// the exact bound of the IoC only drops candidates in the last few letters, but loses none
+	const std::initializer_list<int> exact{messageSize - 16};
+	report("exact", 0, [&] {
+		PrefixBound bound;
+		bound.addExactCheckpoints(exact);
+		return bound;
+	});
+	report("100+exact", 0.01f, [&] {
+		PrefixBound bound = EnigmaAnalysis::calibratePrefixBound(msg, rotors, reflectors, Plugboard{}, ioc, 100, 0.01f);
+		bound.addExactCheckpoints(exact);
+		return bound;
+	});
+	return 0;
+}
@@ -0,0 +1,295 @@
+#ifndef ANALYSIS_BOMBE_H
+#define ANALYSIS_BOMBE_H
+
+#include <analysis/ScoredEnigmaKey.h>
+#include <analysis/ScramblerTrace.h>
+#include <enigma/Enigma.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Turing-Welchman bombe. The crib and the ciphertext below it form a menu, a graph with an edge
+// between plain and cipher letter for every crib position, labelled with the scrambler of that
+// position. A hypothesis "x is steckered to y" implies "z is steckered to S(y)" for every edge
+// from x to z, and by the diagonal board also "y is steckered to x". The bombe assumes a partner
+// for the most connected letter of the menu, follows all implications and stops where they
+// don't contradict each other.
+class Bombe
+{
+public:
+	// hypotheses[x] has bit y set if x may be steckered to y
+	using Hypotheses = std::array<uint32_t, 26>;
+
+private:
+	struct Edge
+	{
+		int8_t to;
+		int step;
+	};
+
+	std::string ciphertext;
+	std::vector<int8_t> plain;
+	std::vector<int8_t> cipher;
+	int offset;
+	std::array<std::vector<Edge>, 26> menu;
+	int8_t testLetter;
+
+	// the scrambler for every combination of rotor shifts, built from the shifts
+	// with all ring settings at zero and the index shifts * 26 + letter
+	static std::vector<int8_t> scramblerTable(const std::array<int8_t, 3>& rotors, char reflector)
+	{
+		std::vector<int8_t> table(26 * 26 * 26 * 26);
+		Enigma e{rotors, reflector, {0, 0, 0}, {0, 0, 0}, Plugboard{}};
+		for (int8_t a = 0; a < 26; ++a)
+		{
+			for (int8_t b = 0; b < 26; ++b)
+			{
+				for (int8_t c = 0; c < 26; ++c)
+				{
+					e.resetRotorPositions(a, b, c);
+					int8_t* row = &table[((a * 26 + b) * 26 + c) * 26];
+					for (int8_t x = 0; x < 26; ++x)
+						row[x] = e.scramble(x) % 26;
+				}
+			}
+		}
+		return table;
+	}
+
+	// the positions left * 26 * 26 + middle * 26 + right under every crib letter for every start
+	// position, at index (start * cribLength() + crib letter). They don't depend on the rings, so
+	// the odometer is walked once per start position instead of once per ring setting as well.
+	std::vector<int16_t> positionTable(const std::array<int8_t, 3>& rotors) const
+	{
+		const int sz = cribLength();
+		std::vector<int16_t> table(26 * 26 * 26 * sz);
+		for (int start = 0; start < 26 * 26 * 26; ++start)
+		{
+			Rotor left = Rotor::Create(rotors[0], start / (26 * 26), 0);
+			Rotor middle = Rotor::Create(rotors[1], start / 26 % 26, 0);
+			Rotor right = Rotor::Create(rotors[2], start % 26, 0);
+			for (int step = 0; step < offset; ++step)
+				LeverStepping::step(left, middle, right);
+			for (int step = 0; step < sz; ++step)
+			{
+				LeverStepping::step(left, middle, right);
+				table[start * sz + step] = (left.getPosition() * 26 + middle.getPosition()) * 26 + right.getPosition();
+			}
+		}
+		return table;
+	}
+
+	// follows all implications of "testLetter is steckered to guess", stops at the first letter
+	// with two partners. Returns whether the hypotheses are consistent.
+	bool closure(const std::vector<const int8_t*>& scramblers, int8_t guess, Hypotheses& live) const
+	{
+		live.fill(0);
+		std::array<std::pair<int8_t, int8_t>, 26 * 26> stack;
+		int top = 0;
+		auto energize = [&](int8_t x, int8_t y) {
+			if (live[x] & (1u << y))
+				return true;
+			live[x] |= 1u << y;
+			live[y] |= 1u << x;
+			stack[top++] = {x, y};
+			if (x != y)
+				stack[top++] = {y, x};
+			return !(live[x] & (live[x] - 1)) && !(live[y] & (live[y] - 1));
+		};
+
+		if (!energize(testLetter, guess))
+			return false;
+		while (top > 0)
+		{
+			const auto [x, y] = stack[--top];
+			for (const Edge& edge : menu[x])
+			{
+				if (!energize(edge.to, scramblers[edge.step][y]))
+					return false;
+			}
+		}
+		return true;
+	}
+
+public:
+	// the crib is the plaintext of the ciphertext starting at offset
+	Bombe(const char* crib, const char* ciphertext, int offset) : ciphertext(ciphertext), offset(offset)
+	{
+		const int sz = std::strlen(crib);
+		if (offset + sz > int(std::strlen(ciphertext)))
+			throw "crib runs past the end of the ciphertext";
+
+		std::array<int, 26> connections{0};
+		for (int i = 0; i < sz; ++i)
+		{
+			const int8_t p = charToIndex(crib[i]);
+			const int8_t c = charToIndex(ciphertext[offset + i]);
+			if (p == c)
+				throw "crib letter encrypts to itself";
+			plain.push_back(p);
+			cipher.push_back(c);
+			menu[p].push_back({c, i});
+			menu[c].push_back({p, i});
+			connections[p]++;
+			connections[c]++;
+		}
+		testLetter = std::max_element(connections.begin(), connections.end()) - connections.begin();
+	}
+
+	int cribLength() const { return plain.size(); }
+
+	// all stops for every start position and right ring setting of one rotor order that pass the
+	// checking machine. The middle and left ring only matter through the double step and are left
+	// at zero, the score of a stop is the number of crib letters it decrypts correctly.
+	// The start positions with the same shift of the right rotor (position - ring) only differ in
+	// when the middle rotor steps, those that step it under the same crib letters share their stops.
+	std::vector<ScoredEnigmaKey> run(const std::array<int8_t, 3>& rotors, char reflector) const
+	{
+		const int sz = cribLength();
+		const std::vector<int8_t> table = scramblerTable(rotors, reflector);
+		const std::vector<int16_t> positions = positionTable(rotors);
+		std::vector<ScoredEnigmaKey> stops;
+		std::vector<const int8_t*> scramblers(sz);
+		Hypotheses live;
+
+		// the walks of the left and middle rotor seen so far for one shift, with their stops
+		struct Turnovers
+		{
+			const int16_t* walk;
+			std::vector<ScoredEnigmaKey> stops;
+		};
+		std::vector<Turnovers> seen;
+		auto sameTurnovers = [sz](const int16_t* l, const int16_t* r) {
+			for (int step = 0; step < sz; ++step)
+			{
+				if (l[step] / 26 != r[step] / 26)
+					return false;
+			}
+			return true;
+		};
+
+		for (int8_t i = 0; i < 26; ++i)
+		{
+			for (int8_t j = 0; j < 26; ++j)
+			{
+				for (int8_t shift = 0; shift < 26; ++shift)
+				{
+					seen.clear();
+					for (int8_t k = 0; k < 26; ++k)
+					{
+						const int8_t ring = (k + 26 - shift) % 26;
+						const int16_t* walk = &positions[((i * 26 + j) * 26 + k) * sz];
+						auto known = std::find_if(seen.begin(), seen.end(), [&](const Turnovers& t) {
+							return sameTurnovers(t.walk, walk);
+						});
+						if (known != seen.end())
+						{
+							for (ScoredEnigmaKey stop : known->stops)
+							{
+								stop.indicators[2] = k;
+								stop.rings[2] = ring;
+								stops.push_back(stop);
+							}
+							continue;
+						}
+
+						for (int step = 0; step < sz; ++step)
+						{
+							const int shifts = walk[step] / 26 * 26 + (walk[step] % 26 + 26 - ring) % 26;
+							scramblers[step] = &table[shifts * 26];
+						}
+
+						// guesses in the closure of a contradiction contradict as well
+						seen.push_back({walk, {}});
+						uint32_t rejected = 0;
+						for (int8_t guess = 0; guess < 26; ++guess)
+						{
+							if (rejected & (1u << guess))
+								continue;
+							if (!closure(scramblers, guess, live))
+							{
+								rejected |= live[testLetter];
+								continue;
+							}
+
+							ScoredEnigmaKey stop(rotors, reflector, {i, j, k}, {0, 0, ring}, Plugboard{});
+							const ScramblerTrace trace(stop.createEnigma(), ciphertext.c_str());
+							if (!check(stop, live, trace))
+								continue;
+							stops.push_back(stop);
+							seen.back().stops.push_back(stop);
+						}
+					}
+				}
+			}
+		}
+		return stops;
+	}
+
+private:
+	// the checking machine: starts from the steckers of the stop, deduces further ones from the crib
+	// positions where one side is known and counts the crib letters the resulting plugboard
+	// decrypts correctly. Returns false if the deductions contradict each other.
+	bool check(ScoredEnigmaKey& stop, const Hypotheses& live, const ScramblerTrace& trace) const
+	{
+		std::array<int8_t, 26> partner;
+		partner.fill(-1);
+		for (int8_t x = 0; x < 26; ++x)
+		{
+			if (live[x])
+				partner[x] = __builtin_ctz(live[x]);
+		}
+
+		auto connect = [&](int8_t x, int8_t y) {
+			if (partner[x] == y)
+				return true;
+			if (partner[x] >= 0 || partner[y] >= 0)
+				return false;
+			partner[x] = y;
+			partner[y] = x;
+			return true;
+		};
+
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (int i = 0; i < cribLength(); ++i)
+			{
+				const int8_t c = cipher[i];
+				const int8_t p = plain[i];
+				// the scrambler is an involution, so it maps the partner of either side onto the other
+				for (auto [known, other] : {std::make_pair(c, p), std::make_pair(p, c)})
+				{
+					if (partner[known] < 0)
+						continue;
+					const int8_t scrambled = trace.scramble(offset + i, partner[known]);
+					if (partner[other] == scrambled)
+						continue;
+					if (!connect(scrambled, other))
+						return false;
+					changed = true;
+				}
+			}
+		}
+
+		stop.plugboard = Plugboard{};
+		stop.plugboard.has_plugs = true;
+		for (int8_t x = 0; x < 26; ++x)
+		{
+			if (partner[x] > x)
+				stop.plugboard.addPlug(x, partner[x]);
+		}
+
+		int matches = 0;
+		for (int i = 0; i < cribLength(); ++i)
+			matches += trace.decrypt(offset + i, stop.plugboard) == plain[i] ? 1 : 0;
+		stop.score = matches;
+		return true;
+	}
+};
+
+#endif
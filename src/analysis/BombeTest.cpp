@@ -0,0 +1,29 @@
+#include <analysis/Bombe.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+TEST(Analysis, BombeStopsAtTrueKey)
+{
+	// the right rotor passes its notch under the crib, so the middle rotor steps in the menu
+	Enigma e({2, 5, 3}, 'B', {7, 4, 19}, {0, 0, 11}, {"AF", "TV", "KO", "BL", "RW"});
+	const std::string ciphertext =
+			encryptString(e, "WETTERVORHERSAGEFUERDIEBISKAYAHEUTEKLARUNDWINDSTILLKEINEBESONDERENVORKOMMNISSE");
+
+	const Bombe bombe("WETTERVORHERSAGE", ciphertext.c_str(), 0);
+	const std::vector<ScoredEnigmaKey> stops = bombe.run({2, 5, 3}, 'B');
+	auto trueKey = std::find_if(stops.begin(), stops.end(), [](const ScoredEnigmaKey& stop) {
+		return stop.indicators == std::array<int8_t, 3>{7, 4, 19} && stop.rings == std::array<int8_t, 3>{0, 0, 11};
+	});
+	ASSERT_NE(stops.end(), trueKey);
+	EXPECT_EQ(bombe.cribLength(), trueKey->score);
+	EXPECT_EQ("AF BL KO RW TV ", trueKey->plugboard.ToString());
+}
+
+TEST(Analysis, BombeCribOnCiphertext)
+{
+	Enigma e({1, 2, 3}, 'B', {0, 0, 0}, {0, 0, 0}, {});
+	const std::string ciphertext = encryptString(e, "KEINEBESONDERENVORKOMMNISSE");
+	EXPECT_ANY_THROW(Bombe("KEINEBESONDERENVORKOMMNISSEX", ciphertext.c_str(), 0));
+	EXPECT_ANY_THROW(Bombe(ciphertext.c_str(), ciphertext.c_str(), 0));
+}
@@ -0,0 +1,53 @@
+#ifndef ANALYSIS_CRIBPLACEMENT_H
+#define ANALYSIS_CRIBPLACEMENT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct CribPlacement
+{
+	std::string crib;
+	int offset;
+};
+
+// Crib dragging: the Enigma never encrypts a letter to itself, so a crib can only sit where none of
+// its letters meets the same letter in the ciphertext. The inner loop runs over all offsets at once
+// with one byte compare each, which the compiler turns into vector compares.
+// Returns the possible placements of all cribs, longest crib first.
+inline std::vector<CribPlacement> findCribPlacements(const std::vector<std::string>& cribs, const char* ciphertext)
+{
+	const int length = std::strlen(ciphertext);
+	std::vector<CribPlacement> placements;
+	std::vector<uint8_t> conflict;
+	for (const std::string& crib : cribs)
+	{
+		const int offsets = length - int(crib.size()) + 1;
+		if (crib.empty() || offsets <= 0)
+			continue;
+
+		conflict.assign(offsets, 0);
+		for (size_t i = 0; i < crib.size(); ++i)
+		{
+			const char c = crib[i];
+			const char* text = ciphertext + i;
+			for (int o = 0; o < offsets; ++o)
+				conflict[o] |= text[o] == c;
+		}
+
+		for (int o = 0; o < offsets; ++o)
+		{
+			if (!conflict[o])
+				placements.push_back({crib, o});
+		}
+	}
+
+	std::stable_sort(placements.begin(), placements.end(), [](const auto& l, const auto& r) {
+		return l.crib.size() > r.crib.size();
+	});
+	return placements;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include <analysis/CribPlacement.h>
+#include <enigma/Enigma.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+TEST(Analysis, CribPlacementFindsTrueOffset)
+{
+	Enigma e({2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, {"AF", "TV", "KO", "BL", "RW"});
+	const std::string ciphertext = encryptString(e, "ANXOBERKOMMANDODERWEHRMACHTWETTERVORHERSAGEFUERHEUTE");
+	const std::string crib = "OBERKOMMANDO";
+
+	const std::vector<CribPlacement> placements = findCribPlacements({crib}, ciphertext.c_str());
+	ASSERT_FALSE(placements.empty());
+	EXPECT_TRUE(std::any_of(placements.begin(), placements.end(), [&](const CribPlacement& p) {
+		return p.crib == crib && p.offset == 3;
+	}));
+
+	// every offset where a crib letter meets itself is excluded, all others are kept
+	int possible = 0;
+	for (size_t o = 0; o + crib.size() <= ciphertext.size(); ++o)
+	{
+		bool selfEncryption = false;
+		for (size_t i = 0; i < crib.size(); ++i)
+			selfEncryption |= ciphertext[o + i] == crib[i];
+		const bool found = std::any_of(placements.begin(), placements.end(), [&](const CribPlacement& p) {
+			return p.offset == int(o);
+		});
+		EXPECT_EQ(!selfEncryption, found) << o;
+		possible += selfEncryption ? 0 : 1;
+	}
+	EXPECT_EQ(possible, int(placements.size()));
+	EXPECT_LT(possible, int(ciphertext.size() - crib.size() + 1));
+}
+
+TEST(Analysis, CribPlacementLongestFirst)
+{
+	const std::vector<CribPlacement> placements = findCribPlacements({"AB", "ABCD", "TOOLONGFORTHETEXT"}, "ZZZZZZZZ");
+	ASSERT_EQ(12, int(placements.size()));
+	EXPECT_EQ("ABCD", placements.front().crib);
+	EXPECT_EQ("AB", placements.back().crib);
+}
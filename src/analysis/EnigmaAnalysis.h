@@ -2,15 +2,31 @@
 #define ANALYSIS_ENIGMAANALYSIS_H
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <execution>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <numeric>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
+#include <analysis/Bombe.h>
+#include <analysis/FastRandom.h>
+#include <analysis/PlugboardEnumerator.h>
+#include <analysis/PrefixBound.h>
 #include <analysis/ScoredEnigmaKey.h>
+#include <analysis/ScramblerTrace.h>
+#include <analysis/fitness/Accumulator.h>
+#include <analysis/fitness/FitnessCascade.h>
 #include <analysis/fitness/IoCFitness.h>
 #include <enigma/Enigma.h>
+#include <enigma/Uhr.h>
 
 class EnigmaAnalysis
 {
@@ -22,11 +38,11 @@ public:
 		EIGHT
 	};
 
-	template<int T, class FitnessFunction>
-	static std::vector<ScoredEnigmaKey> findRotorConfiguration(std::array<int8_t, T> ciphertext,
-			AvailableRotors rotors,
-			Plugboard plugboard,
-			FitnessFunction f)
+	// J-Y is wired fixed in the UKW-D
+	static constexpr int8_t ukwDFixedFirst = charToIndex('J');
+	static constexpr int8_t ukwDFixedSecond = charToIndex('Y');
+
+	static std::vector<std::array<int8_t, 3>> rotorOrders(AvailableRotors rotors)
 	{
 		std::vector<int8_t> availableRotorList;
 
@@ -44,8 +60,7 @@ public:
 			break;
 		}
 
-		std::vector<std::pair<int, std::array<int8_t, 3>>> rotorComb;
-		int i{0};
+		std::vector<std::array<int8_t, 3>> rotorComb;
 		for (int8_t rotor1 : availableRotorList)
 		{
 			for (int8_t rotor2 : availableRotorList)
@@ -56,19 +71,163 @@ public:
 				{
 					if ((rotor1 == rotor3) || (rotor2 == rotor3))
 						continue;
-					rotorComb.emplace_back(std::make_pair(i++, std::array<int8_t, 3>{rotor1, rotor2, rotor3}));
+					rotorComb.push_back({rotor1, rotor2, rotor3});
 				}
 			}
 		}
+		return rotorComb;
+	}
 
-		std::vector<ScoredEnigmaKey> keySet;
-		keySet.resize(rotorComb.size());
+	template<int T, class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> findRotorConfiguration(std::array<int8_t, T> ciphertext,
+			AvailableRotors rotors,
+			Plugboard plugboard,
+			FitnessFunction f)
+	{
+		return findRotorConfiguration<T>(ciphertext, rotors, std::array<char, 1>{'B'}, plugboard, f);
+	}
 
-		std::for_each(std::execution::par_unseq, rotorComb.cbegin(), rotorComb.cend(), [&](const auto& comb) {
-			float maxFitness = -1e30f;
-			ScoredEnigmaKey bestKey;
-			const std::array<int8_t, 3>& rotors = comb.second;
-			Enigma e{rotors, 'B', {0, 0, 0}, {12, 2, 20}, Plugboard{}};
+	// decrypts under every reflector from the current rotor positions and scores the decryptions.
+	// Fitness functions with an accumulator score while decrypting and the decryptions are never
+	// written out, the others get them in results.
+	// With a bound, accumulators decrypt from checkpoint to checkpoint and go on only while one
+	// of the reflectors may still beat its threshold. Rejected candidates score lowest().
+	// Exact checkpoints are skipped by accumulators without an upper bound.
+	template<size_t T, size_t R, class FitnessFunction>
+	static std::array<float, R> scoreReflectors(Enigma& e,
+			const std::array<int8_t, T>& ciphertext,
+			const std::array<Reflector, R>& reflectors,
+			std::array<std::array<int8_t, T>, R>& results,
+			FitnessFunction& f,
+			const PrefixBound& bound,
+			const std::array<float, R>& thresholds)
+	{
+		std::array<float, R> scores;
+		if constexpr (hasAccumulator<FitnessFunction>)
+		{
+			using Accumulator = decltype(f.accumulator());
+			std::array<Accumulator, R> accumulators;
+			accumulators.fill(f.accumulator());
+			int scored = 0;
+			for (const PrefixBound::Checkpoint& checkpoint : bound.checkpoints)
+			{
+				if (checkpoint.length >= int(T) || (checkpoint.exact && !hasUpperBound<Accumulator>))
+					continue;
+				e.encryptInto(ciphertext, reflectors, accumulators, scored, checkpoint.length);
+				bool promising = false;
+				for (size_t r = 0; r < R; ++r)
+				{
+					if constexpr (hasUpperBound<Accumulator>)
+					{
+						if (checkpoint.exact)
+						{
+							promising |= accumulators[r].bound(T - checkpoint.length) > thresholds[r];
+							continue;
+						}
+					}
+					promising |= !checkpoint.rejects(accumulators[r].score(), thresholds[r]);
+				}
+				if (!promising)
+				{
+					scores.fill(std::numeric_limits<float>::lowest());
+					return scores;
+				}
+				scored = checkpoint.length;
+			}
+			e.encryptInto(ciphertext, reflectors, accumulators, scored, T);
+			for (size_t r = 0; r < R; ++r)
+				scores[r] = accumulators[r].score();
+		}
+		else
+		{
+			e.encrypt(ciphertext, reflectors, results);
+			for (size_t r = 0; r < R; ++r)
+				scores[r] = f.score(results[r]);
+		}
+		return scores;
+	}
+
+	// the machines a rotor search walks the start positions of: every rotor order and on the M4
+	// every greek wheel in every position on top. The search fills in reflector and start positions.
+	static std::vector<ScoredEnigmaKey> rotorSlots(AvailableRotors rotors,
+			bool greekWheels,
+			std::array<int8_t, 3> rings,
+			const Plugboard& plugboard)
+	{
+		std::vector<ScoredEnigmaKey> slots;
+		for (const std::array<int8_t, 3>& comb : rotorOrders(rotors))
+		{
+			if (!greekWheels)
+			{
+				slots.emplace_back(comb, 'B', std::array<int8_t, 3>{0, 0, 0}, rings, plugboard);
+				continue;
+			}
+			for (int8_t greekRotor : {9, 10})
+			{
+				for (int8_t greekPosition = 0; greekPosition < 26; ++greekPosition)
+				{
+					slots.emplace_back(comb, 'B', std::array<int8_t, 3>{0, 0, 0}, rings, plugboard);
+					slots.back().greekRotor = greekRotor;
+					slots.back().greekIndicator = greekPosition;
+				}
+			}
+		}
+		return slots;
+	}
+
+	// searches every reflector in reflectorIds alongside the start positions of every slot,
+	// returns the best kept keys for each combination of slot and reflector, best first.
+	// With a bound or more than one kept key, keys that can't get among the best
+	// max(bound.keep, kept) of the whole search anymore are left out, so weak slots return fewer
+	// keys or none. Without, every slot and reflector returns its best kept keys.
+	// The greek wheel of the M4 never steps and is part of the combined reflector,
+	// so each candidate costs the same as on the three rotor machine.
+	// A calibrated bound (see calibratePrefixBound) drops most candidates long before the end,
+	// at the risk of missing one of the top keys with about its false negative rate.
+	template<size_t T, size_t R, class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> searchRotorSlots(const std::array<int8_t, T>& ciphertext,
+			const std::vector<ScoredEnigmaKey>& slots,
+			std::array<char, R> reflectorIds,
+			FitnessFunction& f,
+			const PrefixBound& bound,
+			int kept = 1)
+	{
+		std::array<Reflector, R> reflectors{};
+		for (size_t r = 0; r < R; ++r)
+			reflectors[r] = Reflector::Create(reflectorIds[r]);
+
+		struct Candidate
+		{
+			float score;
+			std::array<int8_t, 3> indicators;
+		};
+		auto byScore = [](const Candidate& l, const Candidate& r) { return l.score > r.score; };
+		using Heaps = std::array<std::vector<Candidate>, R>;
+
+		// a candidate has to beat the kept best of its own slot and reflector and,
+		// when pruning, the top keys of all
+		const bool prune = !bound.checkpoints.empty() || kept > 1;
+		TopScores topScores(std::max(bound.keep, kept));
+		auto thresholds = [&](const Heaps& heaps) {
+			std::array<float, R> result;
+			for (size_t r = 0; r < R; ++r)
+			{
+				const bool full = heaps[r].size() == size_t(kept);
+				result[r] = full ? heaps[r].front().score : std::numeric_limits<float>::lowest();
+				if (prune)
+					result[r] = std::max(result[r], topScores.threshold());
+			}
+			return result;
+		};
+
+		// every slot and reflector keeps its best candidates in a min heap
+		std::vector<Heaps> slotHeaps(slots.size());
+		std::vector<int> ints(slots.size());
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par_unseq, ints.cbegin(), ints.cend(), [&](int slot) {
+			Heaps& heaps = slotHeaps[slot];
+			Enigma e = slots[slot].createEnigma();
+			std::array<std::array<int8_t, T>, R> results;
 			for (int8_t i = 0; i < 26; i += 1)
 			{
 				for (int8_t j = 0; j < 26; j++)
@@ -76,19 +235,50 @@ public:
 					for (int8_t k = 0; k < 26; k += 1)
 					{
 						e.resetRotorPositions(i, j, k);
-						std::array<int8_t, T> result = e.encrypt(ciphertext);
-						float fitness = f.score(result);
-						if (fitness > bestKey.score)
+						const std::array<float, R> beat = thresholds(heaps);
+						const std::array<float, R> scores = scoreReflectors(e, ciphertext, reflectors, results, f, bound, beat);
+						for (size_t r = 0; r < R; ++r)
 						{
-							bestKey = ScoredEnigmaKey(rotors, {i, j, k}, {0, 0, 0}, Plugboard{});
-							bestKey.score = fitness;
+							std::vector<Candidate>& heap = heaps[r];
+							if (scores[r] <= beat[r])
+								continue;
+							heap.push_back({scores[r], {i, j, k}});
+							std::push_heap(heap.begin(), heap.end(), byScore);
+							if (heap.size() > size_t(kept))
+							{
+								std::pop_heap(heap.begin(), heap.end(), byScore);
+								heap.pop_back();
+							}
 						}
 					}
 				}
 			}
-			keySet[comb.first] = std::move(bestKey);
+			for (const std::vector<Candidate>& heap : heaps)
+			{
+				for (const Candidate& candidate : heap)
+				{
+					if (prune && candidate.score > topScores.threshold())
+						topScores.publish(candidate.score);
+				}
+			}
 		});
 
+		std::vector<ScoredEnigmaKey> keySet;
+		keySet.reserve(slots.size() * R * kept);
+		for (size_t slot = 0; slot < slots.size(); ++slot)
+		{
+			for (size_t r = 0; r < R; ++r)
+			{
+				for (const Candidate& candidate : slotHeaps[slot][r])
+				{
+					keySet.push_back(slots[slot]);
+					keySet.back().reflector = reflectorIds[r];
+					keySet.back().indicators = candidate.indicators;
+					keySet.back().score = candidate.score;
+				}
+			}
+		}
+
 		// Sort keys by best performing (highest fitness score)
 		std::sort(keySet.begin(), keySet.end(), [](const ScoredEnigmaKey& l, const ScoredEnigmaKey& r) {
 			return l.score > r.score;
@@ -96,6 +286,148 @@ public:
 		return keySet;
 	}
 
+	// searches every reflector in reflectorIds alongside the rotors,
+	// returns the best key for each combination of rotors and reflector
+	template<int T, size_t R, class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> findRotorConfiguration(std::array<int8_t, T> ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessFunction f,
+			PrefixBound bound = {})
+	{
+		return searchRotorSlots(ciphertext, rotorSlots(rotors, false, {12, 2, 20}, Plugboard{}), reflectorIds, f, bound);
+	}
+
+	// naval M4: searches both greek wheels in all 26 positions on top of the rotors
+	// and start positions, reflectorIds are the thin reflectors ('b', 'c')
+	template<int T, size_t R, class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> findRotorConfigurationM4(std::array<int8_t, T> ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessFunction f,
+			PrefixBound bound = {})
+	{
+		return searchRotorSlots(ciphertext, rotorSlots(rotors, true, {0, 0, 0}, plugboard), reflectorIds, f, bound);
+	}
+
+	// findRotorConfiguration with a cascade: every candidate is scored by its first tier, the best kept()
+	// of all rotor orders, reflectors and start positions go through the further tiers.
+	// Returns the survivors of the last tier, ranked by it. A bound drops the candidates that can't
+	// get among the kept ones anymore.
+	template<int T, size_t R, class... Tiers>
+	static std::vector<ScoredEnigmaKey> findRotorConfigurationCascade(std::array<int8_t, T> ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessCascade<Tiers...> cascade,
+			PrefixBound bound = {})
+	{
+		return cascadeRotorSlots(ciphertext, rotorSlots(rotors, false, {12, 2, 20}, Plugboard{}), reflectorIds, cascade, bound);
+	}
+
+	// findRotorConfigurationM4 with a cascade, see above
+	template<int T, size_t R, class... Tiers>
+	static std::vector<ScoredEnigmaKey> findRotorConfigurationM4Cascade(std::array<int8_t, T> ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessCascade<Tiers...> cascade,
+			PrefixBound bound = {})
+	{
+		return cascadeRotorSlots(ciphertext, rotorSlots(rotors, true, {0, 0, 0}, plugboard), reflectorIds, cascade, bound);
+	}
+
+	template<size_t T, size_t R, class... Tiers>
+	static std::vector<ScoredEnigmaKey> cascadeRotorSlots(const std::array<int8_t, T>& ciphertext,
+			const std::vector<ScoredEnigmaKey>& slots,
+			std::array<char, R> reflectorIds,
+			const FitnessCascade<Tiers...>& cascade,
+			const PrefixBound& bound)
+	{
+		auto first = cascade.first();
+		std::vector<ScoredEnigmaKey> keySet = searchRotorSlots(ciphertext, slots, reflectorIds, first, bound, cascade.kept());
+		if (keySet.size() > size_t(cascade.kept()))
+			keySet.resize(cascade.kept());
+
+		cascade.promote(keySet, [&](const ScoredEnigmaKey& key) {
+			Enigma e = key.createEnigma();
+			return e.encrypt(ciphertext);
+		});
+		return keySet;
+	}
+
+	// calibrates the prefix bound of findRotorConfiguration on random candidates of the same search,
+	// with checkpoints every prefix letters. A larger falseNegativeRate drops more candidates and
+	// misses more top keys.
+	template<size_t T, size_t R, class FitnessFunction>
+	static PrefixBound calibratePrefixBound(const std::array<int8_t, T>& ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessFunction f,
+			int prefix,
+			float falseNegativeRate,
+			int samples = 4096)
+	{
+		return calibrateRotorSlots(ciphertext, rotorSlots(rotors, false, {12, 2, 20}, Plugboard{}), reflectorIds, f, prefix, falseNegativeRate, samples);
+	}
+
+	// the same for findRotorConfigurationM4
+	template<size_t T, size_t R, class FitnessFunction>
+	static PrefixBound calibratePrefixBoundM4(const std::array<int8_t, T>& ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			Plugboard plugboard,
+			FitnessFunction f,
+			int prefix,
+			float falseNegativeRate,
+			int samples = 4096)
+	{
+		return calibrateRotorSlots(ciphertext, rotorSlots(rotors, true, {0, 0, 0}, plugboard), reflectorIds, f, prefix, falseNegativeRate, samples);
+	}
+
+	// samples random start positions of random slots under every reflector
+	template<size_t T, size_t R, class FitnessFunction>
+	static PrefixBound calibrateRotorSlots(const std::array<int8_t, T>& ciphertext,
+			const std::vector<ScoredEnigmaKey>& slots,
+			std::array<char, R> reflectorIds,
+			FitnessFunction& f,
+			int prefix,
+			float falseNegativeRate,
+			int samples)
+	{
+		static_assert(hasAccumulator<FitnessFunction>, "prefixes are scored by accumulators");
+		std::vector<int> lengths;
+		for (int length = prefix; prefix > 0 && length < int(T); length += prefix)
+			lengths.push_back(length);
+
+		std::array<Reflector, R> reflectors{};
+		for (size_t r = 0; r < R; ++r)
+			reflectors[r] = Reflector::Create(reflectorIds[r]);
+
+		FastRandom gen(prefix);
+		std::vector<std::vector<float>> scores(samples * R, std::vector<float>(lengths.size() + 1));
+		for (int s = 0; s < samples; ++s)
+		{
+			Enigma e = slots[gen.below(slots.size())].createEnigma();
+			e.resetRotorPositions(int8_t(gen.below(26)), int8_t(gen.below(26)), int8_t(gen.below(26)));
+			std::array<decltype(f.accumulator()), R> accumulators;
+			accumulators.fill(f.accumulator());
+			int scored = 0;
+			for (size_t c = 0; c <= lengths.size(); ++c)
+			{
+				const int length = c < lengths.size() ? lengths[c] : T;
+				e.encryptInto(ciphertext, reflectors, accumulators, scored, length);
+				for (size_t r = 0; r < R; ++r)
+					scores[s * R + r][c] = accumulators[r].score();
+				scored = length;
+			}
+		}
+		return PrefixBound::calibrate(lengths, scores, falseNegativeRate);
+	}
+
 	template<class FitnessFunction>
 	static ScoredEnigmaKey findRingSettings(ScoredEnigmaKey key, const char* ciphertext, FitnessFunction f)
 	{
@@ -103,7 +435,7 @@ public:
 		key.rings = findRingSetting(key, ciphertext, f);
 		// now we know the correct difference between rotors and starting positions.
 		// Calculate fitness and return scored key
-		Enigma e(key.rotors, 'B', key.rings, key.indicators, key.plugboard);
+		Enigma e = key.createEnigma();
 		std::string result = encryptString(e, ciphertext);
 		key.score = f.score(result);
 		return key;
@@ -129,7 +461,7 @@ public:
 					for (int8_t l = 0; l < 26; l++)
 					{
 						std::array<int8_t, 3> currentRings{k, j, i};
-						Enigma e{key.rotors, 'B', {0, 0, l}, currentRings, key.plugboard};
+						Enigma e = key.createEnigma({0, 0, l}, currentRings, key.plugboard);
 						result = encryptString(e, ciphertext);
 						float fitness = f.score(result);
 						if (fitness > maxFitness)
@@ -169,7 +501,7 @@ public:
 					currentRings[0] = (currentRings[0] + i) % 26;
 					currentRings[1] = (currentRings[1] + j) % 26;
 					currentRings[2] = (currentRings[2] + k) % 26;
-					Enigma e{key.rotors, 'B', currentIndicators, currentRings, key.plugboard};
+					Enigma e = key.createEnigma(currentIndicators, currentRings, key.plugboard);
 					result = encryptString(e, ciphertext);
 					float fitness = f.score(result);
 					if (fitness > maxFitness)
@@ -186,7 +518,7 @@ public:
 		key.rings[2] = (optimalStarts[2] + key.rings[2]) % 26;
 
 		// Calculate fitness and return scored key
-		Enigma e(key.rotors, 'B', key.rings, key.indicators, key.plugboard);
+		Enigma e = key.createEnigma();
 		result = encryptString(e, ciphertext);
 		key.score = f.score(result);
 		return key;
@@ -194,6 +526,12 @@ public:
 	// this modifies the plugs on the fly
 	template<class FitnessFunction>
 	static void findPlug(ScoredEnigmaKey& key, const char* ciphertext, FitnessFunction f)
+	{
+		findPlug(key, ScramblerTrace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext), f);
+	}
+
+	template<class FitnessFunction>
+	static void findPlug(ScoredEnigmaKey& key, const ScramblerTrace& trace, FitnessFunction f)
 	{
 		std::string result;
 		ScoredEnigmaKey newKey = key;
@@ -212,8 +550,7 @@ public:
 				Plugboard newBoard = key.plugboard;
 				newBoard.addPlug(i, j);
 
-				Enigma e(key.rotors, 'B', key.indicators, key.rings, newBoard);
-				result = encryptString(e, ciphertext);
+				trace.decrypt(newBoard, result);
 				float fitness = f.score(result);
 				if (fitness > newKey.score)
 				{
@@ -230,17 +567,612 @@ public:
 	template<class FitnessFunction>
 	static ScoredEnigmaKey findPlugs(ScoredEnigmaKey key, int8_t maxPlugs, const char* ciphertext, FitnessFunction f)
 	{
+		// the rotors don't change while searching the plugs
+		ScramblerTrace trace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext);
 		for (int8_t i = 0; i < maxPlugs; i++)
 		{
-			findPlug(key, ciphertext, f);
+			findPlug(key, trace, f);
 		}
 
 		// Calculate fitness and return scored key
-		Enigma e(key.rotors, 'B', key.rings, key.indicators, key.plugboard);
+		Enigma e = key.createEnigma();
 		std::string result = encryptString(e, ciphertext);
 		key.score = f.score(result);
 		return key;
 	}
+
+	// known plaintext attack with a bombe for every rotor order and reflector. The crib is the
+	// plaintext of the ciphertext at offset. The steckers found by the bombe and the checking
+	// machine are completed with the best plugs by the fitness function up to maxPlugs, the keys
+	// are returned best first.
+	template<size_t R, class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> findKeyWithBombe(const char* crib,
+			int offset,
+			const char* ciphertext,
+			AvailableRotors rotors,
+			std::array<char, R> reflectorIds,
+			int8_t maxPlugs,
+			FitnessFunction f)
+	{
+		const Bombe bombe(crib, ciphertext, offset);
+
+		std::vector<std::pair<std::array<int8_t, 3>, char>> drums;
+		for (const std::array<int8_t, 3>& order : rotorOrders(rotors))
+		{
+			for (char reflector : reflectorIds)
+				drums.emplace_back(order, reflector);
+		}
+
+		std::vector<std::vector<ScoredEnigmaKey>> stops(drums.size());
+		std::vector<int> ints(drums.size());
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int d) {
+			for (ScoredEnigmaKey& stop : bombe.run(drums[d].first, drums[d].second))
+			{
+				// only stops that explain the whole crib are worth the plug search
+				if (stop.score < bombe.cribLength())
+					continue;
+				ScramblerTrace trace(stop.createEnigma(stop.indicators, stop.rings, Plugboard{}), ciphertext);
+				stop.score = f.score(trace.decrypt(stop.plugboard));
+				int plugs = std::count(stop.plugboard.plugged.begin(), stop.plugboard.plugged.end(), true) / 2;
+				for (; plugs < maxPlugs; ++plugs)
+					findPlug(stop, trace, f);
+				stops[d].push_back(stop);
+			}
+		});
+
+		std::vector<ScoredEnigmaKey> keys;
+		for (const std::vector<ScoredEnigmaKey>& found : stops)
+			keys.insert(keys.end(), found.begin(), found.end());
+		std::sort(keys.begin(), keys.end(), [](const auto& l, const auto& r) { return l.score > r.score; });
+		return keys;
+	}
+
+	// tries every plugboard with exactly numPlugs (at most 4) plugs and returns the one with the
+	// best IoC. The boards are rescored incrementally from the previous one, each shard of the
+	// enumeration runs on its own copy of the scorer.
+	static ScoredEnigmaKey findPlugsExhaustive(ScoredEnigmaKey key, int8_t numPlugs, const char* ciphertext)
+	{
+		const PlugboardEnumerator enumerator(numPlugs);
+		const IncrementalIoC initial(ScramblerTrace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext));
+
+		std::vector<ScoredEnigmaKey> results(enumerator.shards(), key);
+		std::vector<int> ints(enumerator.shards());
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int shard) {
+			IncrementalIoC ioc = initial;
+			ScoredEnigmaKey& best = results[shard];
+			best.score = -1e30f;
+			enumerator.enumerate(shard, ioc, [&](const Plugboard& board, const IncrementalIoC& state) {
+				float fitness = state.score();
+				if (fitness > best.score)
+				{
+					best.score = fitness;
+					best.plugboard = board;
+				}
+			});
+		});
+
+		return *std::max_element(results.begin(), results.end(), [](const auto& l, const auto& r) {
+			return l.score < r.score;
+		});
+	}
+
+	// Monte Carlo search over random plugboards with exactly numPlugs plugs, see the README for
+	// how many trials it takes to get enough plugs right by chance. The trials are spread over many
+	// lanes, each with its own generator stream and top list, so the cores never share a cache line
+	// except for the trial counter. Reports the throughput to stderr every reportInterval
+	// (zero turns that off) and returns the best topK boards found.
+	template<class FitnessFunction>
+	static std::vector<ScoredEnigmaKey> findPlugsMonteCarlo(const ScoredEnigmaKey& key,
+			int8_t numPlugs,
+			const char* ciphertext,
+			FitnessFunction f,
+			uint64_t trials,
+			int topK = 10,
+			std::chrono::milliseconds reportInterval = std::chrono::seconds(1))
+	{
+		const ScramblerTrace trace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext);
+
+		const int lanes = std::max(1u, std::thread::hardware_concurrency()) * 8;
+		std::vector<std::vector<ScoredEnigmaKey>> laneBest(lanes);
+		std::atomic<uint64_t> done{0};
+		bool finished = false;
+		std::mutex reportMutex;
+		std::condition_variable reportWakeup;
+
+		std::thread reporter;
+		const auto start = std::chrono::steady_clock::now();
+		if (reportInterval.count() > 0)
+		{
+			reporter = std::thread([&] {
+				std::unique_lock<std::mutex> lock(reportMutex);
+				while (!reportWakeup.wait_for(lock, reportInterval, [&] { return finished; }))
+				{
+					const double seconds =
+							std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+					const uint64_t count = done;
+					std::cerr << count << " / " << trials << " trials, " << uint64_t(count / seconds)
+							  << " trials/s\n";
+				}
+			});
+		}
+
+		std::vector<int> ints(lanes);
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int lane) {
+			FastRandom gen(lane);
+			std::vector<ScoredEnigmaKey>& best = laneBest[lane];
+			float threshold = -1e30f;
+			std::string result;
+
+			// a partial Fisher-Yates shuffle draws the plugged letters, any previous order
+			// of the letters is as good a start as the sorted one
+			std::array<int8_t, 26> letters;
+			std::iota(letters.begin(), letters.end(), 0);
+
+			const uint64_t laneTrials = trials / lanes + (uint64_t(lane) < trials % lanes ? 1 : 0);
+			constexpr uint64_t batch = 4096;
+			for (uint64_t begin = 0; begin < laneTrials; begin += batch)
+			{
+				const uint64_t end = std::min(laneTrials, begin + batch);
+				for (uint64_t trial = begin; trial < end; ++trial)
+				{
+					Plugboard board;
+					for (int8_t p = 0; p < 2 * numPlugs; p += 2)
+					{
+						std::swap(letters[p], letters[p + gen.below(26 - p)]);
+						std::swap(letters[p + 1], letters[p + 1 + gen.below(25 - p)]);
+						board.addPlug(letters[p], letters[p + 1]);
+					}
+
+					trace.decrypt(board, result);
+					float fitness = f.score(result);
+					if (fitness <= threshold)
+						continue;
+
+					ScoredEnigmaKey candidate = key;
+					candidate.plugboard = board;
+					candidate.score = fitness;
+					if (best.size() < size_t(topK))
+					{
+						best.push_back(candidate);
+					}
+					else
+					{
+						*std::min_element(best.begin(), best.end(), [](const auto& l, const auto& r) {
+							return l.score < r.score;
+						}) = candidate;
+					}
+					if (best.size() == size_t(topK))
+					{
+						threshold = std::min_element(best.begin(), best.end(), [](const auto& l, const auto& r) {
+							return l.score < r.score;
+						})->score;
+					}
+				}
+				done += end - begin;
+			}
+		});
+
+		{
+			std::lock_guard<std::mutex> lock(reportMutex);
+			finished = true;
+		}
+		reportWakeup.notify_one();
+		if (reporter.joinable())
+			reporter.join();
+
+		// merge the lanes, the same board may have been drawn more than once. Sorted by board
+		// first, as boards of equal score don't have to end up next to each other otherwise.
+		std::vector<ScoredEnigmaKey> best;
+		for (const std::vector<ScoredEnigmaKey>& lane : laneBest)
+			best.insert(best.end(), lane.begin(), lane.end());
+		std::sort(best.begin(), best.end(), [](const auto& l, const auto& r) {
+			return std::tie(l.plugboard.wiring, l.plugboard.outWiring) < std::tie(r.plugboard.wiring, r.plugboard.outWiring);
+		});
+		best.erase(std::unique(best.begin(),
+						   best.end(),
+						   [](const auto& l, const auto& r) { return l.plugboard == r.plugboard; }),
+				best.end());
+		std::sort(best.begin(), best.end(), [](const auto& l, const auto& r) { return l.score > r.score; });
+		if (best.size() > size_t(topK))
+			best.resize(topK);
+		return best;
+	}
+
+	// simulated annealing over the plugboard with add, remove and swap moves.
+	// Each round runs independent restarts in parallel, all sharing one scrambler trace,
+	// the search stops as soon as all restarts of a round agree on the plugboard.
+	template<class FitnessFunction>
+	static ScoredEnigmaKey findPlugsAnnealing(ScoredEnigmaKey key,
+			int8_t maxPlugs,
+			const char* ciphertext,
+			FitnessFunction f,
+			int restarts = 32,
+			int maxRounds = 8,
+			int steps = 20000)
+	{
+		ScramblerTrace trace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext);
+
+		ScoredEnigmaKey best = key;
+		best.score = -1e30f;
+		std::vector<ScoredEnigmaKey> results(restarts, key);
+		std::vector<int> ints(restarts);
+		std::iota(ints.begin(), ints.end(), 0);
+		for (int round = 0; round < maxRounds; ++round)
+		{
+			std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int restart) {
+				FastRandom gen(round * restarts + restart);
+				results[restart].plugboard = annealPlugs(trace, maxPlugs, f, gen, steps, results[restart].score);
+			});
+
+			for (const ScoredEnigmaKey& result : results)
+			{
+				if (result.score > best.score)
+					best = result;
+			}
+			const bool agreed = std::all_of(results.begin(), results.end(), [&](const ScoredEnigmaKey& result) {
+				return result.plugboard == results[0].plugboard;
+			});
+			if (agreed)
+				break;
+		}
+		return best;
+	}
+
+	template<class FitnessFunction>
+	static Plugboard annealPlugs(const ScramblerTrace& trace,
+			int8_t maxPlugs,
+			FitnessFunction& f,
+			FastRandom& gen,
+			int steps,
+			float& bestScore)
+	{
+		std::string result;
+		Plugboard current;
+		current.has_plugs = true;
+		trace.decrypt(current, result);
+		float currentScore = f.score(result);
+
+		// proposes a random neighbour of the board
+		auto propose = [&](const Plugboard& board, int plugs) {
+			Plugboard next = board;
+			const uint32_t move = gen.below(3);
+			if (plugs == 0 || (move == 0 && plugs < maxPlugs))
+			{
+				// add a plug between two free letters
+				int8_t a = gen.below(26);
+				while (next.plugged[a])
+					a = a == 25 ? 0 : a + 1;
+				int8_t b = gen.below(26);
+				while (next.plugged[b] || b == a)
+					b = b == 25 ? 0 : b + 1;
+				next.addPlug(a, b);
+				return next;
+			}
+
+			int8_t a = gen.below(26);
+			while (!next.plugged[a])
+				a = a == 25 ? 0 : a + 1;
+			const int8_t b = next.forward(a);
+			if (move == 1 || plugs == 1)
+			{
+				// move one end of the plug to any other letter, or remove it if that is its partner
+				int8_t c = gen.below(26);
+				next.removePlug(a);
+				if (c == a || c == b)
+					return next;
+				if (next.plugged[c])
+				{
+					// swap partners with the plug of c
+					const int8_t d = next.forward(c);
+					next.removePlug(c);
+					next.addPlug(a, c);
+					next.addPlug(b, d);
+					return next;
+				}
+				next.addPlug(a, c);
+				return next;
+			}
+
+			// remove the plug
+			next.removePlug(a);
+			return next;
+		};
+
+		auto countPlugs = [](const Plugboard& board) {
+			return std::count(board.plugged.begin(), board.plugged.end(), true) / 2;
+		};
+
+		// start temperature from the average change of random moves, cooling down to a thousandth of it
+		float averageDelta = 0.0f;
+		for (int i = 0; i < 100; ++i)
+		{
+			trace.decrypt(propose(current, 0), result);
+			averageDelta += std::abs(f.score(result) - currentScore);
+		}
+		const float startTemperature = averageDelta / 100.0f + 1e-10f;
+		const float cooling = std::pow(1e-3f, 1.0f / steps);
+
+		Plugboard best = current;
+		bestScore = currentScore;
+		int plugs = 0;
+		float temperature = startTemperature;
+		for (int step = 0; step < steps; ++step, temperature *= cooling)
+		{
+			Plugboard next = propose(current, plugs);
+			trace.decrypt(next, result);
+			const float score = f.score(result);
+			const float delta = score - currentScore;
+			if (delta >= 0 || gen.uniform() < std::exp(delta / temperature))
+			{
+				current = next;
+				currentScore = score;
+				plugs = countPlugs(current);
+				if (currentScore > bestScore)
+				{
+					bestScore = currentScore;
+					best = current;
+				}
+			}
+		}
+		return best;
+	}
+
+	// Ciphertext-only attack after Weierud and Sullivan on the best rotor configurations.
+	// Ring settings of the middle and right rotor (with compensated start positions) and the plugs
+	// are hill climbed together, the fitness escalates from IoC to bigrams to the final function
+	// each time the climb converges. The restarts of all candidates run in parallel and share the
+	// scrambler traces of the ring settings they visit.
+	template<class IoCFunction, class BigramFunction, class FinalFunction>
+	static ScoredEnigmaKey findKeyCiphertextOnly(const std::vector<ScoredEnigmaKey>& candidates,
+			int8_t maxPlugs,
+			const char* ciphertext,
+			IoCFunction ioc,
+			BigramFunction bigrams,
+			FinalFunction final,
+			int restarts = 4)
+	{
+		std::vector<ScramblerTraceCache> caches(candidates.size());
+		std::vector<ScoredEnigmaKey> results(candidates.size() * restarts);
+		std::vector<int> ints(results.size());
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int run) {
+			const int candidate = run / restarts;
+			const int restart = run % restarts;
+			ScramblerTraceCache& cache = caches[candidate];
+			ScoredEnigmaKey key = candidates[candidate];
+			if (restart > 0)
+			{
+				// the other restarts begin from a few random plugs
+				FastRandom gen(run);
+				key.plugboard = Plugboard(gen.below(maxPlugs / 2 + 1), gen);
+			}
+
+			key.score = -1e30f;
+			climbRings(key, cache, ciphertext, ioc);
+			climbPlugs(key, maxPlugs, *cache.get(key, ciphertext), ioc);
+
+			key.score = -1e30f;
+			climbPlugs(key, maxPlugs, *cache.get(key, ciphertext), bigrams);
+			climbRings(key, cache, ciphertext, bigrams);
+
+			key.score = -1e30f;
+			float previousScore;
+			do
+			{
+				previousScore = key.score;
+				climbPlugs(key, maxPlugs, *cache.get(key, ciphertext), final);
+				climbRings(key, cache, ciphertext, final);
+			} while (key.score > previousScore);
+			results[run] = key;
+		});
+
+		return *std::max_element(results.begin(), results.end(), [](const auto& l, const auto& r) {
+			return l.score < r.score;
+		});
+	}
+
+	// tries all ring settings of the middle and right rotor one rotor at a time,
+	// moving the start position along so only the turnover points change
+	template<class FitnessFunction>
+	static void climbRings(ScoredEnigmaKey& key, ScramblerTraceCache& cache, const char* ciphertext, FitnessFunction& f)
+	{
+		std::string result;
+		bool improved = true;
+		while (improved)
+		{
+			improved = false;
+			// the right ring decides most of the turnovers, so start there
+			for (int rotor = 2; rotor > 0; --rotor)
+			{
+				ScoredEnigmaKey candidate = key;
+				for (int8_t ring = 0; ring < 26; ++ring)
+				{
+					candidate.rings[rotor] = ring;
+					candidate.indicators[rotor] = (key.indicators[rotor] + 26 + ring - key.rings[rotor]) % 26;
+					cache.get(candidate, ciphertext)->decrypt(candidate.plugboard, result);
+					float fitness = f.score(result);
+					if (fitness > key.score)
+					{
+						candidate.score = fitness;
+						key = candidate;
+						improved = true;
+					}
+				}
+			}
+		}
+	}
+
+	// steepest ascent over all plugs between two letters, connecting them (and dropping their
+	// previous plugs) or disconnecting them if they are plugged together
+	template<class FitnessFunction>
+	static void climbPlugs(ScoredEnigmaKey& key, int8_t maxPlugs, const ScramblerTrace& trace, FitnessFunction& f)
+	{
+		std::string result;
+		key.plugboard.has_plugs = true;
+		trace.decrypt(key.plugboard, result);
+		key.score = f.score(result);
+
+		bool improved = true;
+		while (improved)
+		{
+			improved = false;
+			Plugboard bestBoard = key.plugboard;
+			for (int8_t i = 0; i < 26; ++i)
+			{
+				for (int8_t j = i + 1; j < 26; ++j)
+				{
+					Plugboard board = key.plugboard;
+					if (board.forward(i) == j)
+					{
+						board.removePlug(i);
+					}
+					else
+					{
+						if (board.plugged[i])
+							board.removePlug(i);
+						if (board.plugged[j])
+							board.removePlug(j);
+						if (std::count(board.plugged.begin(), board.plugged.end(), true) >= 2 * maxPlugs)
+							continue;
+						board.addPlug(i, j);
+					}
+
+					trace.decrypt(board, result);
+					float fitness = f.score(result);
+					if (fitness > key.score)
+					{
+						key.score = fitness;
+						bestBoard = board;
+						improved = true;
+					}
+				}
+			}
+			key.plugboard = bestBoard;
+		}
+	}
+
+	// hill climbs the pairs of the rewirable UKW-D with rotors, positions, rings and plugs fixed.
+	// Each candidate exchanges the partners of two pairs, which only touches four entries
+	// of the combined reflector instead of rebuilding the machine.
+	// The first climb starts from the wiring in the key, the other restarts from random wirings.
+	template<class FitnessFunction>
+	static ScoredEnigmaKey findReflectorWiring(ScoredEnigmaKey key, const char* ciphertext, FitnessFunction f, int restarts = 1)
+	{
+		if (key.reflector != 'D')
+		{
+			key.reflector = 'D';
+			key.ukwD = Reflector::Create('D');
+		}
+
+		std::vector<ScoredEnigmaKey> results(restarts, key);
+		std::vector<int> ints(restarts);
+		std::iota(ints.begin(), ints.end(), 0);
+		std::for_each(std::execution::par, ints.cbegin(), ints.cend(), [&](int restart) {
+			ScoredEnigmaKey& climbKey = results[restart];
+			if (restart > 0)
+			{
+				FastRandom gen(restart);
+				climbKey.ukwD = randomUkwD(gen);
+			}
+			climbReflectorWiring(climbKey, ciphertext, f);
+		});
+
+		return *std::max_element(results.begin(), results.end(), [](const auto& l, const auto& r) {
+			return l.score < r.score;
+		});
+	}
+
+	static Reflector randomUkwD(FastRandom& gen)
+	{
+		std::array<int8_t, 24> letters{};
+		int8_t n = 0;
+		for (int8_t c = 0; c < 26; ++c)
+		{
+			if (c != ukwDFixedFirst && c != ukwDFixedSecond)
+				letters[n++] = c;
+		}
+		for (size_t i = letters.size() - 1; i > 0; --i)
+			std::swap(letters[i], letters[gen.below(i + 1)]);
+		Reflector wiring = Reflector::Create('D');
+		for (int i = 0; i < 24; i += 2)
+			wiring.plug(letters[i], letters[i + 1]);
+		return wiring;
+	}
+
+	template<class FitnessFunction>
+	static void climbReflectorWiring(ScoredEnigmaKey& key, const char* ciphertext, FitnessFunction f)
+	{
+		// base always stays at the start positions, each candidate works on a copy
+		Enigma base = key.createEnigma();
+		Enigma initial = base;
+		std::string result = encryptString(initial, ciphertext);
+		key.score = f.score(result);
+
+		bool improved = true;
+		while (improved)
+		{
+			improved = false;
+			for (int8_t a = 0; a < 26; ++a)
+			{
+				for (int8_t c = a + 1; c < 26; ++c)
+				{
+					const int8_t b = key.ukwD.forward(a);
+					const int8_t d = key.ukwD.forward(c);
+					// every pair once, with the first letter as the smaller one
+					if (b < a || d < c || c == b || a == ukwDFixedFirst || a == ukwDFixedSecond || c == ukwDFixedFirst
+							|| c == ukwDFixedSecond)
+						continue;
+
+					// AB CD -> AC BD and AD BC
+					for (const std::array<int8_t, 4>& rewired :
+							{std::array<int8_t, 4>{a, c, b, d}, std::array<int8_t, 4>{a, d, b, c}})
+					{
+						Enigma e = base;
+						e.rewireReflector(rewired[0], rewired[1]);
+						e.rewireReflector(rewired[2], rewired[3]);
+						result = encryptString(e, ciphertext);
+						float fitness = f.score(result);
+						if (fitness > key.score)
+						{
+							key.score = fitness;
+							key.ukwD.plug(rewired[0], rewired[1]);
+							key.ukwD.plug(rewired[2], rewired[3]);
+							base.rewireReflector(rewired[0], rewired[1]);
+							base.rewireReflector(rewired[2], rewired[3]);
+							improved = true;
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// tries all 40 dial positions of the Uhr with the cables as given,
+	// the rotors are fixed so all positions share one scrambler trace
+	template<class FitnessFunction>
+	static ScoredEnigmaKey findUhrSetting(ScoredEnigmaKey key, const Uhr& uhr, const char* ciphertext, FitnessFunction f)
+	{
+		ScramblerTrace trace(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext);
+		std::string result;
+		key.score = -1e30f;
+		for (int8_t dial = 0; dial < Uhr::dialPositions; ++dial)
+		{
+			Plugboard board = uhr.createPlugboard(dial);
+			trace.decrypt(board, result);
+			float fitness = f.score(result);
+			if (fitness > key.score)
+			{
+				key.score = fitness;
+				key.plugboard = board;
+				key.uhrPosition = dial;
+			}
+		}
+		return key;
+	}
 };
 
 #endif
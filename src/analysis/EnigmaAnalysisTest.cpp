@@ -0,0 +1,22 @@
+#include <analysis/EnigmaAnalysis.h>
+#include <analysis/fitness/QuadgramFitness.h>
+#include <enigma/Enigma.h>
+#include <gtest/gtest.h>
+
+TEST(Analysis, FindReflectorWiringRecoversUkwD)
+{
+	// 100 letters under a rewired UKW-D, everything but the wiring is known
+	const std::string plaintext = "IPROPOSETOCONSIDERTHEQUESTIONCANMACHINESTHINKTHISSHOULDBEGINWITHDEFINITIONSOFTHEMEANINGOFTHETERMSMAC";
+	const Reflector wiring{{"AQ", "BW", "CE", "DR", "FT", "GZ", "HU", "IO", "JY", "KP", "LS", "MX", "NV"}};
+	Enigma e({2, 5, 3}, 'D', {7, 4, 19}, {12, 2, 20}, {"AF", "TV"});
+	e.setReflector(wiring);
+	const std::string ciphertext = encryptString(e, plaintext.c_str());
+
+	const ScoredEnigmaKey key({2, 5, 3}, 'D', {7, 4, 19}, {12, 2, 20}, Plugboard{{"AF", "TV"}});
+	const ScoredEnigmaKey found = EnigmaAnalysis::findReflectorWiring(key, ciphertext.c_str(), QuadgramFitness{}, 16);
+	for (int8_t c = 0; c < 26; ++c)
+		EXPECT_EQ(wiring.forward(c), found.ukwD.forward(c)) << indexToChar(c);
+
+	Enigma decrypt = found.createEnigma();
+	EXPECT_EQ(plaintext, encryptString(decrypt, ciphertext.c_str()));
+}
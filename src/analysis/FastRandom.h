@@ -0,0 +1,55 @@
+#ifndef ANALYSIS_FASTRANDOM_H
+#define ANALYSIS_FASTRANDOM_H
+
+#include <cstdint>
+#include <limits>
+
+// xoshiro128** generator, small enough to give every search thread its own one.
+// Satisfies UniformRandomBitGenerator, so it also works with the std distributions.
+class FastRandom
+{
+	uint32_t s[4];
+
+	static constexpr uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+public:
+	using result_type = uint32_t;
+
+	explicit constexpr FastRandom(uint64_t seed) : s{}
+	{
+		// splitmix64 to spread the seed over the state
+		for (int i = 0; i < 4; i += 2)
+		{
+			uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			z = z ^ (z >> 31);
+			s[i] = uint32_t(z);
+			s[i + 1] = uint32_t(z >> 32);
+		}
+	}
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+	constexpr result_type operator()()
+	{
+		const uint32_t result = rotl(s[1] * 5, 7) * 9;
+		const uint32_t t = s[1] << 9;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 11);
+		return result;
+	}
+
+	// in [0, n) without a modulo
+	constexpr uint32_t below(uint32_t n) { return uint32_t((uint64_t((*this)()) * n) >> 32); }
+
+	// in [0, 1)
+	constexpr float uniform() { return ((*this)() >> 8) * (1.0f / 16777216.0f); }
+};
+
+#endif
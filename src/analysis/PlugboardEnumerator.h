@@ -0,0 +1,134 @@
+#ifndef ANALYSIS_PLUGBOARDENUMERATOR_H
+#define ANALYSIS_PLUGBOARDENUMERATOR_H
+
+#include <analysis/ScramblerTrace.h>
+#include <enigma/Plugboard.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+// Walks all plugboards with exactly k plugs. The plugs are numbered by their letter pairs and
+// every board is visited once with its plugs in increasing order. The innermost plug moves
+// fastest, so consecutive boards almost always differ in one plug only and a state that is told
+// about every added and removed plug can rescore each board incrementally.
+// The boards are sharded by their first plug, so the shards can run on separate threads.
+class PlugboardEnumerator
+{
+	std::array<std::pair<int8_t, int8_t>, 26 * 25 / 2> pairs;
+	int8_t plugs;
+
+	// the state needs addPlug(a, b) and removePlug(a, b), the visitor is called
+	// with the board and the state for every complete board
+	template<class State, class Visitor>
+	void walk(int depth, int first, Plugboard& board, State& state, Visitor& visit) const
+	{
+		for (int p = first; p < int(pairs.size()); ++p)
+		{
+			const auto [a, b] = pairs[p];
+			if (board.plugged[a] || board.plugged[b])
+				continue;
+
+			board.addPlug(a, b);
+			state.addPlug(a, b);
+			if (depth + 1 == plugs)
+				visit(static_cast<const Plugboard&>(board), static_cast<const State&>(state));
+			else
+				walk(depth + 1, p + 1, board, state, visit);
+			board.removePlug(a);
+			state.removePlug(a, b);
+		}
+	}
+
+public:
+	explicit PlugboardEnumerator(int8_t plugs) : plugs(plugs)
+	{
+		if (plugs < 1 || plugs > 4)
+			throw "only boards with 1 to 4 plugs can be enumerated";
+
+		int p = 0;
+		for (int8_t a = 0; a < 26; ++a)
+		{
+			for (int8_t b = a + 1; b < 26; ++b)
+				pairs[p++] = {a, b};
+		}
+	}
+
+	int shards() const { return pairs.size(); }
+
+	// visits all boards whose first plug is the pair with number shard
+	template<class State, class Visitor>
+	void enumerate(int shard, State& state, Visitor visit) const
+	{
+		Plugboard board;
+		board.has_plugs = true;
+		const auto [a, b] = pairs[shard];
+		board.addPlug(a, b);
+		state.addPlug(a, b);
+		if (plugs == 1)
+			visit(static_cast<const Plugboard&>(board), static_cast<const State&>(state));
+		else
+			walk(1, shard + 1, board, state, visit);
+		state.removePlug(a, b);
+	}
+};
+
+// Index of coincidence of the decryption of a scrambler trace, updated plug by plug.
+// The plaintext histogram is a permutation of the histogram of the scrambler outputs by the
+// plugboard, which leaves the IoC alone. So only the plugs on the way in matter, and swapping
+// the input of one ciphertext letter moves a precomputed histogram, whatever the message length.
+class IncrementalIoC
+{
+	// outputs[x][u]: histogram of the scrambler outputs for input u over all positions with ciphertext x
+	std::array<std::array<std::array<int, 26>, 26>, 26> outputs{};
+	std::array<int, 26> histogram{};
+	std::array<int8_t, 26> wiring;
+	int n;
+
+	void connect(int8_t x, int8_t u)
+	{
+		for (int8_t y = 0; y < 26; ++y)
+			histogram[y] += outputs[x][u][y] - outputs[x][wiring[x]][y];
+		wiring[x] = u;
+	}
+
+public:
+	explicit IncrementalIoC(const ScramblerTrace& trace) : n(trace.size())
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			const int8_t x = trace.cipher(i);
+			for (int8_t u = 0; u < 26; ++u)
+				outputs[x][u][trace.scramble(i, u)]++;
+		}
+		for (int8_t x = 0; x < 26; ++x)
+		{
+			wiring[x] = x;
+			for (int8_t y = 0; y < 26; ++y)
+				histogram[y] += outputs[x][x][y];
+		}
+	}
+
+	void addPlug(int8_t a, int8_t b)
+	{
+		connect(a, b);
+		connect(b, a);
+	}
+
+	void removePlug(int8_t a, int8_t b)
+	{
+		connect(a, a);
+		connect(b, b);
+	}
+
+	// the same value as IoCFitness on the decryption
+	float score() const
+	{
+		int total = 0;
+		for (int v : histogram)
+			total += v * (v - 1);
+		return float(total) / (n * (n - 1));
+	}
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include <analysis/PlugboardEnumerator.h>
+#include <analysis/fitness/IoCFitness.h>
+#include <gtest/gtest.h>
+
+TEST(Analysis, IncrementalIoCMatchesFullIoC)
+{
+	Enigma e({2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, {"AF", "TV", "KO"});
+	const std::string ciphertext = encryptString(e, "THISISAMESSAGEWITHENOUGHLETTERSTOGIVEEVERYPLUGBOARDITSOWNINDEXOFCOINCIDENCE");
+	const ScramblerTrace trace(Enigma({2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, {}), ciphertext.c_str());
+
+	// walks a few shards with two and three plugs, every board rescored from the previous one
+	IoCFitness ioc;
+	for (int8_t plugs : {2, 3})
+	{
+		const PlugboardEnumerator enumerator(plugs);
+		IncrementalIoC state(trace);
+		int boards = 0;
+		for (int shard : {0, 100, 200})
+		{
+			enumerator.enumerate(shard, state, [&](const Plugboard& board, const IncrementalIoC& incremental) {
+				if (++boards % 97 != 0)
+					return;
+				EXPECT_FLOAT_EQ(ioc.score(trace.decrypt(board)), incremental.score()) << board.ToString();
+			});
+		}
+		EXPECT_GT(boards, 97);
+	}
+}
+
+TEST(Analysis, IncrementalIoCWithoutPlugs)
+{
+	Enigma e({1, 2, 3}, 'B', {0, 0, 0}, {0, 0, 0}, {});
+	const std::string ciphertext = encryptString(e, "ANOTHERSHORTMESSAGE");
+	const ScramblerTrace trace(Enigma({1, 2, 3}, 'B', {0, 0, 0}, {0, 0, 0}, {}), ciphertext.c_str());
+	const IncrementalIoC state(trace);
+	EXPECT_FLOAT_EQ(IoCFitness{}.score(trace.decrypt(Plugboard{})), state.score());
+}
@@ -0,0 +1,114 @@
+#ifndef ANALYSIS_PREFIXBOUND_H
+#define ANALYSIS_PREFIXBOUND_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Decides at checkpoints along a decryption whether the whole of it can still beat a threshold.
+// At each checkpoint the score of the full text is estimated as scale * score so far, which covers
+// both the scores that grow with the length (n-gram sums) and those that don't (IoC). A candidate
+// is dropped as soon as even the estimate plus margin stays below the threshold.
+// Both are calibrated on sample candidates: scale is the ratio of the mean scores, margin the
+// quantile of full - scale * score so far that only a share of the samples exceeds. The shares of
+// all checkpoints add up to falseNegativeRate, so a candidate that ends up above the threshold is
+// dropped with about that probability.
+// The threshold is the score a candidate has to beat to get into the top keep keys of the search.
+// Exact checkpoints ask accumulators with bound(remaining) instead, e.g. that of IoCFitness,
+// and drop only candidates that can't beat the threshold at all.
+struct PrefixBound
+{
+	struct Checkpoint
+	{
+		// letters scored before the decision
+		int length;
+		float scale;
+		float margin;
+		bool exact{false};
+
+		bool rejects(float score, float threshold) const { return score * scale + margin < threshold; }
+	};
+
+	// in increasing length, none scores every candidate in full
+	std::vector<Checkpoint> checkpoints;
+	// the number of best keys the bound protects, those below may be lost
+	int keep{10};
+
+	// the bound of accumulators is only tight towards the end, e.g. 16 letters before it for the IoC
+	void addExactCheckpoints(std::initializer_list<int> lengths)
+	{
+		for (int length : lengths)
+			checkpoints.push_back({length, 1, 0, true});
+		std::stable_sort(checkpoints.begin(), checkpoints.end(), [](const Checkpoint& l, const Checkpoint& r) {
+			return l.length < r.length;
+		});
+	}
+
+	// samples[s][c] is the score of sample s at checkpoint c, its last entry the full score
+	static PrefixBound calibrate(const std::vector<int>& lengths,
+			const std::vector<std::vector<float>>& samples,
+			float falseNegativeRate)
+	{
+		PrefixBound bound;
+		if (samples.empty() || lengths.empty() || falseNegativeRate <= 0)
+			return bound;
+
+		const float share = falseNegativeRate / lengths.size();
+		const size_t q = std::min(samples.size() - 1, size_t((1 - share) * samples.size()));
+		std::vector<float> residuals(samples.size());
+		for (size_t c = 0; c < lengths.size(); ++c)
+		{
+			double prefixSum = 0;
+			double fullSum = 0;
+			for (const std::vector<float>& sample : samples)
+			{
+				prefixSum += sample[c];
+				fullSum += sample.back();
+			}
+			// a prefix that scores nothing on average (e.g. a crib behind it) says nothing
+			if (std::abs(prefixSum) < 1e-9 * std::max(1.0, std::abs(fullSum)))
+				continue;
+
+			Checkpoint checkpoint{lengths[c], float(fullSum / prefixSum), 0};
+			for (size_t s = 0; s < samples.size(); ++s)
+				residuals[s] = samples[s].back() - checkpoint.scale * samples[s][c];
+			std::nth_element(residuals.begin(), residuals.begin() + q, residuals.end());
+			checkpoint.margin = residuals[q];
+			bound.checkpoints.push_back(checkpoint);
+		}
+		return bound;
+	}
+};
+
+// The keep best scores of a parallel search, the lowest of them is the threshold for all threads.
+// Each thread publishes the scores of its best keys as it finishes.
+class TopScores
+{
+	int keep;
+	std::mutex mutex;
+	std::vector<float> scores;
+	std::atomic<float> lowest{std::numeric_limits<float>::lowest()};
+
+public:
+	explicit TopScores(int keep) : keep(keep) {}
+
+	float threshold() const { return lowest.load(std::memory_order_relaxed); }
+
+	void publish(float score)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		scores.insert(std::upper_bound(scores.begin(), scores.end(), score, std::greater<float>()), score);
+		if (scores.size() > size_t(keep))
+			scores.pop_back();
+		if (scores.size() == size_t(keep))
+			lowest.store(scores.back(), std::memory_order_relaxed);
+	}
+};
+
+#endif
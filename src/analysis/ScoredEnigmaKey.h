@@ -2,15 +2,25 @@
 #define ANALYSIS_SCOREDENIGMAKEY_H
 
 #include <array>
+#include <enigma/Enigma.h>
 #include <enigma/Plugboard.h>
 
 class ScoredEnigmaKey
 {
 public:
 	std::array<int8_t, 3> rotors{0, 0, 0};
+	char reflector{'B'};
+	// wiring of the rewirable reflector if reflector is 'D'
+	Reflector ukwD{Reflector::Create('D')};
 	std::array<int8_t, 3> indicators{0, 0, 0};
 	std::array<int8_t, 3> rings{0, 0, 0};
 	Plugboard plugboard;
+	// greek wheel of the naval M4, 0 for the three rotor machines
+	int8_t greekRotor{0};
+	int8_t greekIndicator{0};
+	int8_t greekRing{0};
+	// dial of the Uhr if the plugboard was created from one, -1 otherwise
+	int8_t uhrPosition{-1};
 	float score{1e-10};
 
 	constexpr ScoredEnigmaKey() = default;
@@ -20,6 +30,30 @@ public:
 			Plugboard plugboardConnections)
 		: rotors(rotors), indicators(indicators), rings(rings), plugboard(plugboardConnections)
 	{}
+	constexpr ScoredEnigmaKey(std::array<int8_t, 3> rotors,
+			char reflector,
+			std::array<int8_t, 3> indicators,
+			std::array<int8_t, 3> rings,
+			Plugboard plugboardConnections)
+		: rotors(rotors), reflector(reflector), indicators(indicators), rings(rings), plugboard(plugboardConnections)
+	{}
+
+	Enigma createEnigma() const { return createEnigma(indicators, rings, plugboard); }
+
+	Enigma createEnigma(std::array<int8_t, 3> currentIndicators,
+			std::array<int8_t, 3> currentRings,
+			const Plugboard& currentPlugboard) const
+	{
+		Enigma e = greekRotor == 0 ? Enigma(rotors, reflector, currentIndicators, currentRings, currentPlugboard)
+									: Enigma::CreateM4({greekRotor, rotors[0], rotors[1], rotors[2]},
+											  reflector,
+											  {greekIndicator, currentIndicators[0], currentIndicators[1], currentIndicators[2]},
+											  {greekRing, currentRings[0], currentRings[1], currentRings[2]},
+											  currentPlugboard);
+		if (reflector == 'D')
+			e.setReflector(ukwD);
+		return e;
+	}
 };
 
 #endif
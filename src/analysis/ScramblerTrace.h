@@ -0,0 +1,118 @@
+#ifndef ANALYSIS_SCRAMBLERTRACE_H
+#define ANALYSIS_SCRAMBLERTRACE_H
+
+#include <analysis/ScoredEnigmaKey.h>
+#include <enigma/Enigma.h>
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Records the mapping of rotors and reflector between plugboard in and out for every position
+// of a message. As the plugboard is the only part left, decrypting under any plugboard
+// costs three lookups per character and no rotor stepping at all.
+class ScramblerTrace
+{
+	std::vector<int8_t> ciphertext;
+	std::vector<std::array<int8_t, 26>> scrambler;
+
+public:
+	// the plugboard of the machine is ignored
+	template<class SteppingPolicy>
+	ScramblerTrace(BasicEnigma<SteppingPolicy> e, const char* text)
+	{
+		const int sz = std::strlen(text);
+		ciphertext.resize(sz);
+		scrambler.resize(sz);
+		for (int i = 0; i < sz; ++i)
+		{
+			ciphertext[i] = charToIndex(text[i]);
+			e.rotate();
+			for (int8_t c = 0; c < 26; ++c)
+				scrambler[i][c] = e.scramble(c) % 26;
+		}
+	}
+
+	int size() const { return ciphertext.size(); }
+
+	int8_t cipher(int i) const { return ciphertext[i]; }
+
+	// maps a letter at position i, all values are in [0, 26)
+	int8_t scramble(int i, int8_t c) const { return scrambler[i][c]; }
+
+	int8_t decrypt(int i, const Plugboard& plugboard) const
+	{
+		return plugboard.backward(scrambler[i][plugboard.forward(ciphertext[i])]);
+	}
+
+	void decrypt(const Plugboard& plugboard, std::string& out) const
+	{
+		out.resize(ciphertext.size());
+		for (size_t i = 0; i < ciphertext.size(); ++i)
+			out[i] = indexToChar(decrypt(i, plugboard));
+	}
+
+	std::string decrypt(const Plugboard& plugboard) const
+	{
+		std::string out;
+		decrypt(plugboard, out);
+		return out;
+	}
+};
+
+// Shares the traces of the same machine settings between several searches, e.g. the restarts
+// of a hill climb that keep coming back to the same ring settings.
+// Holds at most capacity traces and starts over once it is full, traces still in use stay alive.
+class ScramblerTraceCache
+{
+	// rotors, reflector, start positions, rings, greek wheel, Uhr and the wiring of the UKW-D
+	using Settings = std::array<int8_t, 14 + 26>;
+
+	size_t capacity;
+	std::mutex mutex;
+	std::map<Settings, std::shared_ptr<const ScramblerTrace>> traces;
+
+public:
+	explicit ScramblerTraceCache(size_t capacity = 1024) : capacity(capacity) {}
+
+	std::shared_ptr<const ScramblerTrace> get(const ScoredEnigmaKey& key, const char* ciphertext)
+	{
+		Settings settings{key.rotors[0],
+				key.rotors[1],
+				key.rotors[2],
+				int8_t(key.reflector),
+				key.indicators[0],
+				key.indicators[1],
+				key.indicators[2],
+				key.rings[0],
+				key.rings[1],
+				key.rings[2],
+				key.greekRotor,
+				key.greekIndicator,
+				key.greekRing,
+				key.uhrPosition};
+		if (key.reflector == 'D')
+		{
+			for (int8_t c = 0; c < 26; ++c)
+				settings[14 + c] = key.ukwD.forward(c);
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = traces.find(settings);
+			if (it != traces.end())
+				return it->second;
+		}
+
+		// build outside the lock, if two threads race for the same settings one trace is dropped
+		auto trace = std::make_shared<const ScramblerTrace>(key.createEnigma(key.indicators, key.rings, Plugboard{}), ciphertext);
+		std::lock_guard<std::mutex> lock(mutex);
+		if (traces.size() >= capacity)
+			traces.clear();
+		return traces.emplace(settings, std::move(trace)).first->second;
+	}
+};
+
+#endif
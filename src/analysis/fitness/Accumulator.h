@@ -0,0 +1,34 @@
+#ifndef ANALYSIS_ACCUMULATOR_H
+#define ANALYSIS_ACCUMULATOR_H
+
+#include <type_traits>
+#include <utility>
+
+// Fitness functions that can score a text letter by letter offer accumulator(), which returns
+// an object with add(int8_t letter) for letters in [0, 52) and score(). The search loops feed
+// the encryption straight into it instead of writing the text out first and scoring it after.
+template<class F, class = void>
+struct HasAccumulator : std::false_type
+{};
+
+template<class F>
+struct HasAccumulator<F, std::void_t<decltype(std::declval<const F&>().accumulator())>> : std::true_type
+{};
+
+template<class F>
+constexpr bool hasAccumulator = HasAccumulator<F>::value;
+
+// Accumulators that know how far their score can still rise offer bound(int remaining), the
+// highest score the text can reach with remaining more letters, whatever they are.
+template<class A, class = void>
+struct HasUpperBound : std::false_type
+{};
+
+template<class A>
+struct HasUpperBound<A, std::void_t<decltype(std::declval<const A&>().bound(0))>> : std::true_type
+{};
+
+template<class A>
+constexpr bool hasUpperBound = HasUpperBound<A>::value;
+
+#endif
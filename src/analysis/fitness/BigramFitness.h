@@ -4,9 +4,24 @@
 #include <data/bigrams.h>
 #include <string>
 
+// the bigram table widened to the 52 letter landing pad of the engines,
+// so their letters index it directly without a modulo
+constexpr std::array<float, 52 * 52> makeBigramLandingPad()
+{
+	std::array<float, 52 * 52> table{};
+	for (int i = 0; i < 52; ++i)
+	{
+		for (int j = 0; j < 52; ++j)
+			table[i * 52 + j] = bigram_scores.scoreBigram(i, j);
+	}
+	return table;
+}
+
 struct BigramFitness
 {
-	float score(const std::string& text)
+	static constexpr std::array<float, 52 * 52> landingPad = makeBigramLandingPad();
+
+	float score(const std::string& text) const
 	{
 		float fitness = 0;
 		int current = 0;
@@ -19,20 +34,61 @@ struct BigramFitness
 		}
 		return fitness;
 	}
-	template<int T>
-	float score(const std::array<int8_t, T>& text)
+	template<size_t T>
+	float score(const std::array<int8_t, T>& text) const
 	{
 		float fitness = 0;
-		int current = 0;
-		int next = text[0] % 26;
-		for (int i = 1; i < text.size(); i++)
+		for (size_t i = 1; i < T; i++)
 		{
-			current = next;
-			next = text[i] % 26;
-			fitness += bigram_scores.scoreBigram(current, next);
+			fitness += landingPad[text[i - 1] * 52 + text[i]];
 		}
 		return fitness;
 	}
+
+	// running form of the int8 score for the fused encrypt and score loops
+	struct Accumulator
+	{
+		int8_t previous{-1};
+		float fitness{0};
+
+		constexpr void add(int8_t c)
+		{
+			if (previous >= 0)
+				fitness += landingPad[previous * 52 + c];
+			previous = c;
+		}
+
+		constexpr float score() const { return fitness; }
+	};
+
+	Accumulator accumulator() const { return {}; }
+
+	// scores N decryptions at once, laid out letter by letter: texts[i][n] is letter i of decryption n.
+	// The loop over the decryptions turns into gathers from the table, the scores are the same
+	// as those of the single decryptions.
+	template<size_t T, size_t N>
+	void score(const std::array<std::array<int8_t, N>, T>& texts, std::array<float, N>& scores) const
+	{
+		scores.fill(0.0f);
+		for (size_t i = 1; i < T; i++)
+		{
+			const std::array<int8_t, N>& previous = texts[i - 1];
+			const std::array<int8_t, N>& current = texts[i];
+			for (size_t n = 0; n < N; n++)
+				scores[n] += landingPad[previous[n] * 52 + current[n]];
+		}
+	}
+
+	// lays out N decryptions letter by letter for the batched score
+	template<size_t T, size_t N>
+	static constexpr void transpose(const std::array<std::array<int8_t, T>, N>& texts, std::array<std::array<int8_t, N>, T>& out)
+	{
+		for (size_t n = 0; n < N; n++)
+		{
+			for (size_t i = 0; i < T; i++)
+				out[i][n] = texts[n][i];
+		}
+	}
 };
 
 #endif
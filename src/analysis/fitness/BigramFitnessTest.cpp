@@ -0,0 +1,35 @@
+#include <analysis/FastRandom.h>
+#include <analysis/fitness/BigramFitness.h>
+#include <enigma/Rotor.h>
+#include <gtest/gtest.h>
+
+#include <array>
+
+TEST(Fitness, BigramBatchedMatchesScore)
+{
+	constexpr size_t T = 61;
+	constexpr size_t N = 16;
+	FastRandom gen(11);
+	std::array<std::array<int8_t, T>, N> texts;
+	for (std::array<int8_t, T>& text : texts)
+	{
+		for (int8_t& c : text)
+			c = gen.below(52);
+	}
+	std::array<std::array<int8_t, N>, T> columns;
+	BigramFitness::transpose(texts, columns);
+	for (size_t i = 0; i < T; ++i)
+		EXPECT_EQ(texts[5][i], columns[i][5]) << i;
+
+	const BigramFitness bigrams;
+	std::array<float, N> scores;
+	bigrams.score(columns, scores);
+	for (size_t n = 0; n < N; ++n)
+	{
+		std::string letters;
+		for (int8_t c : texts[n])
+			letters += indexToChar(c);
+		EXPECT_FLOAT_EQ(bigrams.score(texts[n]), scores[n]) << n;
+		EXPECT_NEAR(bigrams.score(letters), scores[n], 1e-3f) << n;
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef ANALYSIS_FITNESSCASCADE_H
+#define ANALYSIS_FITNESSCASCADE_H
+
+#include <algorithm>
+#include <array>
+#include <execution>
+#include <tuple>
+#include <vector>
+
+// Fitness functions from cheap to expensive, e.g. IoC, bigrams, quadgrams. A search scores every
+// candidate with the first tier only and keeps the best survivors[0] of them, promote() rescores
+// those with the second tier, keeps the best survivors[1] for the third tier and so on.
+// So the expensive tiers see thousands of candidates instead of millions.
+//   FitnessCascade cascade({2000, 100}, IoCFitness{}, BigramFitness{}, QuadgramFitness{});
+template<class... Tiers>
+class FitnessCascade
+{
+	static_assert(sizeof...(Tiers) > 1, "a cascade needs two fitness functions or more");
+	static constexpr size_t tierCount = sizeof...(Tiers);
+
+	std::tuple<Tiers...> tiers;
+	std::array<int, tierCount - 1> survivors;
+
+	template<size_t tier, class Candidate, class Decrypt>
+	void promoteFrom(std::vector<Candidate>& candidates, Decrypt& decrypt) const
+	{
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& l, const Candidate& r) {
+			return l.score > r.score;
+		});
+		if constexpr (tier < tierCount)
+		{
+			if (candidates.size() > size_t(survivors[tier - 1]))
+				candidates.resize(survivors[tier - 1]);
+			std::for_each(std::execution::par, candidates.begin(), candidates.end(), [&](Candidate& candidate) {
+				candidate.score = std::get<tier>(tiers).score(decrypt(candidate));
+			});
+			promoteFrom<tier + 1>(candidates, decrypt);
+		}
+	}
+
+public:
+	FitnessCascade(std::array<int, tierCount - 1> survivors, Tiers... tiers) : tiers(tiers...), survivors(survivors) {}
+
+	// the tier every candidate of a search is scored with
+	const auto& first() const { return std::get<0>(tiers); }
+
+	// how many candidates of the first tier the search has to keep
+	int kept() const { return survivors[0]; }
+
+	// candidates (anything with a score member) come scored by the first tier and leave ranked by
+	// the last one, decrypt(candidate) returns the text the further tiers score
+	template<class Candidate, class Decrypt>
+	void promote(std::vector<Candidate>& candidates, Decrypt decrypt) const
+	{
+		promoteFrom<1>(candidates, decrypt);
+	}
+};
+
+#endif
@@ -2,6 +2,8 @@
 #define ANALYSIS_IOCFITNESS_H
 
 #include <enigma/Rotor.h>
+
+#include <algorithm>
 #include <string>
 
 struct IoCFitness
@@ -18,36 +20,128 @@ struct IoCFitness
 		}
 
 		int n = text.size();
-		float total = 0.0f;
+		int total = 0;
 
 		for (int v : histogram)
 		{
 			total += (v * (v - 1));
 		}
 
-		return total / (n * (n - 1));
+		return fromCoincidences(total, n);
 	}
 
 	template<class T>
 	float score(const T& text) const
 	{
-		std::array<int, 26 + 26> histogram{0};
+		return fromCoincidences(coincidences(text), text.size());
+	}
 
-		for (int c : text)
+	// sum of v(v-1) over the letter counts, the numerator of the IoC. For texts of the same length
+	// it orders them like the IoC, without the float division.
+	// Consecutive letters count into four separate histograms, so a repeated letter doesn't wait
+	// for the store of the previous one.
+	template<class T>
+	int coincidences(const T& text) const
+	{
+		std::array<std::array<int, 26 + 26>, 4> banks{};
+		const size_t sz = text.size();
+		size_t i = 0;
+		for (; i + 4 <= sz; i += 4)
 		{
-			histogram[c]++;
+			banks[0][text[i]]++;
+			banks[1][text[i + 1]]++;
+			banks[2][text[i + 2]]++;
+			banks[3][text[i + 3]]++;
 		}
+		for (; i < sz; ++i)
+			banks[0][text[i]]++;
 
-		int n = text.size();
-		float total = 0.0f;
+		int total = 0;
+		for (size_t c = 0; c < 26; ++c)
+		{
+			const int v = banks[0][c] + banks[1][c] + banks[2][c] + banks[3][c] + banks[0][c + 26] + banks[1][c + 26]
+						  + banks[2][c + 26] + banks[3][c + 26];
+			total += v * (v - 1);
+		}
+		return total;
+	}
 
-		for (size_t i = 0; i < 26; ++i)
+	// running form of the int8 score for the fused encrypt and score loops
+	struct Accumulator
+	{
+		std::array<int, 26 + 26> histogram{};
+
+		constexpr void add(int8_t c) { histogram[c]++; }
+
+		float score() const
 		{
-			int v = histogram[i] + histogram[i + 26];
-			total += (v * (v - 1));
+			std::array<int, 26> folded;
+			for (size_t c = 0; c < 26; ++c)
+				folded[c] = histogram[c] + histogram[c + 26];
+			return scoreHistogram(folded);
+		}
+
+		// v(v-1) grows fastest on the largest count, so the IoC is highest if all the remaining
+		// letters are the most frequent one so far
+		float bound(int remaining) const
+		{
+			int n = remaining;
+			int total = 0;
+			int largest = 0;
+			for (size_t c = 0; c < 26; ++c)
+			{
+				const int v = histogram[c] + histogram[c + 26];
+				n += v;
+				total += v * (v - 1);
+				largest = std::max(largest, v);
+			}
+			const int v = largest + remaining;
+			total += v * (v - 1) - largest * (largest - 1);
+			return fromCoincidences(total, n);
 		}
+	};
 
-		return total / (n * (n - 1));
+	Accumulator accumulator() const { return {}; }
+
+	// the IoC of any text with these letter counts
+	static float scoreHistogram(const std::array<int, 26>& histogram)
+	{
+		int n = 0;
+		int total = 0;
+		for (int v : histogram)
+		{
+			n += v;
+			total += v * (v - 1);
+		}
+		return fromCoincidences(total, n);
+	}
+
+	// the IoC of n letters with total coincidences, 0 for fewer than two letters
+	static float fromCoincidences(int total, int n) { return n < 2 ? 0.0f : float(total) / (n * (n - 1)); }
+
+	// scores N decryptions at once, laid out letter by letter: texts[i][n] is letter i of decryption n.
+	// Every decryption has its own histogram, so the counts of neighbouring letters never depend
+	// on each other.
+	template<size_t T, size_t N>
+	void score(const std::array<std::array<int8_t, N>, T>& texts, std::array<float, N>& scores) const
+	{
+		std::array<std::array<int, 26 + 26>, N> histograms{};
+		for (size_t i = 0; i < T; ++i)
+		{
+			for (size_t n = 0; n < N; ++n)
+				histograms[n][texts[i][n]]++;
+		}
+
+		for (size_t n = 0; n < N; ++n)
+		{
+			int total = 0;
+			for (size_t c = 0; c < 26; ++c)
+			{
+				const int v = histograms[n][c] + histograms[n][c + 26];
+				total += v * (v - 1);
+			}
+			scores[n] = fromCoincidences(total, T);
+		}
 	}
 };
 
@@ -0,0 +1,62 @@
+#include <analysis/FastRandom.h>
+#include <analysis/fitness/BigramFitness.h>
+#include <analysis/fitness/IoCFitness.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+TEST(Fitness, IoCOfOneLetterPrefix)
+{
+	// a prefix bound checkpoint after the first letter scores a single letter
+	const IoCFitness ioc;
+	IoCFitness::Accumulator accumulator = ioc.accumulator();
+	EXPECT_FLOAT_EQ(0, accumulator.score());
+	accumulator.add(charToIndex('E') + 26);
+	EXPECT_FLOAT_EQ(0, accumulator.score());
+	EXPECT_FLOAT_EQ(1, accumulator.bound(1));
+	EXPECT_FALSE(std::isnan(accumulator.bound(0)));
+
+	EXPECT_FLOAT_EQ(0, ioc.score(std::string("E")));
+	EXPECT_FLOAT_EQ(0, ioc.score(std::array<int8_t, 1>{4}));
+	EXPECT_FLOAT_EQ(0, IoCFitness::scoreHistogram({}));
+
+	accumulator.add(charToIndex('E'));
+	EXPECT_FLOAT_EQ(1, accumulator.score());
+}
+
+TEST(Fitness, IoCBatchedAndCoincidencesMatchScore)
+{
+	constexpr size_t T = 97;
+	constexpr size_t N = 16;
+	FastRandom gen(7);
+	std::array<std::array<int8_t, T>, N> texts;
+	for (std::array<int8_t, T>& text : texts)
+	{
+		// few letters, so some texts coincide a lot
+		const uint32_t letters = 2 + gen.below(25);
+		for (int8_t& c : text)
+			c = gen.below(letters) + (gen.below(2) ? 26 : 0);
+	}
+	std::array<std::array<int8_t, N>, T> columns;
+	BigramFitness::transpose(texts, columns);
+
+	const IoCFitness ioc;
+	std::array<float, N> scores;
+	ioc.score(columns, scores);
+	for (size_t n = 0; n < N; ++n)
+	{
+		std::string letters;
+		for (int8_t c : texts[n])
+			letters += indexToChar(c);
+		const float single = ioc.score(letters);
+		EXPECT_FLOAT_EQ(single, ioc.score(texts[n])) << n;
+		EXPECT_FLOAT_EQ(single, scores[n]) << n;
+		EXPECT_FLOAT_EQ(single, float(ioc.coincidences(texts[n])) / (T * (T - 1))) << n;
+
+		IoCFitness::Accumulator accumulator = ioc.accumulator();
+		for (int8_t c : texts[n])
+			accumulator.add(c);
+		EXPECT_FLOAT_EQ(single, accumulator.score()) << n;
+	}
+}
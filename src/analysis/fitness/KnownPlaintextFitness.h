@@ -1,27 +1,139 @@
 #ifndef ANALYSIS_KNOWNPLAINTEXTFITNESS_H
 #define ANALYSIS_KNOWNPLAINTEXTFITNESS_H
 
+#include <analysis/CribPlacement.h>
+#include <enigma/Rotor.h>
+
 #include <algorithm>
+#include <cstdint>
 #include <string>
+#include <type_traits>
+#include <vector>
 
+// Counts the characters of a decryption that match the known plaintext. Several cribs at different
+// offsets are merged into one window over the text, every character of a crib outside of A-Z
+// (e.g. '?') is a wildcard that never counts.
 class KnownPlaintextFitness
 {
-	std::string plaintext;
+	static constexpr int blockSize = 64;
 
-public:
-	KnownPlaintextFitness(const std::string& p) : plaintext(p) {}
+	// position of the window in the text
+	int begin{0};
+	// expected letters of the window and whether they are known at all
+	std::vector<int8_t> expected;
+	std::vector<uint8_t> known;
+	// known letters from the start of each block to the end of the window
+	std::vector<int> remainingKnown;
 
-	float score(const std::string& text) const
+	void init(const std::vector<CribPlacement>& placements)
+	{
+		if (placements.empty())
+			return;
+
+		begin = placements[0].offset;
+		int end = begin;
+		for (const CribPlacement& placement : placements)
+		{
+			begin = std::min(begin, placement.offset);
+			end = std::max(end, placement.offset + int(placement.crib.size()));
+		}
+
+		expected.assign(end - begin, 0);
+		known.assign(end - begin, 0);
+		for (const CribPlacement& placement : placements)
+		{
+			for (size_t i = 0; i < placement.crib.size(); ++i)
+			{
+				const char c = placement.crib[i];
+				if (c < 'A' || c > 'Z')
+					continue;
+				expected[placement.offset - begin + i] = charToIndex(c);
+				known[placement.offset - begin + i] = 1;
+			}
+		}
+
+		const int blocks = (expected.size() + blockSize - 1) / blockSize;
+		remainingKnown.assign(blocks + 1, 0);
+		for (int block = blocks - 1; block >= 0; --block)
+		{
+			const int from = block * blockSize;
+			const int to = std::min<int>(expected.size(), from + blockSize);
+			remainingKnown[block] = remainingKnown[block + 1] + std::count(known.begin() + from, known.begin() + to, 1);
+		}
+	}
+
+	// branch free, so the compiler can vectorize the compares and the sum.
+	// Values of the int8 path may come off the landing pad, so both copies of a letter match.
+	template<class T>
+	int matches(const T& text, int from, int to) const
 	{
-		int length = std::min(plaintext.size(), text.size());
 		int total = 0;
-		for (int i = 0; i < length; i++)
+		for (int i = from; i < to; ++i)
+		{
+			int8_t c;
+			if constexpr (std::is_same_v<T, std::string>)
+				c = charToIndex(text[begin + i]);
+			else
+				c = text[begin + i];
+			const int8_t e = expected[i];
+			total += known[i] & ((c == e) | (c == e + 26));
+		}
+		return total;
+	}
+
+	template<class T>
+	int windowLength(const T& text) const
+	{
+		return std::clamp(int(text.size()) - begin, 0, int(expected.size()));
+	}
+
+public:
+	KnownPlaintextFitness(const std::string& p, int offset = 0) { init({{p, offset}}); }
+	KnownPlaintextFitness(const CribPlacement& placement) { init({placement}); }
+	KnownPlaintextFitness(const std::vector<CribPlacement>& placements) { init(placements); }
+
+	// takes decryptions as strings or as the letters in [0, 52) of the fixed size engines
+	template<class T>
+	float score(const T& text) const
+	{
+		return matches(text, 0, windowLength(text));
+	}
+
+	// running form of the int8 score for the fused encrypt and score loops
+	struct Accumulator
+	{
+		const KnownPlaintextFitness* fitness;
+		int position{0};
+		int total{0};
+
+		void add(int8_t c)
 		{
-			if (plaintext[i] > 0)
+			const int i = position++ - fitness->begin;
+			if (i >= 0 && i < int(fitness->expected.size()))
 			{
-				total += plaintext[i] == text[i] ? 1 : 0;
+				const int8_t e = fitness->expected[i];
+				total += fitness->known[i] & ((c == e) | (c == e + 26));
 			}
 		}
+
+		float score() const { return total; }
+	};
+
+	Accumulator accumulator() const { return {this}; }
+
+	// stops counting as soon as the known letters left can't lift the score above best,
+	// the result is then an upper bound of the score that is not above best
+	template<class T>
+	float score(const T& text, float best) const
+	{
+		const int length = windowLength(text);
+		int total = 0;
+		for (int block = 0, from = 0; from < length; ++block, from += blockSize)
+		{
+			if (total + remainingKnown[block] <= best)
+				return total + remainingKnown[block];
+			total += matches(text, from, std::min(length, from + blockSize));
+		}
 		return total;
 	}
 };
@@ -0,0 +1,51 @@
+#include <analysis/fitness/KnownPlaintextFitness.h>
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace
+{
+const std::string plaintext = "IPROPOSETOCONSIDERTHEQUESTIONCANMACHINESTHINKTHISSHOULDBEGINWITHDEFINITIONSOFTHEMEANINGOFTHETERMSMACHINEANDTHINK";
+}
+
+TEST(Fitness, KnownPlaintextBoundedScoreWithoutEarlyExit)
+{
+	// spans two blocks of the early exit, the text differs from the crib in a few letters
+	const KnownPlaintextFitness kpt(plaintext.substr(5, 90), 5);
+	std::string text = plaintext;
+	for (size_t i : {7, 30, 64, 70, 94})
+		text[i] = text[i] == 'X' ? 'Y' : 'X';
+
+	const float full = kpt.score(text);
+	EXPECT_FLOAT_EQ(85, full);
+	for (float best : {-1.0f, 0.0f, 50.0f, 84.0f})
+		EXPECT_FLOAT_EQ(full, kpt.score(text, best)) << best;
+
+	std::array<int8_t, 110> letters;
+	for (size_t i = 0; i < letters.size(); ++i)
+		letters[i] = charToIndex(text[i]) + (i % 2 ? 26 : 0);
+	EXPECT_FLOAT_EQ(full, kpt.score(letters));
+	EXPECT_FLOAT_EQ(full, kpt.score(letters, 50.0f));
+}
+
+TEST(Fitness, KnownPlaintextBoundedScoreEarlyExit)
+{
+	const KnownPlaintextFitness kpt(plaintext.substr(0, 100));
+	std::string text(plaintext.size(), 'A');
+
+	// once the known letters left can't beat best, the result is an upper bound not above it
+	const float full = kpt.score(text);
+	const float bounded = kpt.score(text, 90.0f);
+	EXPECT_LE(full, bounded);
+	EXPECT_LE(bounded, 90.0f);
+}
+
+TEST(Fitness, KnownPlaintextWildcards)
+{
+	const KnownPlaintextFitness kpt(std::vector<CribPlacement>{{"WET?ER", 2}, {"KLAR", 20}});
+	std::string text(30, 'Q');
+	text.replace(2, 6, "WETTER");
+	EXPECT_FLOAT_EQ(5, kpt.score(text));
+	text.replace(20, 4, "KLAR");
+	EXPECT_FLOAT_EQ(9, kpt.score(text));
+}
@@ -0,0 +1,52 @@
+#ifndef ANALYSIS_NGRAMFITNESS_H
+#define ANALYSIS_NGRAMFITNESS_H
+
+#include <analysis/fitness/NgramModel.h>
+#include <enigma/Rotor.h>
+
+#include <string>
+#include <type_traits>
+
+// log likelihood of a text under a binary n-gram model of any order. The index of the n-gram
+// rolls along the text and the quantized steps are summed up as integers.
+class NgramFitness
+{
+	const NgramModel& model;
+
+public:
+	explicit NgramFitness(const NgramModel& model) : model(model) {}
+
+	// takes decryptions as strings or as the letters in [0, 52) of the fixed size engines
+	template<class T>
+	float score(const T& text) const
+	{
+		auto letter = [&](size_t i) -> int {
+			if constexpr (std::is_same_v<T, std::string>)
+				return charToIndex(text[i]);
+			else
+				return text[i] % 26;
+		};
+
+		const int order = model.order();
+		if (text.size() < size_t(order))
+			return 0.0f;
+
+		const int16_t* table = model.table();
+		const int leading = NgramModel::tableSize(order - 1);
+		int index = 0;
+		for (int i = 0; i < order - 1; ++i)
+			index = index * 26 + letter(i);
+
+		int64_t total = 0;
+		for (size_t i = order - 1; i < text.size(); ++i)
+		{
+			index = index * 26 + letter(i);
+			total += table[index];
+			index -= letter(i + 1 - order) * leading;
+		}
+		const size_t count = text.size() - order + 1;
+		return total / model.scale() + count * model.floor();
+	}
+};
+
+#endif
@@ -0,0 +1,41 @@
+#include <analysis/fitness/NgramFitness.h>
+#include <analysis/fitness/QuadgramFitness.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+
+TEST(Fitness, NgramModelMatchesQuadgrams)
+{
+	// the compiled quadgrams written as a model, both quantize the same log probabilities
+	std::vector<float> logProbabilities(NgramModel::tableSize(4), quadgram_scores.floor);
+	for (const Quadgram& q : quadgram_list)
+		logProbabilities[(((q.bg[0] - 'A') * 26 + q.bg[1] - 'A') * 26 + q.bg[2] - 'A') * 26 + q.bg[3] - 'A'] = q.score;
+	const std::string path = testing::TempDir() + "4grams.bin";
+	NgramModel::write(path, 4, logProbabilities);
+
+	{
+		const NgramModel model(path);
+		EXPECT_EQ(4, model.order());
+		EXPECT_FLOAT_EQ(quadgram_scores.floor, model.floor());
+
+		const NgramFitness ngrams(model);
+		const QuadgramFitness quadgrams;
+		const std::string text = "IPROPOSETOCONSIDERTHEQUESTIONCANMACHINESTHINKQXZJVKWQPZTHISSHOULDBEGINWITHDEFINITIONS";
+		std::array<int8_t, 85> letters;
+		for (size_t i = 0; i < letters.size(); ++i)
+			letters[i] = charToIndex(text[i]) + (i % 3 ? 0 : 26);
+
+		EXPECT_NEAR(quadgrams.score(text), ngrams.score(text), 0.01f);
+		EXPECT_NEAR(quadgrams.score(letters), ngrams.score(letters), 0.01f);
+		EXPECT_FLOAT_EQ(ngrams.score(text), ngrams.score(letters));
+		EXPECT_FLOAT_EQ(0, ngrams.score(std::string("ABC")));
+	}
+	std::remove(path.c_str());
+}
+
+TEST(Fitness, NgramModelRejectsWrongSize)
+{
+	EXPECT_ANY_THROW(NgramModel::write(testing::TempDir() + "3grams.bin", 3, std::vector<float>(26 * 26)));
+	EXPECT_ANY_THROW(NgramModel(testing::TempDir() + "missing.bin"));
+}
@@ -0,0 +1,141 @@
+#ifndef ANALYSIS_NGRAMMODEL_H
+#define ANALYSIS_NGRAMMODEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Binary n-gram model: a header followed by the dense table of all 26^order n-grams, each stored
+// as the int16 steps of 1/scale above the floor of the model. The file is mapped read only and
+// used in place, so opening it costs nothing, the pages are only read when they are scored and
+// all processes using the same model share them through the page cache.
+struct NgramModelHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t order;
+	float floor;
+	float scale;
+};
+
+class NgramModel
+{
+	static constexpr char magic[8] = {'E', 'N', 'I', 'G', 'N', 'G', 'R', 'M'};
+	static constexpr uint32_t version = 1;
+
+	void* mapping{nullptr};
+	size_t length{0};
+	const NgramModelHeader* header{nullptr};
+	const int16_t* entries{nullptr};
+
+public:
+	static constexpr int maxOrder = 5;
+
+	static constexpr int tableSize(int order)
+	{
+		int size = 1;
+		for (int i = 0; i < order; ++i)
+			size *= 26;
+		return size;
+	}
+
+	explicit NgramModel(const std::string& path)
+	{
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			throw "can't open n-gram model";
+		struct stat info;
+		if (::fstat(fd, &info) != 0)
+		{
+			::close(fd);
+			throw "can't open n-gram model";
+		}
+		length = info.st_size;
+		mapping = length >= sizeof(NgramModelHeader) ? ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+		::close(fd);
+		if (mapping == MAP_FAILED)
+			throw "can't map n-gram model";
+
+		header = static_cast<const NgramModelHeader*>(mapping);
+		entries = reinterpret_cast<const int16_t*>(header + 1);
+		if (std::memcmp(header->magic, magic, sizeof(magic)) != 0 || header->version != version
+				|| header->order < 1 || header->order > maxOrder
+				|| length != sizeof(NgramModelHeader) + tableSize(header->order) * sizeof(int16_t))
+		{
+			::munmap(mapping, length);
+			throw "not an n-gram model";
+		}
+	}
+
+	NgramModel(const NgramModel&) = delete;
+	NgramModel& operator=(const NgramModel&) = delete;
+
+	~NgramModel() { ::munmap(mapping, length); }
+
+	int order() const { return header->order; }
+	float floor() const { return header->floor; }
+	float scale() const { return header->scale; }
+	const int16_t* table() const { return entries; }
+
+	// quantizes the log probabilities of all 26^order n-grams, index ((a * 26 + b) * 26 + c)...
+	static void write(const std::string& path, int order, const std::vector<float>& logProbabilities)
+	{
+		if (order < 1 || order > maxOrder || logProbabilities.size() != size_t(tableSize(order)))
+			throw "wrong n-gram table size";
+
+		const auto [low, high] = std::minmax_element(logProbabilities.begin(), logProbabilities.end());
+		NgramModelHeader h{};
+		std::memcpy(h.magic, magic, sizeof(magic));
+		h.version = version;
+		h.order = order;
+		h.floor = *low;
+		h.scale = *high > *low ? 32767.0f / (*high - *low) : 1.0f;
+
+		std::vector<int16_t> quantized(logProbabilities.size());
+		for (size_t i = 0; i < quantized.size(); ++i)
+			quantized[i] = int16_t(std::min(32767.0f, (logProbabilities[i] - h.floor) * h.scale + 0.5f));
+
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+		out.write(reinterpret_cast<const char*>(quantized.data()), quantized.size() * sizeof(int16_t));
+		if (!out)
+			throw "can't write n-gram model";
+	}
+};
+
+// The models of one language in a directory, named 1grams.bin up to 5grams.bin.
+// A model is only mapped the first time it is asked for.
+class NgramModels
+{
+	std::string directory;
+	std::array<std::unique_ptr<NgramModel>, NgramModel::maxOrder + 1> models;
+	std::array<std::once_flag, NgramModel::maxOrder + 1> loaded;
+
+public:
+	explicit NgramModels(const std::string& directory) : directory(directory) {}
+
+	static std::string fileName(int order) { return std::to_string(order) + "grams.bin"; }
+
+	const NgramModel& get(int order)
+	{
+		if (order < 1 || order > NgramModel::maxOrder)
+			throw "no n-gram model of that order";
+		std::call_once(loaded[order], [&] {
+			models[order] = std::make_unique<NgramModel>(directory + "/" + fileName(order));
+		});
+		return *models[order];
+	}
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define ANALYSIS_QUADGRAMFITNESS_H
 
 #include <data/quadgrams.h>
+#include <string>
 
 struct QuadgramFitness
 {
@@ -12,7 +13,7 @@ struct QuadgramFitness
 		int next1 = text[0] - 65;
 		int next2 = text[1] - 65;
 		int next3 = text[2] - 65;
-		for (int i = 3; i < text.size(); i++)
+		for (size_t i = 3; i < text.size(); i++)
 		{
 			current = next1;
 			next1 = next2;
@@ -22,6 +23,24 @@ struct QuadgramFitness
 		}
 		return fitness;
 	}
+
+	// the index of the quadgram rolls along the text and the steps above the floor are summed up
+	// as integers
+	template<size_t T>
+	float score(const std::array<int8_t, T>& text) const
+	{
+		static_assert(T >= 4, "a quadgram needs four letters");
+		constexpr int letters3 = 26 * 26 * 26;
+		int index = ((text[0] % 26) * 26 + text[1] % 26) * 26 + text[2] % 26;
+		int total = 0;
+		for (size_t i = 3; i < T; i++)
+		{
+			index = index * 26 + text[i] % 26;
+			total += quadgram_scores.quantized[index];
+			index -= (text[i - 3] % 26) * letters3;
+		}
+		return total * (1.0f / QuadgramContainer::quantizedScale) + (T - 3) * quadgram_scores.floor;
+	}
 };
 
 #endif
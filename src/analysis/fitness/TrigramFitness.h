@@ -0,0 +1,42 @@
+#ifndef ANALYSIS_TRIGRAMFITNESS_H
+#define ANALYSIS_TRIGRAMFITNESS_H
+
+#include <data/trigrams.h>
+#include <string>
+
+// between bigrams and quadgrams, the table of 70KB still fits into L2
+struct TrigramFitness
+{
+	float score(const std::string& text) const
+	{
+		float fitness = 0;
+		int current = 0;
+		int next1 = text[0] - 65;
+		int next2 = text[1] - 65;
+		for (size_t i = 2; i < text.size(); i++)
+		{
+			current = next1;
+			next1 = next2;
+			next2 = text[i] - 65;
+			fitness += trigram_scores.score(current, next1, next2);
+		}
+		return fitness;
+	}
+
+	template<size_t T>
+	float score(const std::array<int8_t, T>& text) const
+	{
+		constexpr int letters2 = 26 * 26;
+		int index = (text[0] % 26) * 26 + text[1] % 26;
+		float fitness = 0;
+		for (size_t i = 2; i < T; i++)
+		{
+			index = index * 26 + text[i] % 26;
+			fitness += trigram_scores.trigrams[index];
+			index -= (text[i - 2] % 26) * letters2;
+		}
+		return fitness;
+	}
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef ANALYSIS_UNIGRAMFITNESS_H
+#define ANALYSIS_UNIGRAMFITNESS_H
+
+#include <data/unigrams.h>
+#include <enigma/Rotor.h>
+
+#include <array>
+#include <string>
+
+// Sinkov's statistic, the log likelihood of the letter frequencies. As cheap as the IoC,
+// but unlike the IoC it knows which letters should be frequent, not only how uneven they are.
+struct UnigramFitness
+{
+	float score(const std::string& text) const
+	{
+		std::array<int, 26> histogram{0};
+		for (char c : text)
+		{
+			histogram[charToIndex(c)]++;
+		}
+		return scoreHistogram(histogram);
+	}
+
+	template<class T>
+	float score(const T& text) const
+	{
+		std::array<int, 26 + 26> histogram{0};
+		for (int c : text)
+		{
+			histogram[c]++;
+		}
+
+		std::array<int, 26> folded;
+		for (size_t i = 0; i < 26; ++i)
+			folded[i] = histogram[i] + histogram[i + 26];
+		return scoreHistogram(folded);
+	}
+
+	// running form of the int8 score for the fused encrypt and score loops
+	struct Accumulator
+	{
+		std::array<int, 26 + 26> histogram{};
+
+		constexpr void add(int8_t c) { histogram[c]++; }
+
+		float score() const
+		{
+			std::array<int, 26> folded;
+			for (size_t i = 0; i < 26; ++i)
+				folded[i] = histogram[i] + histogram[i + 26];
+			return scoreHistogram(folded);
+		}
+	};
+
+	Accumulator accumulator() const { return {}; }
+
+	// the statistic of any text with these letter counts
+	static float scoreHistogram(const std::array<int, 26>& histogram)
+	{
+		float total = 0.0f;
+		for (size_t i = 0; i < 26; ++i)
+			total += histogram[i] * unigram_scores.unigrams[i];
+		return total;
+	}
+};
+
+#endif
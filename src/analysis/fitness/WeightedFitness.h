@@ -0,0 +1,163 @@
+#ifndef ANALYSIS_WEIGHTEDFITNESS_H
+#define ANALYSIS_WEIGHTEDFITNESS_H
+
+#include <analysis/fitness/Accumulator.h>
+#include <enigma/Rotor.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Fitness functions whose score only depends on the letter counts offer
+// static scoreHistogram(const std::array<int, 26>&), like the IoC and the unigrams.
+template<class F, class = void>
+struct HasHistogramScore : std::false_type
+{};
+
+template<class F>
+struct HasHistogramScore<F, std::void_t<decltype(F::scoreHistogram(std::declval<const std::array<int, 26>&>()))>>
+	: std::true_type
+{};
+
+template<class F>
+constexpr bool hasHistogramScore = HasHistogramScore<F>::value;
+
+template<class F>
+struct WeightedTerm
+{
+	float weight;
+	F fitness;
+};
+
+// A weighted sum of fitness functions, itself a fitness function for every search:
+//   auto f = weighted(0.7f, IoCFitness{}) + weighted(0.3f, UnigramFitness{});
+// The int8 score walks the text once for all terms with an accumulator and the terms that score
+// the letter counts share one histogram, the other terms score the text on their own.
+// The sum has an accumulator if all of its terms have one.
+template<class... Terms>
+class WeightedSum
+{
+	std::tuple<WeightedTerm<Terms>...> terms;
+
+	static constexpr bool anyHistogram = (hasHistogramScore<Terms> || ...);
+	static constexpr bool allAccumulate = ((hasHistogramScore<Terms> || hasAccumulator<Terms>) && ...);
+
+	// what each term keeps while the letters come in, nothing beyond the shared histogram for some
+	struct Nothing
+	{
+		constexpr void add(int8_t) {}
+	};
+
+	template<class F>
+	static auto termAccumulator(const F& f)
+	{
+		if constexpr (hasHistogramScore<F>)
+			return Nothing{};
+		else if constexpr (hasAccumulator<F>)
+			return f.accumulator();
+		else
+			return Nothing{};
+	}
+
+	using Accumulators = std::tuple<decltype(termAccumulator(std::declval<const Terms&>()))...>;
+
+	template<class T, size_t... I>
+	float scoreText(const T& text, std::index_sequence<I...>) const
+	{
+		std::array<int, 26 + 26> histogram{};
+		Accumulators accumulators{termAccumulator(std::get<I>(terms).fitness)...};
+		for (int8_t c : text)
+		{
+			if constexpr (anyHistogram)
+				histogram[c]++;
+			(std::get<I>(accumulators).add(c), ...);
+		}
+		return sum(histogram, accumulators, &text, std::index_sequence<I...>{});
+	}
+
+	// with text null, every term has to have an accumulator
+	template<class T, size_t... I>
+	float sum(const std::array<int, 26 + 26>& histogram,
+			const Accumulators& accumulators,
+			const T* text,
+			std::index_sequence<I...>) const
+	{
+		std::array<int, 26> folded{};
+		if constexpr (anyHistogram)
+		{
+			for (size_t c = 0; c < 26; ++c)
+				folded[c] = histogram[c] + histogram[c + 26];
+		}
+
+		auto term = [&](const auto& t, const auto& accumulator) {
+			using F = std::decay_t<decltype(t.fitness)>;
+			if constexpr (hasHistogramScore<F>)
+				return t.weight * F::scoreHistogram(folded);
+			else if constexpr (hasAccumulator<F>)
+				return t.weight * accumulator.score();
+			else
+				return t.weight * t.fitness.score(*text);
+		};
+		return (term(std::get<I>(terms), std::get<I>(accumulators)) + ...);
+	}
+
+public:
+	constexpr WeightedSum(WeightedTerm<Terms>... terms) : terms(terms...) {}
+
+	template<class... Others>
+	friend constexpr WeightedSum<Terms..., Others...> operator+(const WeightedSum& l, const WeightedSum<Others...>& r)
+	{
+		return std::apply([&](const auto&... all) { return WeightedSum<Terms..., Others...>(all...); },
+				std::tuple_cat(l.terms, r.parts()));
+	}
+
+	const std::tuple<WeightedTerm<Terms>...>& parts() const { return terms; }
+
+	float score(const std::string& text) const
+	{
+		return std::apply([&](const auto&... t) { return ((t.weight * t.fitness.score(text)) + ...); }, terms);
+	}
+
+	// the letters in [0, 52) of the fixed size engines
+	template<class T>
+	float score(const T& text) const
+	{
+		return scoreText(text, std::index_sequence_for<Terms...>{});
+	}
+
+	struct Accumulator
+	{
+		const WeightedSum* fitness;
+		std::array<int, 26 + 26> histogram{};
+		Accumulators accumulators;
+
+		void add(int8_t c)
+		{
+			if constexpr (anyHistogram)
+				histogram[c]++;
+			std::apply([c](auto&... a) { (a.add(c), ...); }, accumulators);
+		}
+
+		float score() const
+		{
+			return fitness->sum(histogram, accumulators, static_cast<const std::string*>(nullptr), std::index_sequence_for<Terms...>{});
+		}
+	};
+
+	template<bool B = allAccumulate, std::enable_if_t<B, int> = 0>
+	Accumulator accumulator() const
+	{
+		return std::apply([this](const auto&... t) { return Accumulator{this, {}, {termAccumulator(t.fitness)...}}; }, terms);
+	}
+};
+
+template<class F>
+constexpr WeightedSum<F> weighted(float weight, F fitness)
+{
+	return WeightedSum<F>(WeightedTerm<F>{weight, fitness});
+}
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef ANALYSIS_WORDFITNESS_H
+#define ANALYSIS_WORDFITNESS_H
+
+#include <data/words.h>
+#include <enigma/Rotor.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Counts the letters of a decryption that are covered by dictionary words. Once most plugs are
+// right the n-gram scores barely change, but every right plug turns a few more words readable.
+// The words are compiled into an Aho-Corasick automaton with all failure links resolved, a flat
+// table of int16 transitions that finds all words ending at a letter with a single lookup.
+class WordFitness
+{
+	// transitions[state * 26 + letter]
+	std::vector<int16_t> transitions;
+	// length of the longest word ending in each state, 0 if none does
+	std::vector<uint8_t> longest;
+
+	void compile(const std::vector<std::string>& words)
+	{
+		// the trie, -1 where it has no edge
+		transitions.assign(26, -1);
+		longest.assign(1, 0);
+		for (const std::string& word : words)
+		{
+			if (word.empty() || word.size() > std::numeric_limits<uint8_t>::max())
+				throw "words have to be 1 to 255 letters long";
+			int state = 0;
+			for (char c : word)
+			{
+				if (c < 'A' || c > 'Z')
+					throw "words may only have the letters A-Z";
+				const int edge = state * 26 + charToIndex(c);
+				if (transitions[edge] < 0)
+				{
+					if (longest.size() > std::numeric_limits<int16_t>::max())
+						throw "too many words for 16 bit transitions";
+					transitions[edge] = longest.size();
+					longest.push_back(0);
+					transitions.resize(transitions.size() + 26, -1);
+				}
+				state = transitions[edge];
+			}
+			longest[state] = std::max<uint8_t>(longest[state], word.size());
+		}
+
+		// breadth first, so the failure state of a state is done before it. Missing edges take
+		// the transition of the failure state, which turns the trie into a DFA.
+		std::vector<int16_t> failure(longest.size(), 0);
+		std::queue<int16_t> queue;
+		for (int c = 0; c < 26; ++c)
+		{
+			int16_t& next = transitions[c];
+			if (next < 0)
+				next = 0;
+			else
+				queue.push(next);
+		}
+		while (!queue.empty())
+		{
+			const int16_t state = queue.front();
+			queue.pop();
+			longest[state] = std::max(longest[state], longest[failure[state]]);
+			for (int c = 0; c < 26; ++c)
+			{
+				int16_t& next = transitions[state * 26 + c];
+				const int16_t fallback = transitions[failure[state] * 26 + c];
+				if (next < 0)
+				{
+					next = fallback;
+				}
+				else
+				{
+					failure[next] = fallback;
+					queue.push(next);
+				}
+			}
+		}
+	}
+
+public:
+	WordFitness() : WordFitness(std::vector<std::string>(std::begin(word_list), std::end(word_list))) {}
+	explicit WordFitness(const std::vector<std::string>& words) { compile(words); }
+
+	// running form of the score, also used by the fused encrypt and score loops
+	struct Accumulator
+	{
+		const WordFitness* fitness;
+		int16_t state{0};
+		int position{0};
+		// which of the last 256 letters are covered, bit position % 256. A word may start before
+		// the words found so far and the gaps between them, but never more than 255 letters back.
+		std::array<uint64_t, 4> window{};
+		int covered{0};
+
+		void add(int8_t c)
+		{
+			state = fitness->transitions[state * 26 + (c >= 26 ? c - 26 : c)];
+			uncover();
+			for (int i = position - fitness->longest[state] + 1; i <= position; ++i)
+			{
+				const uint64_t bit = 1ull << (i & 63);
+				uint64_t& word = window[(i >> 6) & 3];
+				covered += (word & bit) == 0;
+				word |= bit;
+			}
+			++position;
+		}
+
+		// a character that is no letter, no word runs across it
+		void skip()
+		{
+			state = 0;
+			uncover();
+			++position;
+		}
+
+		float score() const { return covered; }
+
+	private:
+		// the current position takes the place of the one 256 letters back
+		void uncover() { window[(position >> 6) & 3] &= ~(1ull << (position & 63)); }
+	};
+
+	Accumulator accumulator() const { return {this}; }
+
+	// takes decryptions as strings or as the letters in [0, 52) of the fixed size engines.
+	// Characters of a string outside of A-Z (e.g. '?' or a space) end any word.
+	template<class T>
+	float score(const T& text) const
+	{
+		Accumulator a = accumulator();
+		for (auto c : text)
+		{
+			if constexpr (std::is_same_v<T, std::string>)
+			{
+				if (c < 'A' || c > 'Z')
+					a.skip();
+				else
+					a.add(charToIndex(c));
+			}
+			else
+			{
+				a.add(c);
+			}
+		}
+		return a.score();
+	}
+
+	// states of the automaton, each of them takes 26 transitions
+	int states() const { return longest.size(); }
+};
+
+#endif
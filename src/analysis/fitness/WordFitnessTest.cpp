@@ -0,0 +1,50 @@
+#include <analysis/fitness/WordFitness.h>
+#include <gtest/gtest.h>
+
+#include <array>
+
+TEST(Fitness, WordsOverlap)
+{
+	// EINE and NEN overlap in EINEN, the shared letters count once
+	const WordFitness words({"EINE", "NEN"});
+	EXPECT_FLOAT_EQ(5, words.score(std::string("EINEN")));
+	EXPECT_FLOAT_EQ(5, words.score(std::string("XXEINENXX")));
+	EXPECT_FLOAT_EQ(4, words.score(std::string("EINEX")));
+
+	// EINEN itself as well, as the words ending at each letter are all found
+	const WordFitness nested({"EINEN", "EINE", "NEN", "IN"});
+	EXPECT_FLOAT_EQ(5, nested.score(std::string("EINEN")));
+	EXPECT_FLOAT_EQ(7, nested.score(std::string("EINENEN")));
+}
+
+TEST(Fitness, WordsNone)
+{
+	const WordFitness words;
+	EXPECT_FLOAT_EQ(0, words.score(std::string("QXJZQXJZVQK")));
+	EXPECT_FLOAT_EQ(0, words.score(std::string()));
+	EXPECT_LT(0, words.score(std::string("WETTERVORHERSAGEFUERHEUTE")));
+}
+
+TEST(Fitness, WordsEndAtNonLetters)
+{
+	const WordFitness words({"EINE", "NEN"});
+	EXPECT_FLOAT_EQ(0, words.score(std::string("EI NE")));
+	EXPECT_FLOAT_EQ(7, words.score(std::string("EINE?NEN")));
+	EXPECT_FLOAT_EQ(0, words.score(std::string("eine")));
+}
+
+TEST(Fitness, WordsOnLettersOffTheLandingPad)
+{
+	const WordFitness words;
+	const std::string text = "KRKRANOKMFLOTTEKURSNORDWESTSTOP";
+	std::array<int8_t, 31> letters;
+	for (size_t i = 0; i < letters.size(); ++i)
+		letters[i] = charToIndex(text[i]) + (i % 2 ? 26 : 0);
+	EXPECT_FLOAT_EQ(words.score(text), words.score(letters));
+}
+
+TEST(Fitness, WordsOnlyUppercaseLetters)
+{
+	EXPECT_ANY_THROW(WordFitness({"EIN", "ZW0"}));
+	EXPECT_ANY_THROW(WordFitness({""}));
+}
@@ -4,13 +4,16 @@
 #include <enigma/Plugboard.h>
 #include <enigma/Reflector.h>
 #include <enigma/Rotor.h>
+#include <enigma/Stepping.h>
 
 #include <cstring>
 
-class Enigma
+template<class SteppingPolicy>
+class BasicEnigma
 {
 	// 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25
 	// A B C D E F G H I J K  L  M  N  O  P  Q  R  S  T  U  V  W  X  Y  Z
+	Rotor greekRotor;
 	Rotor leftRotor;
 	Rotor middleRotor;
 	Rotor rightRotor;
@@ -18,15 +21,68 @@ class Enigma
 	Plugboard plugboard;
 
 	// as the left rotor nearly never turns, lets cache the rotor -> plugboard -> rotor
+	// the greek wheel of the M4 never turns at all, so it is folded in here as well
 	Reflector leftRotorPlusReflector;
 
+	// the accumulator of encryptInto that writes the letters out
+	template<size_t sz>
+	struct Store
+	{
+		std::array<int8_t, sz>* out;
+		size_t position;
+
+		constexpr void add(int8_t c) { (*out)[position++] = c; }
+	};
+
 public:
-	Enigma(std::array<int8_t, 3> rotors,
+	BasicEnigma(std::array<int8_t, 3> rotors,
+			char reflectorId,
+			std::array<int8_t, 3> rotorPositions,
+			std::array<int8_t, 3> ringSettings,
+			const Plugboard& plugboardConnections)
+		: BasicEnigma(Rotor::Create(0, 0, 0), rotors, reflectorId, rotorPositions, ringSettings, plugboardConnections)
+	{}
+
+	// machines built from custom rotors, e.g. multi-notch rotors together with OdometerStepping
+	BasicEnigma(const Rotor& left,
+			const Rotor& middle,
+			const Rotor& right,
+			const Reflector& reflectorWiring,
+			const Plugboard& plugboardConnections)
+		: greekRotor(Rotor::Create(0, 0, 0))
+		, leftRotor(left)
+		, middleRotor(middle)
+		, rightRotor(right)
+		, reflector(reflectorWiring)
+		, plugboard(plugboardConnections)
+		, leftRotorPlusReflector(createCombinedReflector())
+	{}
+
+	// naval M4, the first rotor is the greek wheel (9 = Beta, 10 = Gamma)
+	// and is used with the thin reflectors 'b' and 'c'
+	static BasicEnigma CreateM4(std::array<int8_t, 4> rotors,
+			char reflectorId,
+			std::array<int8_t, 4> rotorPositions,
+			std::array<int8_t, 4> ringSettings,
+			const Plugboard& plugboardConnections)
+	{
+		return BasicEnigma(Rotor::Create(rotors[0], rotorPositions[0], ringSettings[0]),
+				{rotors[1], rotors[2], rotors[3]},
+				reflectorId,
+				{rotorPositions[1], rotorPositions[2], rotorPositions[3]},
+				{ringSettings[1], ringSettings[2], ringSettings[3]},
+				plugboardConnections);
+	}
+
+private:
+	BasicEnigma(const Rotor& greek,
+			std::array<int8_t, 3> rotors,
 			char reflectorId,
 			std::array<int8_t, 3> rotorPositions,
 			std::array<int8_t, 3> ringSettings,
 			const Plugboard& plugboardConnections)
-		: leftRotor(Rotor::Create(rotors[0], rotorPositions[0], ringSettings[0]))
+		: greekRotor(greek)
+		, leftRotor(Rotor::Create(rotors[0], rotorPositions[0], ringSettings[0]))
 		, middleRotor(Rotor::Create(rotors[1], rotorPositions[1], ringSettings[1]))
 		, rightRotor(Rotor::Create(rotors[2], rotorPositions[2], ringSettings[2]))
 		, reflector(Reflector::Create(reflectorId))
@@ -34,14 +90,19 @@ public:
 		, leftRotorPlusReflector(createCombinedReflector())
 	{}
 
-	constexpr Reflector createCombinedReflector()
+public:
+	constexpr Reflector createCombinedReflector() const { return createCombinedReflector(reflector); }
+
+	constexpr Reflector createCombinedReflector(const Reflector& r) const
 	{
 		ReflectorEncoding encoding{};
 		for (int8_t i = 0; i < 26; ++i)
 		{
 			const int8_t c3 = leftRotor.forward(identityEncoding[i]);
-			const int8_t c4 = reflector.forward(c3);
-			const int8_t c5 = leftRotor.backward(c4);
+			const int8_t g1 = greekRotor.forward(c3);
+			const int8_t c4 = r.forward(g1);
+			const int8_t g2 = greekRotor.backward(c4);
+			const int8_t c5 = leftRotor.backward(g2);
 			encoding[i] = c5;
 		}
 		for (int8_t i = 26; i < 26 * 2; ++i)
@@ -58,23 +119,53 @@ public:
 		leftRotorPlusReflector = createCombinedReflector();
 	}
 
+	constexpr void resetRotorPositions(int8_t greek, int8_t a, int8_t b, int8_t c)
+	{
+		greekRotor.resetPosition(greek);
+		resetRotorPositions(a, b, c);
+	}
+
+	constexpr void setReflector(char reflectorId) { setReflector(Reflector::Create(reflectorId)); }
+
+	constexpr void setReflector(const Reflector& wiring)
+	{
+		reflector = wiring;
+		leftRotorPlusReflector = createCombinedReflector();
+	}
+
+	// connects the two letters in a rewirable reflector, the old partners are left to the caller.
+	// Only the two affected entries of the combined reflector are updated.
+	constexpr void rewireReflector(int8_t first, int8_t second)
+	{
+		reflector.plug(first, second);
+		const int8_t firstEntry = leftRotor.backward(greekRotor.backward(first)) % 26;
+		const int8_t secondEntry = leftRotor.backward(greekRotor.backward(second)) % 26;
+		leftRotorPlusReflector.plug(firstEntry, secondEntry);
+	}
+
+	// steps the rotors, returns true if the left rotor has moved
+	constexpr bool step() { return SteppingPolicy::step(leftRotor, middleRotor, rightRotor); }
+
+	constexpr std::array<int8_t, 3> getRotorPositions() const
+	{
+		return {leftRotor.getPosition(), middleRotor.getPosition(), rightRotor.getPosition()};
+	}
+
 	constexpr void rotate()
 	{
-		// If middle rotor notch - double-stepping
-		if (middleRotor.isAtNotch())
-		{
-			middleRotor.turnover();
-			leftRotor.turnover();
+		if (step())
 			leftRotorPlusReflector = createCombinedReflector();
-		}
-		// If left-rotor notch
-		else if (rightRotor.isAtNotch())
-		{
-			middleRotor.turnover();
-		}
+	}
 
-		// Increment right-most rotor
-		rightRotor.turnover();
+	// the rotors and reflector between plugboard in and out at the current position
+	constexpr int8_t scramble(int8_t c) const
+	{
+		// Right to left
+		const int8_t c1 = rightRotor.forward(c);
+		const int8_t c2 = middleRotor.forward(c1);
+		const int8_t c5 = leftRotorPlusReflector.forward(c2);
+		const int8_t c6 = middleRotor.backward(c5);
+		return rightRotor.backward(c6);
 	}
 
 	constexpr int8_t encrypt(int8_t c)
@@ -84,15 +175,10 @@ public:
 		// Plugboard in
 		c = plugboard.forward(c);
 
-		// Right to left
-		const int8_t c1 = rightRotor.forward(c);
-		const int8_t c2 = middleRotor.forward(c1);
-		const int8_t c5 = leftRotorPlusReflector.forward(c2);
-		const int8_t c6 = middleRotor.backward(c5);
-		const int8_t c7 = rightRotor.backward(c6);
+		const int8_t c7 = scramble(c);
 
 		// Plugboard out
-		return plugboard.forward(c7);
+		return plugboard.backward(c7);
 	}
 
 	template<size_t sz>
@@ -103,9 +189,61 @@ public:
 			out[i] = encrypt(input[i]);
 		return out;
 	}
+
+	// encrypts the input once for every given reflector, see encryptInto
+	template<size_t sz, size_t N>
+	constexpr void encrypt(const std::array<int8_t, sz>& input,
+			const std::array<Reflector, N>& reflectors,
+			std::array<std::array<int8_t, sz>, N>& out)
+	{
+		std::array<Store<sz>, N> stores{};
+		for (size_t r = 0; r < N; ++r)
+			stores[r].out = &out[r];
+		encryptInto(input, reflectors, stores);
+	}
+
+	// encrypts the input once for every given reflector, every letter goes straight into the
+	// accumulator of its reflector (anything with add(int8_t)) and the texts are never written out.
+	// The rotors step only once per character and the way in through plugboard, right and middle
+	// rotor is shared, only the combined left rotor + reflector and the way back differ.
+	// Encrypts input[begin, end) only, a later call for the rest continues where this one stopped.
+	template<size_t sz, size_t N, class Accumulator>
+	constexpr void encryptInto(const std::array<int8_t, sz>& input,
+			const std::array<Reflector, N>& reflectors,
+			std::array<Accumulator, N>& accumulators,
+			int begin = 0,
+			int end = sz)
+	{
+		std::array<Reflector, N> combined{};
+		for (size_t r = 0; r < N; ++r)
+			combined[r] = createCombinedReflector(reflectors[r]);
+
+		for (int i = begin; i < end; i++)
+		{
+			if (step())
+			{
+				for (size_t r = 0; r < N; ++r)
+					combined[r] = createCombinedReflector(reflectors[r]);
+			}
+
+			const int8_t c = plugboard.forward(input[i]);
+			const int8_t c1 = rightRotor.forward(c);
+			const int8_t c2 = middleRotor.forward(c1);
+			for (size_t r = 0; r < N; ++r)
+			{
+				const int8_t c5 = combined[r].forward(c2);
+				const int8_t c6 = middleRotor.backward(c5);
+				const int8_t c7 = rightRotor.backward(c6);
+				accumulators[r].add(plugboard.backward(c7));
+			}
+		}
+	}
 };
 
-inline std::string encryptString(Enigma& e, const char* input)
+using Enigma = BasicEnigma<LeverStepping>;
+
+template<class SteppingPolicy>
+inline std::string encryptString(BasicEnigma<SteppingPolicy>& e, const char* input)
 {
 	int sz = std::strlen(input);
 	std::string out;
@@ -133,3 +133,95 @@ TEST(Enigma, PlugBoardTest0O)
 	std::string output = encryptString(e, input);
 	EXPECT_EQ(expectedOutput, output);
 }
+
+TEST(Enigma, MultipleReflectors)
+{
+	// encrypting for several reflectors at once has to match the individual machines
+	const char* input = "ABCDEFGHIJKLMNOPQRSTUVWXYZAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBBBBBBBBBBBABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	std::array<int8_t, 104> msg;
+	for (size_t i = 0; i < msg.size(); ++i)
+		msg[i] = charToIndex(input[i]);
+
+	std::array<char, 3> reflectorIds{'A', 'B', 'C'};
+	std::array<Reflector, 3> reflectors{Reflector::Create('A'), Reflector::Create('B'), Reflector::Create('C')};
+	std::array<std::array<int8_t, 104>, 3> results;
+	Enigma e({7, 5, 4}, 'B', {10, 5, 12}, {1, 2, 3}, {"AC", "FG", "JY", "LW"});
+	e.encrypt(msg, reflectors, results);
+
+	for (int r = 0; r < 3; ++r)
+	{
+		Enigma single({7, 5, 4}, reflectorIds[r], {10, 5, 12}, {1, 2, 3}, {"AC", "FG", "JY", "LW"});
+		std::string expectedOutput = encryptString(single, input);
+		std::string output;
+		for (int8_t c : results[r])
+			output += indexToChar(c);
+		EXPECT_EQ(expectedOutput, output);
+	}
+}
+
+TEST(Enigma, NavalM4)
+{
+	// Beta II IV I, thin reflector B, rings A A A V, start positions V J N A
+	Enigma e = Enigma::CreateM4({9, 2, 4, 1}, 'b', {21, 9, 13, 0}, {0, 0, 0, 21}, {"AT", "BL", "DF", "GJ", "HM", "NW", "OP", "QY", "RZ", "VX"});
+	const char* input = "NCZWVUSXPNYMINHZXMQXSFWXWLKJAHSHNMCOCCAKUQPMKCSMHKSEINJUSBLKIOSXCKUBHMLLXCSJUSRRDVKOHULXWCCBGVLIYXEOAHXRHKKFVDREWEZLXOBAFGYUJQUKGRTVUKAMEURBVEKSUHHVOYHABCJWMAKLFKLMYFVNRIZRVVRTKOFDANJMOLBGFFLEOPRGTFLVRHOWOPBEKVWMUQFMPWPARMFHAGKXIIBG";
+	const char* expectedOutput = "VONVONJLOOKSJHFFTTTEINSEINSDREIZWOYYQNNSNEUNINHALTXXBEIANGRIFFUNTERWASSERGEDRUECKTYWABOSXLETZTERGEGNERSTANDNULACHTDREINULUHRMARQUANTONJOTANEUNACHTSEYHSDREIYZWOZWONULGRADYACHTSMYSTOSSENACHXEKNSVIERMBFAELLTYNNNNNNOOOVIERYSICHTEINSNULL";
+	std::string output = encryptString(e, input);
+	EXPECT_EQ(expectedOutput, output);
+}
+
+TEST(Enigma, NavalM4CompatibleWithM3)
+{
+	// Beta at A with the thin reflector B is the same as the three rotor machine with reflector B
+	Enigma m4 = Enigma::CreateM4({9, 1, 2, 3}, 'b', {0, 3, 5, 7}, {0, 1, 2, 3}, {"AT", "BL"});
+	Enigma m3({1, 2, 3}, 'B', {3, 5, 7}, {1, 2, 3}, {"AT", "BL"});
+	const char* input = "ABCDEFGHIJKLMNOPQRSTUVWXYZAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBBBBBBBBBBBABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	EXPECT_EQ(encryptString(m3, input), encryptString(m4, input));
+}
+
+TEST(Enigma, DoubleStepping)
+{
+	// I II III starting at A D U, the middle rotor steps twice in a row
+	Enigma e({1, 2, 3}, 'B', {0, 3, 20}, {0, 0, 0}, {});
+	std::array<std::array<int8_t, 3>, 4> expectedPositions{{{0, 3, 21}, {0, 4, 22}, {1, 5, 23}, {1, 5, 24}}};
+	for (const auto& expected : expectedPositions)
+	{
+		e.encrypt(0);
+		EXPECT_EQ(expected, e.getRotorPositions());
+	}
+}
+
+TEST(Enigma, OdometerStepping)
+{
+	// same start, but without the double step the middle rotor waits for the right one
+	BasicEnigma<OdometerStepping> e(
+			Rotor::Create(1, 0, 0), Rotor::Create(2, 3, 0), Rotor::Create(3, 20, 0), Reflector::Create('B'), {});
+	std::array<std::array<int8_t, 3>, 4> expectedPositions{{{0, 3, 21}, {0, 4, 22}, {0, 4, 23}, {0, 4, 24}}};
+	for (const auto& expected : expectedPositions)
+	{
+		e.encrypt(0);
+		EXPECT_EQ(expected, e.getRotorPositions());
+	}
+
+	// and all positions are passed exactly once
+	BasicEnigma<OdometerStepping> full(
+			Rotor::Create(1, 0, 0), Rotor::Create(2, 0, 0), Rotor::Create(3, 0, 0), Reflector::Create('B'), {});
+	for (int i = 0; i < 26 * 26 * 26; ++i)
+		full.encrypt(0);
+	EXPECT_EQ((std::array<int8_t, 3>{0, 0, 0}), full.getRotorPositions());
+}
+
+TEST(Enigma, RewireReflector)
+{
+	// rewiring a machine has to give the same result as building it with the new reflector
+	Reflector ukwD = Reflector::Create('D');
+	Enigma rewired({1, 2, 3}, 'D', {3, 25, 16}, {4, 5, 6}, {"AT", "BL"});
+	rewired.rewireReflector(charToIndex('A'), charToIndex('C'));
+	rewired.rewireReflector(charToIndex('B'), charToIndex('D'));
+	ukwD.plug(charToIndex('A'), charToIndex('C'));
+	ukwD.plug(charToIndex('B'), charToIndex('D'));
+	Enigma fresh({1, 2, 3}, 'D', {3, 25, 16}, {4, 5, 6}, {"AT", "BL"});
+	fresh.setReflector(ukwD);
+
+	const char* input = "ABCDEFGHIJKLMNOPQRSTUVWXYZAAAAAAAAAAAAAAAAAAAAAAAAAABBBBBBBBBBBBBBBBBBBBBBBBBBABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	EXPECT_EQ(encryptString(fresh, input), encryptString(rewired, input));
+}
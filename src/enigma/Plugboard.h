@@ -7,7 +7,11 @@
 class Plugboard
 {
 public:
+	// way in from the keyboard to the rotors
 	ReflectorEncoding wiring{ReflectorIdentity};
+	// way out from the rotors to the lamps, the same as wiring for a plain plugboard
+	// but differs for non-involutive devices like the Uhr
+	ReflectorEncoding outWiring{ReflectorIdentity};
 	std::array<bool, 26> plugged{false};
 	bool has_plugs{false};
 
@@ -53,10 +57,18 @@ public:
 		}
 		for (int8_t i = 26; i < 26 * 2; ++i)
 			wiring[i] = wiring[i - 26];
+		outWiring = wiring;
 	}
 
-	constexpr Plugboard(const ReflectorEncoding& e) : wiring(e) {}
+	constexpr Plugboard(const ReflectorEncoding& e) : wiring(e), outWiring(e), has_plugs(true) {}
+	constexpr Plugboard(const ReflectorEncoding& in, const ReflectorEncoding& out)
+		: wiring(in), outWiring(out), has_plugs(true)
+	{
+		for (int8_t i = 0; i < 26; ++i)
+			plugged[i] = in[i] != i;
+	}
 	constexpr int8_t forward(int8_t c) const { return has_plugs ? wiring[c] : c; }
+	constexpr int8_t backward(int8_t c) const { return has_plugs ? outWiring[c] : c; }
 
 	constexpr void addPlug(int8_t first, int8_t second)
 	{
@@ -64,6 +76,10 @@ public:
 		wiring[second] = first;
 		wiring[first + 26] = second;
 		wiring[second + 26] = first;
+		outWiring[first] = second;
+		outWiring[second] = first;
+		outWiring[first + 26] = second;
+		outWiring[second + 26] = first;
 		if (plugged[first] || plugged[second])
 			throw "already plugged";
 
@@ -72,6 +88,22 @@ public:
 		has_plugs = true;
 	}
 
+	// removes the plug the letter is part of
+	constexpr void removePlug(int8_t letter)
+	{
+		const int8_t other = wiring[letter];
+		for (int8_t c : {letter, other})
+		{
+			wiring[c] = c;
+			wiring[c + 26] = c;
+			outWiring[c] = c;
+			outWiring[c + 26] = c;
+			plugged[c] = false;
+		}
+	}
+
+	bool operator==(const Plugboard& other) const { return wiring == other.wiring && outWiring == other.outWiring; }
+
 	std::string ToString() const
 	{
 		std::string s = "";
@@ -3,6 +3,8 @@
 
 #include <enigma/Rotor.h>
 
+#include <initializer_list>
+
 using ReflectorEncoding = std::array<int8_t, 26 + 26>;
 
 constexpr ReflectorEncoding makeReflectorEncoding(const char* chars)
@@ -20,7 +22,14 @@ constexpr ReflectorEncoding ReflectorIdentity = makeReflectorEncoding("ABCDEFGHI
 class Reflector
 {
 public:
+	constexpr Reflector() : forwardWiring(ReflectorIdentity) {}
 	constexpr Reflector(const ReflectorEncoding& encoding) : forwardWiring(encoding) {}
+	// reflectors wired at runtime like the UKW-D, from 13 pairs in the same notation as the plugboard
+	constexpr Reflector(std::initializer_list<const char*> list) : forwardWiring(ReflectorIdentity)
+	{
+		for (const char* pair : list)
+			plug(charToIndex(pair[0]), charToIndex(pair[1]));
+	}
 
 	static constexpr Reflector Create(char name)
 	{
@@ -32,6 +41,14 @@ public:
 			return Reflector(makeReflectorEncoding("YRUHQSLDPXNGOKMIEBFZCWVJAT"));
 		case 'C':
 			return Reflector(makeReflectorEncoding("FVPJIAOYEDRZXWGCTKUQSBNMHL"));
+		// thin reflectors of the naval M4, only used together with a greek wheel
+		case 'b':
+			return Reflector(makeReflectorEncoding("ENKQAUYWJICOPBLMDXZVFTHRGS"));
+		case 'c':
+			return Reflector(makeReflectorEncoding("RDOBJNTKVEHMLFCWZAXGYIPSUQ"));
+		// rewirable UKW-D, J-Y is fixed, the other 12 pairs are only a starting point
+		case 'D':
+			return Reflector{{"AB", "CD", "EF", "GH", "IK", "JY", "LM", "NO", "PQ", "RS", "TU", "VW", "XZ"}};
 		default:
 			return Reflector(ReflectorIdentity);
 		}
@@ -43,6 +60,14 @@ public:
 		return forwardWiring[c];
 	}
 
+	constexpr void plug(int8_t first, int8_t second)
+	{
+		forwardWiring[first] = second;
+		forwardWiring[second] = first;
+		forwardWiring[first + 26] = second;
+		forwardWiring[second + 26] = first;
+	}
+
 private:
 	ReflectorEncoding forwardWiring;
 };
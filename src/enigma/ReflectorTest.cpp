@@ -13,3 +13,14 @@ TEST(Enigma, Reflector)
 		EXPECT_EQ(result[i], id.forward(identityEncoding[i]));
 	}
 }
+
+TEST(Enigma, ReflectorFromPairs)
+{
+	constexpr Reflector b{{"AY", "BR", "CU", "DH", "EQ", "FS", "GL", "IP", "JX", "KN", "MO", "TZ", "VW"}};
+	constexpr Reflector reference = Reflector::Create('B');
+
+	for (int i = 0; i < 26 * 2; ++i)
+	{
+		EXPECT_EQ(reference.forward(i), b.forward(i));
+	}
+}
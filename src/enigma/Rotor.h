@@ -2,6 +2,7 @@
 #define ENIGMA_ROTOR_H
 
 #include <array>
+#include <cstdint>
 
 using Encoding = std::array<int8_t, 26 + 26 + 26>;
 
@@ -56,25 +57,30 @@ private:
 	}
 };
 
+// notches are stored as a bitmask over the 26 positions, bit n set means a notch at position n
+constexpr uint32_t makeNotchMask(const char* notches)
+{
+	uint32_t mask = 0;
+	for (const char* c = notches; *c != 0; ++c)
+		mask |= 1u << charToIndex(*c);
+	return mask;
+}
+
 class Rotor
 {
 	const RotorMapping& mapping;
-	int8_t notchPosition;
+	uint32_t notchMask;
 	int8_t ringSetting;
 	int8_t currentRotorShift;
-	int8_t adjustedNotchPosition;
-	bool hasSecondaryNotch;
-	int8_t adjustedSecondaryNotchPosition;
+	uint32_t adjustedNotchMask;
 
 public:
-	constexpr Rotor(const RotorMapping& mapping, int8_t rotorPosition, int8_t notchPosition, bool hasSecondaryNotch, int8_t ringSetting)
+	constexpr Rotor(const RotorMapping& mapping, int8_t rotorPosition, uint32_t notchMask, int8_t ringSetting)
 		: mapping(mapping)
-		, notchPosition(notchPosition)
+		, notchMask(notchMask)
 		, ringSetting(ringSetting)
 		, currentRotorShift((rotorPosition + 26 - ringSetting) % 26)
-		, adjustedNotchPosition((notchPosition + 26 - ringSetting) % 26)
-		, hasSecondaryNotch(hasSecondaryNotch)
-		, adjustedSecondaryNotchPosition((12 + 26 - ringSetting) % 26)
+		, adjustedNotchMask(adjustNotchMask(notchMask, ringSetting))
 	{}
 
 	static constexpr RotorMapping map1{1, makeEncoding("EKMFLGDQVZNTOWYHXUSPAIBRCJ")};
@@ -85,28 +91,35 @@ public:
 	static constexpr RotorMapping map6{6, makeEncoding("JPGVOUMFYQBENHZRDKASXLICTW")};
 	static constexpr RotorMapping map7{7, makeEncoding("NZJHGRCXMYSWBOUFAIVLPEKQDT")};
 	static constexpr RotorMapping map8{8, makeEncoding("FKQHTLXOCBJSPDZRAMEWNIUYGV")};
+	// greek wheels of the naval M4, these never step
+	static constexpr RotorMapping mapBeta{9, makeEncoding("LEYJVCNIXWPBQMDRTAKZGFUHOS")};
+	static constexpr RotorMapping mapGamma{10, makeEncoding("FSOKANUERHMBTIYCWLQPZXVGJD")};
 	static constexpr RotorMapping map0{0, identityEncoding};
 
 	static constexpr Rotor Create(int8_t rotorNum, int8_t rotorPosition, int8_t ringSetting)
 	{
 		if (rotorNum == 1)
-			return Rotor(map1, rotorPosition, 16, false, ringSetting);
+			return Rotor(map1, rotorPosition, makeNotchMask("Q"), ringSetting);
 		if (rotorNum == 2)
-			return Rotor(map2, rotorPosition, 4, false, ringSetting);
+			return Rotor(map2, rotorPosition, makeNotchMask("E"), ringSetting);
 		if (rotorNum == 3)
-			return Rotor(map3, rotorPosition, 21, false, ringSetting);
+			return Rotor(map3, rotorPosition, makeNotchMask("V"), ringSetting);
 		if (rotorNum == 4)
-			return Rotor(map4, rotorPosition, 9, false, ringSetting);
+			return Rotor(map4, rotorPosition, makeNotchMask("J"), ringSetting);
 		if (rotorNum == 5)
-			return Rotor(map5, rotorPosition, 25, false, ringSetting);
+			return Rotor(map5, rotorPosition, makeNotchMask("Z"), ringSetting);
 		if (rotorNum == 6)
-			return Rotor(map6, rotorPosition, 25, true, ringSetting);
+			return Rotor(map6, rotorPosition, makeNotchMask("ZM"), ringSetting);
 		if (rotorNum == 7)
-			return Rotor(map7, rotorPosition, 25, true, ringSetting);
+			return Rotor(map7, rotorPosition, makeNotchMask("ZM"), ringSetting);
 		if (rotorNum == 8)
-			return Rotor(map8, rotorPosition, 25, true, ringSetting);
+			return Rotor(map8, rotorPosition, makeNotchMask("ZM"), ringSetting);
+		if (rotorNum == 9)
+			return Rotor(mapBeta, rotorPosition, 0, ringSetting);
+		if (rotorNum == 10)
+			return Rotor(mapGamma, rotorPosition, 0, ringSetting);
 		else
-			return Rotor(map0, rotorPosition, 0, false, ringSetting);
+			return Rotor(map0, rotorPosition, 0, ringSetting);
 	}
 
 	constexpr int8_t getName() const { return mapping.rotorNum; }
@@ -115,11 +128,7 @@ public:
 
 	constexpr int8_t backward(int8_t c) const { return encipher(c, mapping.backwardWiring); }
 
-	constexpr bool isAtNotch()
-	{
-		return adjustedNotchPosition == currentRotorShift
-			   || (hasSecondaryNotch && adjustedSecondaryNotchPosition == currentRotorShift);
-	}
+	constexpr bool isAtNotch() const { return (adjustedNotchMask >> currentRotorShift) & 1u; }
 
 	constexpr void turnover()
 	{
@@ -129,7 +138,15 @@ public:
 
 	constexpr void resetPosition(int pos) { currentRotorShift = (pos + 26 - ringSetting) % 26; }
 
+	constexpr int8_t getPosition() const { return (currentRotorShift + ringSetting) % 26; }
+
 private:
+	// the notch check happens on the shift, so the notches are moved by the ring setting
+	static constexpr uint32_t adjustNotchMask(uint32_t mask, int8_t ringSetting)
+	{
+		return ((mask >> ringSetting) | (mask << (26 - ringSetting))) & ((1u << 26) - 1);
+	}
+
 	// return value can go up to 52 to avoid modulo operations
 	constexpr int8_t encipher(int8_t k, const Encoding& mapping) const
 	{
@@ -25,3 +25,23 @@ TEST(Enigma, FirstRotor)
 		EXPECT_EQ(indexToChar(identityEncoding[i]), indexToChar(id.backward(rotorwiring[i])));
 	}
 }
+
+TEST(Enigma, MultipleNotches)
+{
+	constexpr uint32_t notches = makeNotchMask("ACFZ");
+	Rotor rotor(Rotor::map1, 0, notches, 0);
+	for (int i = 0; i < 26; ++i)
+	{
+		EXPECT_EQ(rotor.isAtNotch(), i == 0 || i == 2 || i == 5 || i == 25);
+		rotor.turnover();
+	}
+
+	// the ring setting does not move the notches relative to the visible position
+	Rotor ringed(Rotor::map1, 0, notches, 7);
+	for (int i = 0; i < 26; ++i)
+	{
+		int8_t position = ringed.getPosition();
+		EXPECT_EQ(ringed.isAtNotch(), position == 0 || position == 2 || position == 5 || position == 25);
+		ringed.turnover();
+	}
+}
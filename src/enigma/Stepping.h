@@ -0,0 +1,56 @@
+#ifndef ENIGMA_STEPPING_H
+#define ENIGMA_STEPPING_H
+
+#include <enigma/Rotor.h>
+
+// the stepping policies move the rotors before each character is enciphered,
+// they return true if the left rotor has moved
+
+// pawl and ratchet stepping of the Enigma I, M3 and M4 including the double step of the middle rotor
+struct LeverStepping
+{
+	static constexpr bool step(Rotor& leftRotor, Rotor& middleRotor, Rotor& rightRotor)
+	{
+		bool leftRotorMoved = false;
+		// If middle rotor notch - double-stepping
+		if (middleRotor.isAtNotch())
+		{
+			middleRotor.turnover();
+			leftRotor.turnover();
+			leftRotorMoved = true;
+		}
+		// If left-rotor notch
+		else if (rightRotor.isAtNotch())
+		{
+			middleRotor.turnover();
+		}
+
+		// Increment right-most rotor
+		rightRotor.turnover();
+		return leftRotorMoved;
+	}
+};
+
+// cog wheel driven machines like the Abwehr Enigma G step like an odometer,
+// a rotor only moves its left neighbour when passing a notch, there is no double step
+struct OdometerStepping
+{
+	static constexpr bool step(Rotor& leftRotor, Rotor& middleRotor, Rotor& rightRotor)
+	{
+		bool leftRotorMoved = false;
+		if (rightRotor.isAtNotch())
+		{
+			if (middleRotor.isAtNotch())
+			{
+				leftRotor.turnover();
+				leftRotorMoved = true;
+			}
+			middleRotor.turnover();
+		}
+
+		rightRotor.turnover();
+		return leftRotorMoved;
+	}
+};
+
+#endif /* ENIGMA_STEPPING_H */
@@ -0,0 +1,79 @@
+#ifndef ENIGMA_UHR_H
+#define ENIGMA_UHR_H
+
+#include <enigma/Plugboard.h>
+
+#include <initializer_list>
+
+// The Enigma Uhr replaces the ten plugboard cables with a rotating switch,
+// which makes the plugboard non-involutive for most of its 40 dial positions.
+// Each cable pair "XY" connects X to an a-plug and Y to a b-plug of the Uhr.
+class Uhr
+{
+	// internal wiring of the disc from the a-side contacts to the b-side contacts
+	static constexpr std::array<int8_t, 40> discWiring{6, 31, 4, 29, 18, 39, 16, 25, 30, 23, 28, 1, 38, 11,
+			36, 37, 26, 27, 24, 21, 14, 3, 12, 17, 2, 7, 0, 33, 10, 35, 8, 5, 22, 19, 20, 13, 34, 15, 32, 9};
+	// a-plug n uses the contacts 4n (thick pin) and 4n + 2 (thin pin),
+	// b-plug n sits at the contacts 4 * bPlugBlock[n] and 4 * bPlugBlock[n] + 2
+	static constexpr std::array<int8_t, 10> bPlugBlock{1, 4, 7, 9, 6, 3, 0, 2, 5, 8};
+
+	std::array<int8_t, 10> aPlugs{};
+	std::array<int8_t, 10> bPlugs{};
+
+public:
+	static constexpr int8_t dialPositions = 40;
+
+	constexpr Uhr(std::initializer_list<const char*> list)
+	{
+		// same conventions as for the Plugboard, exactly ten pairs are expected
+		int n = 0;
+		for (const char* plug : list)
+		{
+			aPlugs[n] = charToIndex(plug[0]);
+			bPlugs[n] = charToIndex(plug[1]);
+			++n;
+		}
+		if (n != 10)
+			throw "the Uhr needs exactly ten plugs";
+	}
+
+	// the plugboard as seen by the machine with the dial at the given position,
+	// at the positions 0, 4, 8, ... the mapping is involutive, at 0 it is the same as the plain cables
+	constexpr Plugboard createPlugboard(int8_t dialPosition) const
+	{
+		std::array<int8_t, 40> inverseDiscWiring{};
+		for (int8_t i = 0; i < 40; ++i)
+			inverseDiscWiring[discWiring[i]] = i;
+
+		ReflectorEncoding in{ReflectorIdentity};
+		for (int8_t n = 0; n < 10; ++n)
+		{
+			// thick pin of the a-plug to the thin pin of a b-plug
+			const int8_t aContact = (4 * n + dialPosition) % 40;
+			const int8_t bBlock = ((discWiring[aContact] + 40 - dialPosition) % 40) / 4;
+			// and the other way around for the b-plugs
+			const int8_t bContact = (4 * bPlugBlock[n] + dialPosition) % 40;
+			const int8_t aBlock = ((inverseDiscWiring[bContact] + 40 - dialPosition) % 40) / 4;
+
+			for (int8_t k = 0; k < 10; ++k)
+			{
+				if (bPlugBlock[k] == bBlock)
+					in[aPlugs[n]] = bPlugs[k];
+			}
+			in[bPlugs[n]] = aPlugs[aBlock];
+		}
+
+		// the thin pins carry the way back, which is always the inverse of the way in
+		ReflectorEncoding out{};
+		for (int8_t i = 0; i < 26; ++i)
+			out[in[i]] = i;
+		for (int8_t i = 26; i < 26 * 2; ++i)
+		{
+			in[i] = in[i - 26];
+			out[i] = out[i - 26];
+		}
+		return Plugboard(in, out);
+	}
+};
+
+#endif /* ENIGMA_UHR_H */
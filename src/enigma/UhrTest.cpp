@@ -0,0 +1,63 @@
+#include <enigma/Enigma.h>
+#include <enigma/Uhr.h>
+#include <gtest/gtest.h>
+
+TEST(Enigma, UhrAtZeroIsPlugboard)
+{
+	constexpr Uhr uhr{{"AG", "HR", "YT", "KI", "FL", "WE", "NM", "SD", "OP", "QJ"}};
+	constexpr Plugboard plain{{"AG", "HR", "YT", "KI", "FL", "WE", "NM", "SD", "OP", "QJ"}};
+	constexpr Plugboard dialed = uhr.createPlugboard(0);
+
+	for (int i = 0; i < 26; ++i)
+	{
+		EXPECT_EQ(plain.forward(i), dialed.forward(i));
+		EXPECT_EQ(plain.backward(i), dialed.backward(i));
+	}
+}
+
+TEST(Enigma, UhrNotInvolutive)
+{
+	constexpr Uhr uhr{{"AG", "HR", "YT", "KI", "FL", "WE", "NM", "SD", "OP", "QJ"}};
+
+	for (int8_t dial = 0; dial < Uhr::dialPositions; ++dial)
+	{
+		Plugboard board = uhr.createPlugboard(dial);
+		bool involutive = true;
+		for (int i = 0; i < 26; ++i)
+		{
+			// the way out always undoes the way in
+			EXPECT_EQ(i, board.backward(board.forward(i)));
+			involutive &= board.forward(board.forward(i)) == i;
+		}
+		EXPECT_EQ(dial % 4 == 0, involutive);
+	}
+}
+
+TEST(Enigma, UhrDecrypt)
+{
+	// with the Uhr the machine is still its own inverse
+	constexpr Uhr uhr{{"AG", "HR", "YT", "KI", "FL", "WE", "NM", "SD", "OP", "QJ"}};
+	const char* input = "IPROPOSETOCONSIDERTHEQUESTIONCANMACHINESTHINKTHISSHOULDBEGINWITHDEFINITIONSOFTHEMEANINGOFTHETERMS";
+	Enigma e1({2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, uhr.createPlugboard(27));
+	std::string ciphertext = encryptString(e1, input);
+	Enigma e2({2, 5, 3}, 'B', {7, 4, 19}, {12, 2, 20}, uhr.createPlugboard(27));
+	EXPECT_EQ(input, encryptString(e2, ciphertext.c_str()));
+}
+
+TEST(Enigma, UhrKnownAnswer)
+{
+	// traced pin by pin through the disc wiring turned by the dial, independently of Uhr.h;
+	// at 4 the mapping swaps pairs again, at 1 and 27 it does not
+	constexpr Uhr uhr{{"AG", "HR", "YT", "KI", "FL", "WE", "NM", "SD", "OP", "QJ"}};
+	const std::array<std::pair<int8_t, const char*>, 3> expected{{
+			{1, "TBCQOLSIKNDHYGRFEWJAUVMXPZ"},
+			{4, "EBCFADNLWYPHQGTKMSROUVIXJZ"},
+			{27, "GBCAFMKRWHPNSEJQTODYUVIXLZ"},
+	}};
+	for (const auto& [dial, mapping] : expected)
+	{
+		Plugboard board = uhr.createPlugboard(dial);
+		for (int8_t i = 0; i < 26; ++i)
+			EXPECT_EQ(mapping[i], indexToChar(board.forward(i))) << int(dial) << " " << indexToChar(i);
+	}
+}